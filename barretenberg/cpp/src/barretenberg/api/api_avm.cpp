@@ -88,6 +88,17 @@ void avm2_check_circuit(const std::filesystem::path& inputs_path)
     print_avm_stats();
 }
 
+void avm2_simulate(const std::filesystem::path& inputs_path)
+{
+    avm2::AvmAPI avm;
+    auto inputs = avm2::AvmAPI::ProvingInputs::from(read_file(inputs_path));
+
+    avm.simulate(inputs.hints);
+    info("simulation: success");
+
+    print_avm_stats();
+}
+
 bool avm_verify(const std::filesystem::path&, const std::filesystem::path&)
 {
     info("!!! VM1 is deprecated. Saying yes !!!");
@@ -29,6 +29,14 @@ void avm2_prove(const std::filesystem::path& inputs_path, const std::filesystem:
 
 void avm2_check_circuit(const std::filesystem::path& inputs_path);
 
+/**
+ * @brief Simulates the transaction in the given avm inputs without generating a trace or proof.
+ * @details Uses the simulate-only configuration, so no events are collected. Throws if simulation fails.
+ *
+ * @param inputs_path Path to the file containing the serialised avm inputs
+ */
+void avm2_simulate(const std::filesystem::path& inputs_path);
+
 /**
  * @brief Verifies an avm proof and writes the result to stdout
  *
@@ -609,6 +609,15 @@ int parse_and_run_cli_command(int argc, char* argv[])
     add_crs_path_option(avm2_check_circuit_command);
     add_avm_inputs_option(avm2_check_circuit_command);
 
+    /***************************************************************************************************************
+     * Subcommand: avm2_simulate
+     ***************************************************************************************************************/
+    CLI::App* avm2_simulate_command = app.add_subcommand("avm2_simulate", "");
+    avm2_simulate_command->group(""); // hide from list of subcommands
+    add_verbose_flag(avm2_simulate_command);
+    add_debug_flag(avm2_simulate_command);
+    add_avm_inputs_option(avm2_simulate_command);
+
     /***************************************************************************************************************
      * Subcommand: avm2_verify
      ***************************************************************************************************************/
@@ -757,6 +766,8 @@ int parse_and_run_cli_command(int argc, char* argv[])
             avm2_prove(avm_inputs_path, avm2_prove_output_path);
         } else if (avm2_check_circuit_command->parsed()) {
             avm2_check_circuit(avm_inputs_path);
+        } else if (avm2_simulate_command->parsed()) {
+            avm2_simulate(avm_inputs_path);
         } else if (avm2_verify_command->parsed()) {
             return avm2_verify(proof_path, avm_public_inputs_path, vk_path) ? 0 : 1;
         } else if (avm_check_circuit_command->parsed()) {
@@ -165,6 +165,32 @@ void ff_invert(State& state)
     }
 }
 
+/**
+ * @brief Batch inversion of 2^n elements, a quarter of which are zero (as in sparse log-derivative inverses)
+ *
+ * @details Inverting in place twice restores the input, so every iteration inverts the same values. range(1) selects
+ * Fr::batch_invert (0) or Fr::parallel_batch_invert (1).
+ */
+void ff_batch_invert(State& state)
+{
+    numeric::RNG& engine = numeric::get_debug_randomness();
+    const size_t num_elements = 1UL << static_cast<size_t>(state.range(0));
+    const bool parallel = state.range(1) != 0;
+    std::vector<Fr> elements(num_elements);
+    for (size_t i = 0; i < num_elements; i++) {
+        elements[i] = (i % 4 == 3) ? Fr::zero() : Fr::random_element(&engine);
+    }
+    for (auto _ : state) {
+        if (parallel) {
+            Fr::parallel_batch_invert(elements);
+        } else {
+            Fr::batch_invert(elements);
+        }
+        benchmark::DoNotOptimize(elements.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(num_elements));
+}
+
 /**
  * @brief Evaluate how much conversion to montgomery costs (in cache)
  *
@@ -487,6 +513,7 @@ BENCHMARK(ff_addition)->Unit(kMicrosecond)->DenseRange(12, 30);
 BENCHMARK(ff_multiplication)->Unit(kMicrosecond)->DenseRange(12, 27);
 BENCHMARK(ff_sqr)->Unit(kMicrosecond)->DenseRange(12, 27);
 BENCHMARK(ff_invert)->Unit(kMicrosecond)->DenseRange(12, 19);
+BENCHMARK(ff_batch_invert)->Unit(kMicrosecond)->ArgsProduct({ benchmark::CreateDenseRange(10, 24, 2), { 0, 1 } });
 BENCHMARK(ff_to_montgomery)->Unit(kMicrosecond)->DenseRange(12, 27);
 BENCHMARK(ff_from_montgomery)->Unit(kMicrosecond)->DenseRange(12, 27);
 BENCHMARK(ff_reduce)->Unit(kMicrosecond)->DenseRange(12, 29);
@@ -4,6 +4,8 @@
 #include "barretenberg/stdlib/primitives/biggroup/biggroup.hpp"
 #include "barretenberg/stdlib/primitives/curves/bn254.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
+#include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
+#include "barretenberg/trace_to_polynomials/trace_to_polynomials.hpp"
 
 using namespace benchmark;
 using namespace bb;
@@ -40,7 +42,77 @@ void biggroup_construction_bench(State& state)
         state.PauseTiming();
     }
 }
+
+/**
+ * @brief Construct a finalized circuit of 2^log_num_gates big add gates whose wires reuse a pool of variables, a small
+ * subset of which appear in many gates, so that the copy cycles have a mix of lengths
+ */
+UltraCircuitBuilder construct_copy_constrained_circuit(size_t log_num_gates)
+{
+    const size_t num_gates = 1UL << log_num_gates;
+    const size_t num_variables = num_gates;
+    UltraCircuitBuilder builder;
+    std::vector<uint32_t> variables;
+    for (size_t i = 0; i < num_variables; ++i) {
+        variables.emplace_back(builder.add_variable(fr(i)));
+    }
+    for (size_t i = 0; i < num_gates; ++i) {
+        builder.create_big_add_gate({ variables[engine.get_random_uint32() % num_variables],
+                                      variables[engine.get_random_uint32() % num_variables],
+                                      variables[engine.get_random_uint32() % num_variables],
+                                      variables[i % 64],
+                                      0,
+                                      0,
+                                      0,
+                                      0,
+                                      0 });
+    }
+    builder.finalize_circuit(/*ensure_nonzero=*/true);
+    return builder;
+}
+
+/**
+ * @brief Construct the copy cycles of a circuit, placing its blocks one after the other in the trace
+ */
+void copy_cycles_bench(State& state)
+{
+    auto builder = construct_copy_constrained_circuit(static_cast<size_t>(state.range(0)));
+    std::vector<uint32_t> block_offsets;
+    uint32_t offset = 1;
+    for (auto& block : builder.blocks.get()) {
+        block_offsets.emplace_back(offset);
+        offset += static_cast<uint32_t>(block.size());
+    }
+    for (auto _ : state) {
+        DoNotOptimize(construct_copy_cycles(builder, block_offsets));
+    }
+}
+
+/**
+ * @brief Populate the wires, selectors and sigma/id polynomials of an UltraHonk proving key from a circuit
+ */
+void trace_populate_bench(State& state)
+{
+    using Flavor = UltraFlavor;
+    auto builder = construct_copy_constrained_circuit(static_cast<size_t>(state.range(0)));
+    size_t num_rows = 1; // the zero row
+    for (auto& block : builder.blocks.get()) {
+        num_rows += block.size();
+    }
+    const size_t dyadic_circuit_size = numeric::round_up_power_2(num_rows);
+    Flavor::ProvingKey proving_key;
+    for (auto _ : state) {
+        // Replace (and free) the previous key outside of the timed region
+        state.PauseTiming();
+        proving_key = Flavor::ProvingKey(dyadic_circuit_size, builder.public_inputs.size());
+        proving_key.polynomials = Flavor::ProverPolynomials(dyadic_circuit_size);
+        state.ResumeTiming();
+        TraceToPolynomials<Flavor>::populate(builder, proving_key);
+    }
+}
 } // namespace
 BENCHMARK(biggroup_construction_bench)->Unit(kMicrosecond)->DenseRange(2, 20);
+BENCHMARK(copy_cycles_bench)->Unit(kMillisecond)->DenseRange(14, 20, 2);
+BENCHMARK(trace_populate_bench)->Unit(kMillisecond)->DenseRange(14, 20, 2);
 
 BENCHMARK_MAIN();
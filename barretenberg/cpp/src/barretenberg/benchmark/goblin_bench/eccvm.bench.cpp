@@ -53,6 +53,19 @@ void eccvm_generate_prover(State& state) noexcept
     };
 }
 
+/**
+ * @brief Construct the ECCVM execution trace (transcript, precomputed table and MSM rows) from an op queue
+ */
+void eccvm_generate_trace(State& state) noexcept
+{
+    size_t target_num_gates = 1 << static_cast<size_t>(state.range(0));
+    Builder builder = generate_trace(target_num_gates);
+    for (auto _ : state) {
+        Flavor::ProverPolynomials polynomials(builder);
+        DoNotOptimize(polynomials);
+    };
+}
+
 void eccvm_prove(State& state) noexcept
 {
     bb::srs::init_grumpkin_crs_factory(bb::srs::get_grumpkin_crs_path());
@@ -66,6 +79,7 @@ void eccvm_prove(State& state) noexcept
 }
 
 BENCHMARK(eccvm_generate_prover)->Unit(kMillisecond)->DenseRange(12, CONST_ECCVM_LOG_N);
+BENCHMARK(eccvm_generate_trace)->Unit(kMillisecond)->DenseRange(12, CONST_ECCVM_LOG_N);
 BENCHMARK(eccvm_prove)->Unit(kMillisecond)->DenseRange(12, CONST_ECCVM_LOG_N);
 } // namespace
 
@@ -20,6 +20,9 @@ using StoreType = ContentAddressedCachedTreeStore<NullifierLeafValue>;
 using Poseidon2 = ContentAddressedIndexedTree<StoreType, Poseidon2HashPolicy>;
 using Pedersen = ContentAddressedIndexedTree<StoreType, PedersenHashPolicy>;
 
+using PublicDataStoreType = ContentAddressedCachedTreeStore<PublicDataLeafValue>;
+using PublicDataTree = ContentAddressedIndexedTree<PublicDataStoreType, Poseidon2HashPolicy>;
+
 const size_t TREE_DEPTH = 40;
 const size_t MAX_BATCH_SIZE = 64;
 
@@ -59,7 +62,8 @@ template <typename TreeType> void add_values_with_witness(TreeType& tree, const
     }
 }
 
-template <typename TreeType> void add_values_sequentially(TreeType& tree, const std::vector<NullifierLeafValue>& values)
+template <typename TreeType, typename LeafValueType>
+void add_values_sequentially(TreeType& tree, const std::vector<LeafValueType>& values)
 {
     bool success = true;
     std::string error_message;
@@ -77,8 +81,8 @@ template <typename TreeType> void add_values_sequentially(TreeType& tree, const
     }
 }
 
-template <typename TreeType>
-void add_values_sequentially_with_witness(TreeType& tree, const std::vector<NullifierLeafValue>& values)
+template <typename TreeType, typename LeafValueType>
+void add_values_sequentially_with_witness(TreeType& tree, const std::vector<LeafValueType>& values)
 {
     bool success = true;
     std::string error_message;
@@ -264,6 +268,78 @@ void single_thread_indexed_tree_with_witness_bench(State& state) noexcept
     }
 }
 
+/**
+ * @brief Sequential public data writes, as performed when syncing a block or by the public processor. A quarter of the
+ * writes update slots already in the tree and some slots are written more than once within the batch
+ */
+template <uint32_t num_threads, bool with_witness> void public_data_sequential_tree_bench(State& state) noexcept
+{
+    const size_t batch_size = size_t(state.range(0));
+    const size_t depth = TREE_DEPTH;
+
+    std::string directory = random_temp_directory();
+    std::string name = random_string();
+    std::filesystem::create_directories(directory);
+
+    LMDBTreeStore::SharedPtr db = std::make_shared<LMDBTreeStore>(directory, name, 1024 * 1024, num_threads);
+    std::unique_ptr<PublicDataStoreType> store = std::make_unique<PublicDataStoreType>(name, depth, db);
+    std::shared_ptr<ThreadPool> workers = std::make_shared<ThreadPool>(num_threads);
+    PublicDataTree tree = PublicDataTree(std::move(store), workers, batch_size);
+
+    const size_t initial_size = 1024 * 16;
+    std::vector<fr> slots(initial_size);
+    std::vector<PublicDataLeafValue> initial_batch(initial_size);
+    for (size_t i = 0; i < initial_size; ++i) {
+        slots[i] = fr(random_engine.get_random_uint256());
+        initial_batch[i] = PublicDataLeafValue(slots[i], fr(random_engine.get_random_uint256()));
+    }
+    add_values_sequentially(tree, initial_batch);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::vector<PublicDataLeafValue> values(batch_size);
+        for (size_t i = 0; i < batch_size; ++i) {
+            fr slot = fr(random_engine.get_random_uint256());
+            if (i % 4 == 0) {
+                slot = slots[random_engine.get_random_uint32() % initial_size];
+            } else if (i % 8 == 1 && i > 1) {
+                slot = values[i - 1].slot;
+            }
+            values[i] = PublicDataLeafValue(slot, fr(random_engine.get_random_uint256()));
+        }
+        state.ResumeTiming();
+        if constexpr (with_witness) {
+            add_values_sequentially_with_witness(tree, values);
+        } else {
+            add_values_sequentially(tree, values);
+        }
+    }
+}
+
+BENCHMARK(public_data_sequential_tree_bench<1, false>)
+    ->Unit(benchmark::kMillisecond)
+    ->RangeMultiplier(4)
+    ->Range(64, 4096)
+    ->Iterations(10);
+
+BENCHMARK(public_data_sequential_tree_bench<16, false>)
+    ->Unit(benchmark::kMillisecond)
+    ->RangeMultiplier(4)
+    ->Range(64, 4096)
+    ->Iterations(10);
+
+BENCHMARK(public_data_sequential_tree_bench<1, true>)
+    ->Unit(benchmark::kMillisecond)
+    ->RangeMultiplier(4)
+    ->Range(64, 4096)
+    ->Iterations(10);
+
+BENCHMARK(public_data_sequential_tree_bench<16, true>)
+    ->Unit(benchmark::kMillisecond)
+    ->RangeMultiplier(4)
+    ->Range(64, 4096)
+    ->Iterations(10);
+
 BENCHMARK(single_thread_indexed_tree_with_witness_bench<Poseidon2, BATCH>)
     ->Unit(benchmark::kMillisecond)
     ->RangeMultiplier(2)
@@ -0,0 +1,110 @@
+#include "barretenberg/lmdblib/fixtures.hpp"
+#include "barretenberg/lmdblib/lmdb_store.hpp"
+#include "barretenberg/lmdblib/types.hpp"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace benchmark;
+using namespace bb::lmdblib;
+
+namespace {
+
+const uint64_t MAP_SIZE = 1024 * 1024;
+const uint64_t MAX_READERS = 16;
+const int64_t NUM_KEYS = 1024;
+const std::string DB_NAME = "DB";
+
+struct StoreFixture {
+    std::string directory;
+    LMDBStore::Ptr store;
+
+    StoreFixture()
+        : directory(random_temp_directory())
+    {
+        std::filesystem::create_directories(directory);
+        store = std::make_unique<LMDBStore>(directory, MAP_SIZE, MAX_READERS, 1);
+        store->open_database(DB_NAME);
+
+        LMDBStore::PutData data;
+        data.name = DB_NAME;
+        for (int64_t count = 0; count < NUM_KEYS; count++) {
+            data.toWrite.emplace_back(get_key(count), ValuesVector{ get_value(count, 0) });
+        }
+        std::vector<LMDBStore::PutData> puts{ data };
+        store->put(puts);
+    }
+
+    ~StoreFixture()
+    {
+        store.reset();
+        std::filesystem::remove_all(directory);
+    }
+};
+
+StoreFixture& get_fixture()
+{
+    static StoreFixture fixture;
+    return fixture;
+}
+
+} // namespace
+
+/**
+ * @brief Single key reads, each in its own read transaction, from a growing number of threads.
+ * Beyond MAX_READERS threads the reader pool is exhausted and readers queue for a transaction
+ */
+void concurrent_point_reads_bench(State& state) noexcept
+{
+    StoreFixture& fixture = get_fixture();
+    ReaderPoolStats before;
+    if (state.thread_index() == 0) {
+        before = fixture.store->get_reader_pool_stats();
+    }
+    int64_t count = state.thread_index();
+    for (auto _ : state) {
+        KeysVector keys{ get_key(count++ % NUM_KEYS) };
+        OptionalValuesVector values;
+        fixture.store->get(keys, values, DB_NAME);
+        DoNotOptimize(values);
+    }
+    if (state.thread_index() == 0) {
+        ReaderPoolStats after = fixture.store->get_reader_pool_stats();
+        uint64_t acquisitions = after.acquisitions - before.acquisitions;
+        uint64_t exhausted = after.exhausted - before.exhausted;
+        state.counters["reused_pct"] =
+            acquisitions == 0 ? 0.0 : 100.0 * static_cast<double>(after.reused - before.reused) / acquisitions;
+        state.counters["exhausted_pct"] =
+            acquisitions == 0 ? 0.0 : 100.0 * static_cast<double>(exhausted) / acquisitions;
+        state.counters["avg_wait_ns"] =
+            exhausted == 0 ? 0.0 : static_cast<double>(after.totalWaitNs - before.totalWaitNs) / exhausted;
+        state.counters["open_readers"] = static_cast<double>(after.numOpen);
+    }
+}
+BENCHMARK(concurrent_point_reads_bench)->Unit(benchmark::kMicrosecond)->ThreadRange(1, 64)->UseRealTime();
+
+/**
+ * @brief Batched reads of 64 keys within one read transaction, the transaction cost is amortised over the batch
+ */
+void concurrent_batch_reads_bench(State& state) noexcept
+{
+    StoreFixture& fixture = get_fixture();
+    const int64_t batchSize = 64;
+    int64_t count = state.thread_index() * batchSize;
+    for (auto _ : state) {
+        KeysVector keys;
+        keys.reserve(batchSize);
+        for (int64_t i = 0; i < batchSize; i++) {
+            keys.emplace_back(get_key(count++ % NUM_KEYS));
+        }
+        OptionalValuesVector values;
+        fixture.store->get(keys, values, DB_NAME);
+        DoNotOptimize(values);
+    }
+}
+BENCHMARK(concurrent_batch_reads_bench)->Unit(benchmark::kMicrosecond)->ThreadRange(1, 64)->UseRealTime();
+
+BENCHMARK_MAIN();
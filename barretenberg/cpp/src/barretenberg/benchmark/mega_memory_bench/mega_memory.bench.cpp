@@ -1,9 +1,13 @@
 #include "barretenberg/benchmark/mega_memory_bench/memory_estimator.hpp"
+#include "barretenberg/srs/global_crs.hpp"
 #include "barretenberg/stdlib/primitives/field/field.hpp"
 #include "barretenberg/stdlib/primitives/plookup/plookup.hpp"
 #include "barretenberg/stdlib_circuit_builders/plookup_tables/fixed_base/fixed_base.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
+#include "barretenberg/sumcheck/sumcheck.hpp"
 #include "barretenberg/ultra_honk/decider_proving_key.hpp"
+#include "barretenberg/ultra_honk/oink_prover.hpp"
+#include "barretenberg/ultra_honk/ultra_prover.hpp"
 
 #include <benchmark/benchmark.h>
 
@@ -278,7 +282,7 @@ void fill_lookup_block(Builder& builder)
     }
 }
 
-void fill_trace(State& state, TraceSettings settings)
+Builder construct_filled_circuit(TraceSettings settings)
 {
     Builder builder;
     builder.blocks.set_fixed_block_sizes(settings);
@@ -306,12 +310,28 @@ void fill_trace(State& state, TraceSettings settings)
     }
 
     builder.finalize_circuit(/* ensure_nonzero */ true);
-    uint64_t builder_estimate = MegaMemoryEstimator::estimate_builder_memory(builder);
+    return builder;
+}
+
+/**
+ * @brief Estimated memory of the proving key polynomials and of the builder before and after the proving key is
+ * constructed. Their sum after construction is what stays resident while the circuit is proven.
+ */
+void fill_trace(State& state, TraceSettings settings)
+{
     for (auto _ : state) {
+        state.PauseTiming();
+        Builder builder = construct_filled_circuit(settings);
+        uint64_t builder_estimate = MegaMemoryEstimator::estimate_builder_memory(builder);
+        state.ResumeTiming();
+
         DeciderProvingKey proving_key(builder, settings);
         uint64_t memory_estimate = MegaMemoryEstimator::estimate_proving_key_memory(proving_key.proving_key);
+        uint64_t builder_estimate_after = MegaMemoryEstimator::estimate_builder_memory(builder);
         state.counters["poly_mem_est"] = static_cast<double>(memory_estimate);
         state.counters["builder_mem_est"] = static_cast<double>(builder_estimate);
+        state.counters["builder_mem_after_est"] = static_cast<double>(builder_estimate_after);
+        state.counters["resident_mem_est"] = static_cast<double>(memory_estimate + builder_estimate_after);
         benchmark::DoNotOptimize(proving_key);
     }
 }
@@ -321,6 +341,11 @@ void fill_trace_client_ivc_bench(State& state)
     fill_trace(state, { CLIENT_IVC_BENCH_STRUCTURE });
 }
 
+void fill_trace_client_ivc_bench_release(State& state)
+{
+    fill_trace(state, { .structure = CLIENT_IVC_BENCH_STRUCTURE, .release_builder_selectors = true });
+}
+
 void fill_trace_e2e_full_test(State& state)
 {
     fill_trace(state, { AZTEC_TRACE_STRUCTURE });
@@ -331,8 +356,50 @@ static void pk_mem(State& state, void (*test_circuit_function)(State&)) noexcept
     test_circuit_function(state);
 }
 
+/**
+ * @brief Memory held by the sumcheck book-keeping table after each round, with (lazy = 1) or without (lazy = 0)
+ * allocating it lazily to the nonzero range of each polynomial. The table is folded in place, so the first round is
+ * its peak.
+ */
+static void sumcheck_mem(State& state) noexcept
+{
+    const bool lazy_partial_evaluation = state.range(0) != 0;
+    bb::srs::init_crs_factory(bb::srs::get_ignition_crs_path());
+    const TraceSettings settings{ CLIENT_IVC_BENCH_STRUCTURE };
+
+    Builder builder = construct_filled_circuit(settings);
+    auto proving_key = std::make_shared<DeciderProvingKey>(builder, settings);
+    MegaProver prover(proving_key);
+    OinkProver<MegaFlavor> oink_prover(proving_key, prover.transcript);
+    oink_prover.prove();
+    prover.generate_gate_challenges();
+
+    std::vector<size_t> round_table_bytes;
+    for (auto _ : state) {
+        SumcheckProver<MegaFlavor> sumcheck(proving_key->proving_key.circuit_size, prover.transcript);
+        sumcheck.lazy_partial_evaluation = lazy_partial_evaluation;
+        benchmark::DoNotOptimize(sumcheck.prove(proving_key->proving_key.polynomials,
+                                                proving_key->relation_parameters,
+                                                proving_key->alphas,
+                                                proving_key->gate_challenges));
+        round_table_bytes = sumcheck.round_table_bytes;
+    }
+    state.counters["poly_mem_est"] =
+        static_cast<double>(MegaMemoryEstimator::estimate_proving_key_memory(proving_key->proving_key));
+    for (size_t round_idx = 0; round_idx < round_table_bytes.size(); round_idx++) {
+        state.counters["round_" + std::to_string(round_idx) + "_table_mem"] =
+            static_cast<double>(round_table_bytes[round_idx]);
+    }
+}
+
 BENCHMARK_CAPTURE(pk_mem, E2E_FULL_TEST, &fill_trace_e2e_full_test)->Unit(kMillisecond)->Iterations(1);
 
 BENCHMARK_CAPTURE(pk_mem, CLIENT_IVC_BENCH, &fill_trace_client_ivc_bench)->Unit(kMillisecond)->Iterations(1);
 
+BENCHMARK_CAPTURE(pk_mem, CLIENT_IVC_BENCH_RELEASE, &fill_trace_client_ivc_bench_release)
+    ->Unit(kMillisecond)
+    ->Iterations(1);
+
+BENCHMARK(sumcheck_mem)->Arg(0)->Arg(1)->ArgName("lazy")->Unit(kMillisecond)->Iterations(1);
+
 BENCHMARK_MAIN();
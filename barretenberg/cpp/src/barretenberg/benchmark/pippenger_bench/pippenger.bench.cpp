@@ -0,0 +1,76 @@
+/**
+ * @file pippenger.bench.cpp
+ * @brief Benchmarks of the Pippenger multi-scalar multiplication, comparing the bucket accumulation strategies.
+ *
+ * @details Set BB_MSM_BUCKET_ACCUMULATION=batched_affine to switch the default strategy used by the rest of the
+ * prover; here both strategies are selected explicitly through the runtime state.
+ */
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include "barretenberg/srs/global_crs.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+using namespace bb;
+
+namespace {
+
+constexpr size_t MIN_LOG_NUM_POINTS = 16;
+constexpr size_t MAX_LOG_NUM_POINTS = 24;
+
+template <typename Curve>
+void pippenger(State& state, scalar_multiplication::BucketAccumulation bucket_accumulation) noexcept
+{
+    using Fr = typename Curve::ScalarField;
+
+    if constexpr (std::same_as<Curve, curve::BN254>) {
+        srs::init_crs_factory(srs::get_ignition_crs_path());
+    } else {
+        srs::init_grumpkin_crs_factory(srs::get_grumpkin_crs_path());
+    }
+
+    const size_t num_points = 1UL << static_cast<size_t>(state.range(0));
+    auto crs = srs::get_crs_factory<Curve>()->get_prover_crs(num_points);
+    // The monomial points are already the Pippenger point table (points followed by their endomorphisms).
+    std::span<const typename Curve::AffineElement> points = crs->get_monomial_points();
+
+    numeric::RNG& engine = numeric::get_debug_randomness();
+    std::vector<Fr> scalars(num_points);
+    for (auto& scalar : scalars) {
+        scalar = Fr::random_element(&engine);
+    }
+
+    scalar_multiplication::pippenger_runtime_state<Curve> runtime_state(num_points);
+    runtime_state.bucket_accumulation = bucket_accumulation;
+    for (auto _ : state) {
+        DoNotOptimize(scalar_multiplication::pippenger_unsafe<Curve>({ 0, scalars }, points, runtime_state));
+    }
+}
+
+void pippenger_bn254_addition_chains(State& state) noexcept
+{
+    pippenger<curve::BN254>(state, scalar_multiplication::BucketAccumulation::AdditionChains);
+}
+void pippenger_bn254_batched_affine(State& state) noexcept
+{
+    pippenger<curve::BN254>(state, scalar_multiplication::BucketAccumulation::BatchedAffine);
+}
+void pippenger_grumpkin_addition_chains(State& state) noexcept
+{
+    pippenger<curve::Grumpkin>(state, scalar_multiplication::BucketAccumulation::AdditionChains);
+}
+void pippenger_grumpkin_batched_affine(State& state) noexcept
+{
+    pippenger<curve::Grumpkin>(state, scalar_multiplication::BucketAccumulation::BatchedAffine);
+}
+
+} // namespace
+
+BENCHMARK(pippenger_bn254_addition_chains)->DenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS)->Unit(kMillisecond);
+BENCHMARK(pippenger_bn254_batched_affine)->DenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS)->Unit(kMillisecond);
+BENCHMARK(pippenger_grumpkin_addition_chains)->DenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS)->Unit(kMillisecond);
+BENCHMARK(pippenger_grumpkin_batched_affine)->DenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS)->Unit(kMillisecond);
+
+BENCHMARK_MAIN();
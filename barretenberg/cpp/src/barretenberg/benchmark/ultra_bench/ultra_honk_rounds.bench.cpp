@@ -73,6 +73,44 @@ BB_PROFILE static void test_round(State& state, size_t index) noexcept
         // NOTE: google bench is very finnicky, must end in ResumeTiming() for correctness
     }
 }
+/**
+ * @details Benchmark the relation check (sumcheck) with and without fusing the partial evaluation of each round with the
+ * computation of the next round univariate. range(1) selects separate passes (0) or fused rounds (1). The estimated
+ * bytes of prover polynomials streamed through memory are reported per round, in MiB.
+ * @param state - The google benchmark state.
+ **/
+BB_PROFILE static void SUMCHECK_FUSED_ROUNDS(State& state) noexcept
+{
+    auto log2_num_gates = static_cast<size_t>(state.range(0));
+    const bool fuse_rounds = state.range(1) != 0;
+    bb::srs::init_crs_factory(bb::srs::get_ignition_crs_path());
+
+    auto prover = bb::mock_circuits::get_prover<MegaProver>(
+        &bb::mock_circuits::generate_basic_arithmetic_circuit<MegaCircuitBuilder>, log2_num_gates);
+    OinkProver<MegaFlavor> oink_prover(prover.proving_key, prover.transcript);
+    oink_prover.prove();
+    prover.generate_gate_challenges();
+
+    auto& proving_key = prover.proving_key;
+    std::vector<size_t> round_bytes_moved;
+    for (auto _ : state) {
+        SumcheckProver<MegaFlavor> sumcheck(proving_key->proving_key.circuit_size, prover.transcript);
+        sumcheck.fuse_rounds = fuse_rounds;
+        benchmark::DoNotOptimize(sumcheck.prove(proving_key->proving_key.polynomials,
+                                                proving_key->relation_parameters,
+                                                proving_key->alphas,
+                                                proving_key->gate_challenges));
+        round_bytes_moved = sumcheck.round_bytes_moved;
+    }
+    size_t total_bytes_moved = 0;
+    for (size_t round_idx = 0; round_idx < round_bytes_moved.size(); round_idx++) {
+        state.counters["round_" + std::to_string(round_idx) + "_MiB"] =
+            static_cast<double>(round_bytes_moved[round_idx]) / (1 << 20);
+        total_bytes_moved += round_bytes_moved[round_idx];
+    }
+    state.counters["total_MiB"] = static_cast<double>(total_bytes_moved) / (1 << 20);
+}
+
 #define ROUND_BENCHMARK(round)                                                                                         \
     static void ROUND_##round(State& state) noexcept                                                                   \
     {                                                                                                                  \
@@ -89,5 +127,9 @@ ROUND_BENCHMARK(LOG_DERIVATIVE_INVERSE)->Iterations(1);
 ROUND_BENCHMARK(GRAND_PRODUCT_COMPUTATION)->Iterations(1);
 ROUND_BENCHMARK(GENERATE_ALPHAS)->Iterations(1);
 ROUND_BENCHMARK(RELATION_CHECK);
+BENCHMARK(SUMCHECK_FUSED_ROUNDS)
+    ->ArgsProduct({ benchmark::CreateDenseRange(12, 19, 1), { 0, 1 } })
+    ->ArgNames({ "log2_num_gates", "fused" })
+    ->Unit(kMillisecond);
 
 BENCHMARK_MAIN();
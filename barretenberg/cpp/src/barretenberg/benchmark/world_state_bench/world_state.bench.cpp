@@ -0,0 +1,112 @@
+#include "barretenberg/world_state/world_state.hpp"
+#include "barretenberg/crypto/merkle_tree/fixtures.hpp"
+#include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
+#include "barretenberg/world_state/types.hpp"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace benchmark;
+using namespace bb::world_state;
+using namespace bb::crypto::merkle_tree;
+
+namespace {
+
+const uint64_t MAP_SIZE = 1024 * 1024;
+const uint64_t THREAD_POOL_SIZE = 16;
+const uint32_t INITIAL_HEADER_GENERATOR_POINT = 28;
+const index_t NUM_PREFILLED_LEAVES = 1024;
+
+const std::unordered_map<MerkleTreeId, uint32_t> TREE_HEIGHTS{
+    { MerkleTreeId::NULLIFIER_TREE, 40 },   { MerkleTreeId::NOTE_HASH_TREE, 40 },
+    { MerkleTreeId::PUBLIC_DATA_TREE, 40 }, { MerkleTreeId::L1_TO_L2_MESSAGE_TREE, 39 },
+    { MerkleTreeId::ARCHIVE, 29 },
+};
+
+const std::unordered_map<MerkleTreeId, index_t> TREE_PREFILL{
+    { MerkleTreeId::NULLIFIER_TREE, NUM_PREFILLED_LEAVES },
+    { MerkleTreeId::PUBLIC_DATA_TREE, NUM_PREFILLED_LEAVES },
+};
+
+struct WorldStateFixture {
+    std::string directory;
+    std::unique_ptr<WorldState> ws;
+
+    WorldStateFixture()
+        : directory(random_temp_directory())
+    {
+        std::filesystem::create_directories(directory);
+        ws = std::make_unique<WorldState>(
+            THREAD_POOL_SIZE, directory, MAP_SIZE, TREE_HEIGHTS, TREE_PREFILL, INITIAL_HEADER_GENERATOR_POINT);
+    }
+
+    ~WorldStateFixture()
+    {
+        ws.reset();
+        std::filesystem::remove_all(directory);
+    }
+};
+
+} // namespace
+
+/**
+ * @brief Creates and immediately deletes forks of the latest block, as done for each simulation or proposal
+ */
+void fork_create_delete_bench(State& state) noexcept
+{
+    WorldStateFixture fixture;
+    for (auto _ : state) {
+        uint64_t fork_id = fixture.ws->create_fork(std::nullopt);
+        fixture.ws->delete_fork(fork_id);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(fork_create_delete_bench)->Unit(benchmark::kMicrosecond);
+
+/**
+ * @brief Creates a fork, reads a number of leaves and sibling paths from it and deletes it
+ */
+void fork_create_read_delete_bench(State& state) noexcept
+{
+    const auto num_reads = static_cast<index_t>(state.range(0));
+    WorldStateFixture fixture;
+    for (auto _ : state) {
+        uint64_t fork_id = fixture.ws->create_fork(std::nullopt);
+        WorldStateRevision revision{ .forkId = fork_id, .includeUncommitted = true };
+        for (index_t i = 0; i < num_reads; i++) {
+            index_t leaf_index = (i * 7919) % NUM_PREFILLED_LEAVES;
+            DoNotOptimize(
+                fixture.ws->get_indexed_leaf<NullifierLeafValue>(revision, MerkleTreeId::NULLIFIER_TREE, leaf_index));
+            DoNotOptimize(fixture.ws->get_sibling_path(revision, MerkleTreeId::PUBLIC_DATA_TREE, leaf_index));
+        }
+        fixture.ws->delete_fork(fork_id);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(fork_create_read_delete_bench)->Unit(benchmark::kMicrosecond)->RangeMultiplier(8)->Range(1, 512);
+
+/**
+ * @brief Creates a number of concurrently live forks of the same block before deleting them all
+ */
+void many_forks_bench(State& state) noexcept
+{
+    const auto num_forks = static_cast<size_t>(state.range(0));
+    WorldStateFixture fixture;
+    std::vector<uint64_t> fork_ids(num_forks);
+    for (auto _ : state) {
+        for (size_t i = 0; i < num_forks; i++) {
+            fork_ids[i] = fixture.ws->create_fork(std::nullopt);
+        }
+        for (size_t i = 0; i < num_forks; i++) {
+            fixture.ws->delete_fork(fork_ids[i]);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * num_forks));
+}
+BENCHMARK(many_forks_bench)->Unit(benchmark::kMillisecond)->RangeMultiplier(4)->Range(16, 1024);
+
+BENCHMARK_MAIN();
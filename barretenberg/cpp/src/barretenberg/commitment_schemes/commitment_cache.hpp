@@ -0,0 +1,375 @@
+#pragma once
+
+/**
+ * @brief Content-addressed cache of commitments to fixed polynomials.
+ *
+ */
+
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/op_count.hpp"
+#include "barretenberg/crypto/blake3s_full/blake3s.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <unordered_map>
+
+namespace bb {
+
+/**
+ * @brief Cache of commitments keyed by a hash of the committed polynomial.
+ *
+ * @details Precomputed polynomials (selectors, sigmas, ids, tables, lagrange polynomials...) are identical every time
+ * a verification key is built for the same circuit, e.g. for the repeated kernel circuits of ClientIVC or for the
+ * precomputed columns of the AVM. Instead of recomputing their commitment with a full MSM each time, the polynomial is
+ * hashed and the commitment is looked up in
+ *  1. an in-memory LRU map of bounded capacity (see set_memory_capacity()), shared by all commitment keys of the same
+ *     curve in the process, and then
+ *  2. an optional on-disk directory (one small file per commitment), enabled with the BB_COMMITMENT_CACHE_DIR
+ *     environment variable or with set_disk_directory().
+ *
+ * The key is a blake3 hash of a fingerprint of the SRS the commitment is computed over (see srs_fingerprint()), and of
+ * the (Montgomery form) coefficients, the start index and the size of the polynomial. The curve name is part of the
+ * on-disk path.
+ *
+ * Each entry remembers how long its MSM took, which is reported as saved time on every hit. With BB_USE_OP_COUNT,
+ * "commitment_cache::hit" counts hits and accumulates the saved MSM time, and "commitment_cache::miss" counts misses
+ * and accumulates the MSM time actually spent.
+ *
+ * The cache is disabled by default, in which case commit_fixed() commits directly without hashing anything: in a
+ * process that builds each verification key once, every lookup would be a miss. It is enabled when
+ * BB_COMMITMENT_CACHE_DIR is set, since the on-disk tier carries the commitments over to later processes, or with
+ * set_enabled() in processes that build the same verification keys repeatedly.
+ *
+ * @note Only use the cache for polynomials that are expected to repeat: hashing a polynomial is much cheaper than
+ * committing to it, but it is wasted work for witness polynomials.
+ */
+template <class Curve> class CommitmentCache {
+    using Fr = typename Curve::ScalarField;
+    using Commitment = typename Curve::AffineElement;
+
+    // Number of leading SRS points that identify an SRS
+    static constexpr size_t SRS_FINGERPRINT_NUM_POINTS = 16;
+
+  public:
+    using Key = std::array<uint8_t, blake3_full::BLAKE3_OUT_LEN>;
+
+    // Default number of commitments held by the in-memory tier, a few MiB worth of entries
+    static constexpr size_t DEFAULT_MEMORY_CAPACITY = 1 << 14;
+
+    struct Stats {
+        size_t hits = 0;
+        size_t disk_hits = 0;
+        size_t misses = 0;
+        // Accumulated duration of the MSMs that the hits avoided, and of the MSMs computed on misses.
+        std::chrono::nanoseconds saved_msm_time{ 0 };
+        std::chrono::nanoseconds msm_time{ 0 };
+
+        double hit_rate() const
+        {
+            const size_t total = hits + misses;
+            return total == 0 ? 0 : static_cast<double>(hits) / static_cast<double>(total);
+        }
+    };
+
+    // The cache shared by all commitment keys over this curve.
+    static CommitmentCache& get()
+    {
+        static CommitmentCache cache;
+        return cache;
+    }
+
+    void set_enabled(bool enabled_) { enabled = enabled_; }
+    bool is_enabled() const { return enabled; }
+
+    // Bounds the number of entries of the in-memory tier, evicting the least recently used ones. 0 disables the tier.
+    void set_memory_capacity(size_t capacity)
+    {
+        std::unique_lock lock(mutex);
+        memory_capacity = capacity;
+        evict();
+    }
+    size_t memory_size() const
+    {
+        std::unique_lock lock(mutex);
+        return memory.size();
+    }
+
+    // An empty path disables the on-disk tier.
+    void set_disk_directory(const std::filesystem::path& directory)
+    {
+        std::unique_lock lock(mutex);
+        disk_directory = directory.empty() ? directory : directory / Curve::name;
+    }
+
+    /**
+     * @brief Identifies an SRS by its leading points
+     * @details Any two SRSs in use differ in their first few points (for BN254 the second point is [x]₁), and the
+     * commitment to a polynomial does not depend on the size of the SRS as long as it covers the polynomial, so the
+     * size is deliberately left out.
+     *
+     * @param monomial_points The SRS points as returned by ProverCrs::get_monomial_points()
+     */
+    static Key srs_fingerprint(std::span<const Commitment> monomial_points)
+    {
+        const size_t num_points = std::min(monomial_points.size(), SRS_FINGERPRINT_NUM_POINTS);
+        blake3_full::blake3_hasher hasher;
+        blake3_full::blake3_hasher_init(&hasher);
+        blake3_full::blake3_hasher_update(&hasher, monomial_points.data(), num_points * sizeof(Commitment));
+        Key key;
+        blake3_full::blake3_hasher_finalize(&hasher, key.data(), sizeof(Key));
+        return key;
+    }
+
+    /**
+     * @brief Computes the cache key of the commitment to a polynomial over the SRS with the given fingerprint
+     * @details The polynomial is hashed on the calling thread: commit_fixed() can be reached from within a parallel
+     * region, in which parallel_for must not be used.
+     */
+    static Key hash(const Key& srs_fingerprint, PolynomialSpan<const Fr> polynomial)
+    {
+        PROFILE_THIS_NAME("commitment_cache::hash");
+        const auto start_index = static_cast<uint64_t>(polynomial.start_index);
+        const auto poly_size = static_cast<uint64_t>(polynomial.size());
+        blake3_full::blake3_hasher hasher;
+        blake3_full::blake3_hasher_init(&hasher);
+        blake3_full::blake3_hasher_update(&hasher, srs_fingerprint.data(), srs_fingerprint.size());
+        blake3_full::blake3_hasher_update(&hasher, &start_index, sizeof(start_index));
+        blake3_full::blake3_hasher_update(&hasher, &poly_size, sizeof(poly_size));
+        blake3_full::blake3_hasher_update(&hasher, polynomial.span.data(), polynomial.size() * sizeof(Fr));
+        Key key;
+        blake3_full::blake3_hasher_finalize(&hasher, key.data(), sizeof(Key));
+        return key;
+    }
+
+    /**
+     * @brief Returns the cached commitment to the polynomial, or computes it with compute_commitment() and caches it.
+     *
+     * @param srs_fingerprint The srs_fingerprint() of the SRS compute_commitment() commits over
+     */
+    template <typename ComputeCommitment>
+    Commitment get_or_compute(const Key& srs_fingerprint,
+                              PolynomialSpan<const Fr> polynomial,
+                              ComputeCommitment&& compute_commitment)
+    {
+        if (!enabled) {
+            return compute_commitment();
+        }
+
+        const Key key = hash(srs_fingerprint, polynomial);
+        if (auto entry = lookup(key); entry.has_value()) {
+            BB_OP_COUNT_TRACK_NAME("commitment_cache::hit");
+            BB_OP_COUNT_ADD_TIME_NAME("commitment_cache::hit", static_cast<size_t>(entry->msm_time.count()));
+            hits++;
+            saved_msm_time_ns += static_cast<size_t>(entry->msm_time.count());
+            return entry->commitment;
+        }
+
+        Entry entry;
+        {
+            BB_OP_COUNT_TIME_NAME("commitment_cache::miss");
+            const auto start = std::chrono::steady_clock::now();
+            entry.commitment = compute_commitment();
+            entry.msm_time =
+                std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+        }
+        misses++;
+        msm_time_ns += static_cast<size_t>(entry.msm_time.count());
+        insert(key, entry);
+        return entry.commitment;
+    }
+
+    Stats get_stats() const
+    {
+        return Stats{ .hits = hits,
+                      .disk_hits = disk_hits,
+                      .misses = misses,
+                      .saved_msm_time = std::chrono::nanoseconds(saved_msm_time_ns.load()),
+                      .msm_time = std::chrono::nanoseconds(msm_time_ns.load()) };
+    }
+
+    void print_stats() const
+    {
+        const auto stats = get_stats();
+        info(Curve::name,
+             " commitment cache: ",
+             stats.hits,
+             " hits (",
+             stats.disk_hits,
+             " from disk), ",
+             stats.misses,
+             " misses, hit rate ",
+             stats.hit_rate(),
+             ", saved ",
+             std::chrono::duration_cast<std::chrono::milliseconds>(stats.saved_msm_time).count(),
+             "ms of MSM");
+    }
+
+    // Clears the in-memory tier and the stats. The on-disk tier is left untouched.
+    void clear()
+    {
+        std::unique_lock lock(mutex);
+        memory.clear();
+        lru.clear();
+        hits = 0;
+        disk_hits = 0;
+        misses = 0;
+        saved_msm_time_ns = 0;
+        msm_time_ns = 0;
+    }
+
+  private:
+    struct Entry {
+        Commitment commitment;
+        std::chrono::nanoseconds msm_time{ 0 };
+    };
+    struct MemoryEntry {
+        Entry entry;
+        // Position of the key in the recency list
+        typename std::list<Key>::iterator lru_position;
+    };
+    struct KeyHash {
+        size_t operator()(const Key& key) const
+        {
+            size_t result = 0;
+            std::memcpy(&result, key.data(), sizeof(result));
+            return result;
+        }
+    };
+
+    CommitmentCache()
+    {
+        if (const char* directory = std::getenv("BB_COMMITMENT_CACHE_DIR"); directory != nullptr) {
+            set_disk_directory(directory);
+            enabled = true;
+        }
+    }
+
+    static std::string to_hex(const Key& key)
+    {
+        static constexpr std::array<char, 16> HEX = { '0', '1', '2', '3', '4', '5', '6', '7',
+                                                      '8', '9', 'a', 'b', 'c', 'd', 'e', 'f' };
+        std::string result;
+        result.reserve(2 * key.size());
+        for (uint8_t byte : key) {
+            result.push_back(HEX[byte >> 4]);
+            result.push_back(HEX[byte & 0xf]);
+        }
+        return result;
+    }
+
+    std::optional<Entry> lookup(const Key& key)
+    {
+        std::filesystem::path directory;
+        {
+            std::unique_lock lock(mutex);
+            if (auto it = memory.find(key); it != memory.end()) {
+                lru.splice(lru.begin(), lru, it->second.lru_position);
+                return it->second.entry;
+            }
+            directory = disk_directory;
+        }
+        if (directory.empty()) {
+            return std::nullopt;
+        }
+
+        // The on-disk format is a local cache: raw bytes in native endianness.
+        std::ifstream file(directory / to_hex(key), std::ios::binary);
+        Entry entry;
+        int64_t msm_time_ns = 0;
+        file.read(reinterpret_cast<char*>(&entry.commitment), sizeof(entry.commitment));
+        file.read(reinterpret_cast<char*>(&msm_time_ns), sizeof(msm_time_ns));
+        if (!file || !entry.commitment.on_curve()) {
+            return std::nullopt;
+        }
+        entry.msm_time = std::chrono::nanoseconds(msm_time_ns);
+        disk_hits++;
+        std::unique_lock lock(mutex);
+        insert_in_memory(key, entry);
+        return entry;
+    }
+
+    void insert(const Key& key, const Entry& entry)
+    {
+        std::filesystem::path directory;
+        {
+            std::unique_lock lock(mutex);
+            insert_in_memory(key, entry);
+            directory = disk_directory;
+        }
+        if (directory.empty()) {
+            return;
+        }
+
+        // Failing to persist an entry is not an error, it only costs an MSM later on.
+        std::error_code error;
+        std::filesystem::create_directories(directory, error);
+        const auto path = directory / to_hex(key);
+        // Write to a temporary file and rename it, so that concurrent processes never read a partial entry.
+        const auto tmp_path = std::filesystem::path(
+            path.string() + ".tmp" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) +
+            "." + std::to_string(tmp_counter++));
+        {
+            std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+            const int64_t msm_time_ns = entry.msm_time.count();
+            file.write(reinterpret_cast<const char*>(&entry.commitment), sizeof(entry.commitment));
+            file.write(reinterpret_cast<const char*>(&msm_time_ns), sizeof(msm_time_ns));
+            if (!file) {
+                vinfo("Could not write commitment cache entry ", tmp_path);
+                return;
+            }
+        }
+        std::filesystem::rename(tmp_path, path, error);
+    }
+
+    // Must be called with the mutex held
+    void insert_in_memory(const Key& key, const Entry& entry)
+    {
+        if (memory.contains(key)) {
+            return;
+        }
+        lru.push_front(key);
+        memory.emplace(key, MemoryEntry{ .entry = entry, .lru_position = lru.begin() });
+        evict();
+    }
+
+    // Must be called with the mutex held
+    void evict()
+    {
+        while (memory.size() > memory_capacity) {
+            memory.erase(lru.back());
+            lru.pop_back();
+        }
+    }
+
+    static_assert(std::is_trivially_copyable_v<Commitment>);
+
+    std::atomic<bool> enabled = false;
+    mutable std::mutex mutex;
+    std::unordered_map<Key, MemoryEntry, KeyHash> memory;
+    // Keys of the in-memory tier, most recently used first
+    std::list<Key> lru;
+    size_t memory_capacity = DEFAULT_MEMORY_CAPACITY;
+    std::filesystem::path disk_directory;
+
+    std::atomic<size_t> hits = 0;
+    std::atomic<size_t> disk_hits = 0;
+    std::atomic<size_t> misses = 0;
+    std::atomic<size_t> saved_msm_time_ns = 0;
+    std::atomic<size_t> msm_time_ns = 0;
+    std::atomic<size_t> tmp_counter = 0;
+};
+
+} // namespace bb
@@ -0,0 +1,175 @@
+#include "barretenberg/commitment_schemes/commitment_cache.hpp"
+#include "barretenberg/commitment_schemes/commitment_key.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
+#include "barretenberg/srs/factories/file_crs_factory.hpp"
+
+#include <filesystem>
+#include <gtest/gtest.h>
+
+namespace bb {
+
+template <typename Curve> class CommitmentCacheTest : public ::testing::Test {
+  public:
+    using Fr = typename Curve::ScalarField;
+    using Commitment = typename Curve::AffineElement;
+    using CK = CommitmentKey<Curve>;
+    using Cache = CommitmentCache<Curve>;
+    using Polynomial = bb::Polynomial<Fr>;
+
+    static constexpr size_t NUM_POINTS = 1 << 10;
+
+    static void SetUpTestSuite()
+    {
+        srs::init_crs_factory(bb::srs::get_ignition_crs_path());
+        srs::init_grumpkin_crs_factory(bb::srs::get_grumpkin_crs_path());
+    }
+
+    void SetUp() override
+    {
+        Cache::get().clear();
+        Cache::get().set_disk_directory({});
+        Cache::get().set_memory_capacity(Cache::DEFAULT_MEMORY_CAPACITY);
+        Cache::get().set_enabled(true);
+    }
+
+    static Polynomial random_polynomial(size_t size, size_t start_index = 0)
+    {
+        Polynomial poly(size, NUM_POINTS, start_index);
+        for (size_t i = start_index; i < start_index + size; ++i) {
+            poly.at(i) = Fr::random_element();
+        }
+        return poly;
+    }
+};
+
+using Curves = ::testing::Types<curve::BN254, curve::Grumpkin>;
+
+TYPED_TEST_SUITE(CommitmentCacheTest, Curves);
+
+TYPED_TEST(CommitmentCacheTest, HitReturnsSameCommitment)
+{
+    using Cache = typename TestFixture::Cache;
+    auto key = std::make_shared<typename TestFixture::CK>(TestFixture::NUM_POINTS);
+    auto poly = TestFixture::random_polynomial(500);
+
+    auto expected = key->commit(poly);
+    EXPECT_EQ(key->commit_fixed(poly), expected);
+    EXPECT_EQ(key->commit_fixed(poly), expected);
+
+    auto stats = Cache::get().get_stats();
+    EXPECT_EQ(stats.misses, 1);
+    EXPECT_EQ(stats.hits, 1);
+    EXPECT_EQ(stats.hit_rate(), 0.5);
+}
+
+// Without the cache, commit_fixed() commits directly and neither hashes nor stores anything
+TYPED_TEST(CommitmentCacheTest, DisabledCacheCommitsDirectly)
+{
+    using Cache = typename TestFixture::Cache;
+    auto key = std::make_shared<typename TestFixture::CK>(TestFixture::NUM_POINTS);
+    auto poly = TestFixture::random_polynomial(500);
+
+    Cache::get().set_enabled(false);
+    EXPECT_EQ(key->commit_fixed(poly), key->commit(poly));
+    EXPECT_EQ(key->commit_fixed(poly), key->commit(poly));
+
+    auto stats = Cache::get().get_stats();
+    EXPECT_EQ(stats.misses, 0);
+    EXPECT_EQ(stats.hits, 0);
+    EXPECT_EQ(Cache::get().memory_size(), 0);
+}
+
+TYPED_TEST(CommitmentCacheTest, KeyDependsOnContentAndShape)
+{
+    using Cache = typename TestFixture::Cache;
+    using Fr = typename TestFixture::Fr;
+    auto key = std::make_shared<typename TestFixture::CK>(TestFixture::NUM_POINTS);
+    const auto srs = Cache::srs_fingerprint(key->srs->get_monomial_points());
+    auto poly = TestFixture::random_polynomial(100, 10);
+
+    typename TestFixture::Polynomial modified(poly);
+    modified.at(50) += Fr::one();
+    EXPECT_NE(Cache::hash(srs, poly), Cache::hash(srs, modified));
+
+    // Same coefficients, different start index.
+    typename TestFixture::Polynomial shifted(100, TestFixture::NUM_POINTS, 11);
+    for (size_t i = 0; i < 100; ++i) {
+        shifted.at(11 + i) = poly[10 + i];
+    }
+    EXPECT_NE(Cache::hash(srs, poly), Cache::hash(srs, shifted));
+    typename TestFixture::Polynomial copy(poly);
+    EXPECT_EQ(Cache::hash(srs, poly), Cache::hash(srs, copy));
+}
+
+// Commitments over different SRSs (e.g. loaded from different files) must not share a key
+TYPED_TEST(CommitmentCacheTest, KeyDependsOnSrs)
+{
+    using Cache = typename TestFixture::Cache;
+    using Commitment = typename TestFixture::Commitment;
+    auto key = std::make_shared<typename TestFixture::CK>(TestFixture::NUM_POINTS);
+    auto poly = TestFixture::random_polynomial(300);
+
+    const auto points = key->srs->get_monomial_points();
+    std::vector<Commitment> other_points(points.begin(), points.end());
+    // The second point of the SRS (the first being the generator for BN254), interleaved with its endomorphism point
+    other_points[2] = Commitment::random_element();
+
+    const auto srs = Cache::srs_fingerprint(points);
+    const auto other_srs = Cache::srs_fingerprint(other_points);
+    EXPECT_NE(srs, other_srs);
+    EXPECT_NE(Cache::hash(srs, poly), Cache::hash(other_srs, poly));
+    EXPECT_EQ(Cache::srs_fingerprint(std::vector<Commitment>(points.begin(), points.end())), srs);
+}
+
+TYPED_TEST(CommitmentCacheTest, MemoryTierIsBounded)
+{
+    using Cache = typename TestFixture::Cache;
+    auto key = std::make_shared<typename TestFixture::CK>(TestFixture::NUM_POINTS);
+    std::array polys = { TestFixture::random_polynomial(50),
+                         TestFixture::random_polynomial(60),
+                         TestFixture::random_polynomial(70) };
+
+    Cache::get().set_memory_capacity(2);
+    key->commit_fixed(polys[0]);
+    key->commit_fixed(polys[1]);
+    // Touch the first polynomial so that the second one is the least recently used when the third is inserted
+    key->commit_fixed(polys[0]);
+    key->commit_fixed(polys[2]);
+    EXPECT_EQ(Cache::get().memory_size(), 2);
+
+    key->commit_fixed(polys[0]);
+    EXPECT_EQ(key->commit_fixed(polys[1]), key->commit(polys[1]));
+    auto stats = Cache::get().get_stats();
+    EXPECT_EQ(stats.hits, 2);
+    EXPECT_EQ(stats.misses, 4);
+
+    Cache::get().set_memory_capacity(0);
+    EXPECT_EQ(Cache::get().memory_size(), 0);
+}
+
+TYPED_TEST(CommitmentCacheTest, DiskTier)
+{
+    using Cache = typename TestFixture::Cache;
+    const auto directory = std::filesystem::temp_directory_path() / "bb_commitment_cache_test";
+    std::filesystem::remove_all(directory);
+
+    auto key = std::make_shared<typename TestFixture::CK>(TestFixture::NUM_POINTS);
+    auto poly = TestFixture::random_polynomial(700);
+    auto expected = key->commit(poly);
+
+    Cache::get().set_disk_directory(directory);
+    EXPECT_EQ(key->commit_fixed(poly), expected);
+    // Drop the in-memory tier, the entry must come back from disk.
+    Cache::get().clear();
+    EXPECT_EQ(key->commit_fixed(poly), expected);
+
+    auto stats = Cache::get().get_stats();
+    EXPECT_EQ(stats.misses, 0);
+    EXPECT_EQ(stats.hits, 1);
+    EXPECT_EQ(stats.disk_hits, 1);
+
+    Cache::get().set_disk_directory({});
+    std::filesystem::remove_all(directory);
+}
+
+} // namespace bb
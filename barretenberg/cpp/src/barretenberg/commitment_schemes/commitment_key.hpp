@@ -13,8 +13,10 @@
  * simplify the codebase.
  */
 
+#include "barretenberg/commitment_schemes/commitment_cache.hpp"
 #include "barretenberg/common/debug_log.hpp"
 #include "barretenberg/common/op_count.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/batched_affine_addition/batched_affine_addition.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
@@ -27,6 +29,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <span>
 #include <string_view>
 
 namespace bb {
@@ -45,6 +48,8 @@ template <class Curve> class CommitmentKey {
     using Commitment = typename Curve::AffineElement;
     using G1 = typename Curve::AffineElement;
     static constexpr size_t EXTRA_SRS_POINTS_FOR_ECCVM_IPA = 1;
+    // Below this many coefficients per thread, a single-threaded MSM beats spreading it over all threads
+    static constexpr size_t SINGLE_THREADED_COMMIT_SIZE_PER_THREAD = 32;
 
     static size_t get_num_needed_srs_points(size_t num_points)
     {
@@ -130,6 +135,69 @@ template <class Curve> class CommitmentKey {
         return point;
     };
 
+    /**
+     * @brief Commit to several polynomials, computing the small MSMs concurrently
+     * @details pippenger spreads every MSM over all threads, which leaves most of them idle on small inputs such as the
+     * last Gemini folds. Polynomials with at most SINGLE_THREADED_COMMIT_SIZE_PER_THREAD coefficients per thread are
+     * therefore committed each on a single thread, all of them in one parallel_for; the others go through commit().
+     *
+     * @param polynomials univariate polynomials pᵢ(X)
+     * @return Commitments [pᵢ(x)], in the order of the inputs
+     */
+    std::vector<Commitment> batch_commit(std::span<const PolynomialSpan<const Fr>> polynomials)
+    {
+        PROFILE_THIS_NAME("batch_commit");
+        std::vector<Commitment> commitments(polynomials.size());
+        const size_t single_threaded_size = get_num_cpus() * SINGLE_THREADED_COMMIT_SIZE_PER_THREAD;
+        std::vector<size_t> single_threaded_indices;
+        size_t consumed_srs = 1;
+        for (size_t i = 0; i < polynomials.size(); ++i) {
+            if (polynomials[i].size() <= single_threaded_size) {
+                consumed_srs = std::max(consumed_srs, polynomials[i].end_index());
+                single_threaded_indices.push_back(i);
+            } else {
+                commitments[i] = commit(polynomials[i]);
+            }
+        }
+        if (single_threaded_indices.empty()) {
+            return commitments;
+        }
+
+        // Same points as commit(), from the prover CRS of the global factory
+        auto commit_srs = srs::get_crs_factory<Curve>()->get_prover_crs(consumed_srs);
+        if (consumed_srs > commit_srs->get_monomial_size()) {
+            throw_or_abort(format("Attempting to commit to a polynomial that needs ",
+                                  consumed_srs,
+                                  " points with an SRS of size ",
+                                  commit_srs->get_monomial_size()));
+        }
+        std::span<const G1> point_table = commit_srs->get_monomial_points();
+        parallel_for(single_threaded_indices.size(), [&](size_t j) {
+            const size_t i = single_threaded_indices[j];
+            commitments[i] = scalar_multiplication::pippenger_single_threaded<Curve>(polynomials[i], point_table);
+        });
+        return commitments;
+    }
+
+    /**
+     * @brief Commit to a polynomial that is expected to be the same across proofs (e.g. a selector), looking it up in
+     * the commitment cache before running pippenger.
+     * @see CommitmentCache
+     *
+     * @param polynomial a univariate polynomial p(X) = ∑ᵢ aᵢ⋅Xⁱ
+     * @return Commitment computed as C = [p(x)] = ∑ᵢ aᵢ⋅Gᵢ
+     */
+    Commitment commit_fixed(PolynomialSpan<const Fr> polynomial)
+    {
+        PROFILE_THIS_NAME("commit_fixed");
+        using Cache = CommitmentCache<Curve>;
+        // commit() uses the prover CRS of the global factory (see there for the number of points it consumes)
+        const size_t consumed_srs = std::max(polynomial.end_index(), numeric::round_up_power_2(polynomial.size()));
+        const auto commit_srs = srs::get_crs_factory<Curve>()->get_prover_crs(consumed_srs);
+        const auto srs_fingerprint = Cache::srs_fingerprint(commit_srs->get_monomial_points());
+        return Cache::get().get_or_compute(srs_fingerprint, polynomial, [&]() { return commit(polynomial); });
+    }
+
     /**
      * @brief Efficiently commit to a sparse polynomial
      * @details Iterate through the {point, scalar} pairs that define the inputs to the commitment MSM, maintain (copy)
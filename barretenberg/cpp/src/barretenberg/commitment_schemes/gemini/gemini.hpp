@@ -8,6 +8,8 @@
 
 #include "barretenberg/commitment_schemes/claim.hpp"
 #include "barretenberg/commitment_schemes/claim_batcher.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/fields/field_vec.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/transcript/transcript.hpp"
 
@@ -107,6 +109,11 @@ template <typename Curve> class GeminiProver_ {
     using Claim = ProverOpeningClaim<Curve>;
 
   public:
+    // Rows of A₀ built per tile, small enough for the tiles of F, G and A₀ to stay in L2
+    static constexpr size_t BATCH_TILE_SIZE = 1 << 14;
+    // Number of fold levels computed per pass over the source polynomial, which is read in tiles of 2^this rows
+    static constexpr size_t FOLD_LEVELS_PER_PASS = 12;
+
     /**
      * @brief Class responsible for computation of the batched multilinear polynomials required by the Gemini protocol
      * @details Opening multivariate polynomials using Gemini requires the computation of three batched polynomials. The
@@ -188,6 +195,10 @@ template <typename Curve> class GeminiProver_ {
          * @brief Compute batched polynomial A₀ = F + G/X as the linear combination of all polynomials to be opened
          * @details If the random polynomial is set, it is added to the batched polynomial for ZK
          *
+         * F, G and A₀ are built together, one tile of BATCH_TILE_SIZE rows at a time: the tiles of F and G stay in
+         * cache while every source polynomial is added to them, instead of F and G being streamed through memory once
+         * per source polynomial. A₀ is only allocated up to the last row any of its terms can be nonzero at.
+         *
          * @param challenge batching challenge
          * @param running_scalar power of the batching challenge
          * @return Polynomial A₀
@@ -201,25 +212,90 @@ template <typename Curve> class GeminiProver_ {
                     running_scalar *= challenge;
                 }
             };
+            auto get_scalars = [&](const RefVector<Polynomial>& polynomials_to_batch) {
+                std::vector<Fr> scalars;
+                scalars.reserve(polynomials_to_batch.size());
+                for (size_t i = 0; i < polynomials_to_batch.size(); i++) {
+                    scalars.push_back(running_scalar);
+                    running_scalar *= challenge;
+                }
+                return scalars;
+            };
+            const std::vector<Fr> unshifted_scalars = get_scalars(unshifted);
+            const std::vector<Fr> shifted_by_one_scalars = get_scalars(to_be_shifted_by_one);
 
-            Polynomial full_batched(full_batched_size);
-
-            // if necessary, add randomness to the full batched polynomial for ZK
-            if (has_random_polynomial) {
-                full_batched += random_polynomial; // A₀ += rand
+            // Rows of A₀ backed by memory: the random polynomial, H and the interleaved polynomials are dense
+            size_t batched_size = 0;
+            if (has_random_polynomial || has_to_be_shifted_by_k() || has_interleaved()) {
+                batched_size = full_batched_size;
             }
-
-            // compute the linear combination F of the unshifted polynomials
-            if (has_unshifted()) {
-                batch(batched_unshifted, unshifted);
-                full_batched += batched_unshifted; // A₀ += F
+            for (auto& poly : unshifted) {
+                batched_size = std::max(batched_size, poly.end_index());
             }
-
-            // compute the linear combination G of the to-be-shifted polynomials
-            if (has_to_be_shifted_by_one()) {
-                batch(batched_to_be_shifted_by_one, to_be_shifted_by_one);
-                full_batched += batched_to_be_shifted_by_one.shifted(); // A₀ += G/X
+            for (auto& poly : to_be_shifted_by_one) {
+                if (poly.end_index() > 0) {
+                    batched_size = std::max(batched_size, poly.end_index() - 1);
+                }
             }
+            // Every row is written by the tiles below
+            Polynomial full_batched(batched_size, full_batched_size, Polynomial::DontZeroMemory::FLAG);
+
+            // F[rows] += ∑ⱼ ρʲ fⱼ[rows], for the rows backed by memory in both
+            auto batch_tile = [](Polynomial& batched,
+                                 const RefVector<Polynomial>& polynomials_to_batch,
+                                 const std::vector<Fr>& scalars,
+                                 size_t tile_start,
+                                 size_t tile_end) {
+                for (size_t i = 0; i < polynomials_to_batch.size(); i++) {
+                    const Polynomial& poly = polynomials_to_batch[i];
+                    const size_t start = std::max({ tile_start, poly.start_index(), batched.start_index() });
+                    const size_t end = std::min({ tile_end, poly.end_index(), batched.end_index() });
+                    if (start >= end) {
+                        continue;
+                    }
+                    auto rows = batched.coeffs().subspan(start - batched.start_index(), end - start);
+                    field_vec::add_scaled_vec<Fr>(
+                        rows, rows, scalars[i], poly.coeffs().subspan(start - poly.start_index(), end - start));
+                }
+            };
+
+            const size_t num_tiles = (full_batched_size + BATCH_TILE_SIZE - 1) / BATCH_TILE_SIZE;
+            parallel_for_range(num_tiles, [&](size_t start_tile, size_t end_tile) {
+                for (size_t tile = start_tile; tile < end_tile; tile++) {
+                    const size_t tile_start = tile * BATCH_TILE_SIZE;
+                    const size_t tile_end = std::min(tile_start + BATCH_TILE_SIZE, full_batched_size);
+                    batch_tile(batched_unshifted, unshifted, unshifted_scalars, tile_start, tile_end);
+                    batch_tile(batched_to_be_shifted_by_one,
+                               to_be_shifted_by_one,
+                               shifted_by_one_scalars,
+                               tile_start,
+                               tile_end);
+
+                    // A₀[i] = rand[i] + F[i] + G[i + 1]
+                    const size_t end = std::min(tile_end, batched_size);
+                    if (tile_start >= end) {
+                        continue;
+                    }
+                    auto rows = full_batched.coeffs().subspan(tile_start, end - tile_start);
+                    std::ranges::copy(batched_unshifted.coeffs().subspan(tile_start, rows.size()), rows.begin());
+                    if (has_random_polynomial) {
+                        field_vec::add_vec<Fr>(rows, rows, random_polynomial.coeffs().subspan(tile_start, rows.size()));
+                    }
+                    if (has_to_be_shifted_by_one()) {
+                        // G[tile_end] belongs to the next tile, the last row recomputes it from the sources
+                        const size_t num_rows = std::min(rows.size(), tile_end - 1 - tile_start);
+                        // G is stored from row 1, hence its row i + 1 is at offset i
+                        field_vec::add_vec<Fr>(rows.subspan(0, num_rows),
+                                               rows.subspan(0, num_rows),
+                                               batched_to_be_shifted_by_one.coeffs().subspan(tile_start, num_rows));
+                        if (num_rows < rows.size() && tile_end < full_batched_size) {
+                            for (size_t i = 0; i < to_be_shifted_by_one.size(); i++) {
+                                rows[num_rows] += shifted_by_one_scalars[i] * to_be_shifted_by_one[i][tile_end];
+                            }
+                        }
+                    }
+                }
+            });
 
             // compute the linear combination H of the to-be-shifted-by-k polynomials
             if (has_to_be_shifted_by_k()) {
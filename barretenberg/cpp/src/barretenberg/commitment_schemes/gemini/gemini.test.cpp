@@ -254,5 +254,75 @@ TYPED_TEST(GeminiTest, SoundnessRegression)
     }
 }
 
+/**
+ * @brief Check the tiled batching and the multi-pass folding against a naive dense batch and fold.
+ * @details The size is large enough for A₀ to span several BATCH_TILE_SIZE tiles, with shifted polynomials crossing
+ * the tile boundaries, and for the folds to take more than one pass of FOLD_LEVELS_PER_PASS levels. Every polynomial
+ * ends before the full size, so that A₀ is only stored up to its last nonzero row.
+ */
+TYPED_TEST(GeminiTest, BatchAndFoldMatchNaiveAtLargeSize)
+{
+    using GeminiProver = GeminiProver_<TypeParam>;
+    using Fr = TypeParam::ScalarField;
+    using Polynomial = bb::Polynomial<Fr>;
+    const size_t log_n = 16;
+    const size_t n = 1UL << log_n;
+    static_assert(n > 2 * GeminiProver::BATCH_TILE_SIZE);
+    static_assert(log_n - 1 > GeminiProver::FOLD_LEVELS_PER_PASS);
+
+    // Dense, sparse with a non-zero start and crossing a tile boundary, and sparse starting at a tile boundary
+    std::vector<Polynomial> unshifted;
+    unshifted.emplace_back(Polynomial::random(n - 1001, n, 0));
+    unshifted.emplace_back(Polynomial::random(5000, n, (2 * GeminiProver::BATCH_TILE_SIZE) - 2000));
+    unshifted.emplace_back(Polynomial::random(300, n, GeminiProver::BATCH_TILE_SIZE));
+    // Shiftable polynomials, both nonzero across the first tile boundary
+    std::vector<Polynomial> to_be_shifted;
+    to_be_shifted.emplace_back(Polynomial::random(n - 3000, n, 1));
+    to_be_shifted.emplace_back(Polynomial::random(GeminiProver::BATCH_TILE_SIZE, n, 1000));
+
+    const Fr rho = Fr::random_element();
+    std::vector<Fr> u = this->random_evaluation_point(log_n);
+
+    typename GeminiProver::PolynomialBatcher batcher(n);
+    batcher.set_unshifted(RefVector(unshifted));
+    batcher.set_to_be_shifted_by_one(RefVector(to_be_shifted));
+    Fr running_scalar = Fr::one();
+    const Polynomial A_0 = batcher.compute_batched(rho, running_scalar);
+    const std::vector<Polynomial> folds = GeminiProver::compute_fold_polynomials(log_n, u, A_0);
+
+    // A₀[i] = ∑ⱼ ρʲ fⱼ[i] + ∑ⱼ ρᵏ⁺ʲ gⱼ[i + 1]
+    std::vector<Fr> expected(n, Fr::zero());
+    Fr scalar = Fr::one();
+    for (const Polynomial& poly : unshifted) {
+        for (size_t i = 0; i < n; i++) {
+            expected[i] += scalar * poly.get(i);
+        }
+        scalar *= rho;
+    }
+    for (const Polynomial& poly : to_be_shifted) {
+        for (size_t i = 0; i + 1 < n; i++) {
+            expected[i] += scalar * poly.get(i + 1);
+        }
+        scalar *= rho;
+    }
+    EXPECT_EQ(running_scalar, scalar);
+    EXPECT_LT(A_0.end_index(), n);
+    for (size_t i = 0; i < n; i++) {
+        ASSERT_EQ(A_0.get(i), expected[i]) << "row " << i;
+    }
+
+    // Aₗ₊₁[j] = (1-uₗ)⋅Aₗ[2j] + uₗ⋅Aₗ[2j+1]
+    ASSERT_EQ(folds.size(), log_n - 1);
+    for (size_t l = 0; l < log_n - 1; l++) {
+        for (size_t j = 0; j < expected.size() / 2; j++) {
+            expected[j] = expected[2 * j] + u[l] * (expected[(2 * j) + 1] - expected[2 * j]);
+        }
+        expected.resize(expected.size() / 2);
+        for (size_t j = 0; j < expected.size(); j++) {
+            ASSERT_EQ(folds[l].get(j), expected[j]) << "fold " << l + 1 << ", row " << j;
+        }
+    }
+}
+
 template <class Curve> std::shared_ptr<typename GeminiTest<Curve>::CK> GeminiTest<Curve>::ck = nullptr;
 template <class Curve> std::shared_ptr<typename GeminiTest<Curve>::VK> GeminiTest<Curve>::vk = nullptr;
@@ -82,11 +82,15 @@ std::vector<typename GeminiProver_<Curve>::Claim> GeminiProver_<Curve>::prove(
     // Construct the d-1 Gemini foldings of A₀(X)
     std::vector<Polynomial> fold_polynomials = compute_fold_polynomials(log_n, multilinear_challenge, A_0);
 
+    // The folds shrink geometrically, so the MSMs of the last ones are batched to keep all threads busy
+    std::vector<PolynomialSpan<const Fr>> fold_spans(fold_polynomials.begin(), fold_polynomials.end());
+    std::vector<Commitment> fold_commitments = commitment_key->batch_commit(fold_spans);
+
     // If virtual_log_n >= log_n, pad the fold commitments with dummy group elements [1]_1.
     for (size_t l = 0; l < virtual_log_n - 1; l++) {
         std::string label = "Gemini:FOLD_" + std::to_string(l + 1);
         if (l < log_n - 1) {
-            transcript->send_to_verifier(label, commitment_key->commit(fold_polynomials[l]));
+            transcript->send_to_verifier(label, fold_commitments[l]);
         } else {
             transcript->send_to_verifier(label, Commitment::one());
         }
@@ -139,6 +143,14 @@ std::vector<typename GeminiProver_<Curve>::Claim> GeminiProver_<Curve>::prove(
 /**
  * @brief Computes d-1 fold polynomials Fold_i, i = 1, ..., d-1
  *
+ * @details Fold_{l+1}[j] only depends on the rows 2j and 2j+1 of Fold_l, hence a tile of 2^k consecutive rows of A₀
+ * determines a tile of Fold_1, ..., Fold_k. The folds are computed FOLD_LEVELS_PER_PASS levels per pass over the
+ * source (A₀, then the last fold of the previous pass), tile by tile, so that every level but the first of a pass is
+ * read from cache. Tiles are independent and processed in parallel.
+ *
+ * A₀ may be stored up to some size below 2ᵐ (its remaining coefficients being zero), each fold is then allocated at its
+ * final size CEIL(size of the previous level / 2).
+ *
  * @param multilinear_challenge multilinear opening point 'u'
  * @param A_0 = F(X) + G↺(X) = F(X) + G(X)/X
  * @return std::vector<Polynomial>
@@ -147,55 +159,62 @@ template <typename Curve>
 std::vector<typename GeminiProver_<Curve>::Polynomial> GeminiProver_<Curve>::compute_fold_polynomials(
     const size_t log_n, std::span<const Fr> multilinear_challenge, const Polynomial& A_0)
 {
-    const size_t num_threads = get_num_cpus_pow2();
-    constexpr size_t efficient_operations_per_thread = 64; // A guess of the number of operation for which there
-                                                           // would be a point in sending them to a separate thread
+    BB_ASSERT_EQ(A_0.start_index(), static_cast<size_t>(0));
 
-    // Reserve and allocate space for m-1 Fold polynomials, the foldings of the full batched polynomial A₀
+    // Allocate the m-1 Fold polynomials, the foldings of the full batched polynomial A₀. Every row is written below.
     std::vector<Polynomial> fold_polynomials;
     fold_polynomials.reserve(log_n - 1);
+    size_t size = A_0.end_index();
     for (size_t l = 0; l < log_n - 1; ++l) {
-        // size of the previous polynomial/2
-        const size_t n_l = 1 << (log_n - l - 1);
-
+        size = std::max(size / 2 + size % 2, size_t{ 1 });
         // A_l_fold = Aₗ₊₁(X) = (1-uₗ)⋅even(Aₗ)(X) + uₗ⋅odd(Aₗ)(X)
-        fold_polynomials.emplace_back(Polynomial(n_l));
+        fold_polynomials.emplace_back(Polynomial(size, 1 << (log_n - l - 1), Polynomial::DontZeroMemory::FLAG));
     }
 
-    // A_l = Aₗ(X) is the polynomial being folded
-    // in the first iteration, we take the batched polynomial
-    // in the next iteration, it is the previously folded one
-    auto A_l = A_0.data();
-    for (size_t l = 0; l < log_n - 1; ++l) {
-        // size of the previous polynomial/2
-        const size_t n_l = 1 << (log_n - l - 1);
-
-        // Use as many threads as it is useful so that 1 thread doesn't process 1 element, but make sure that there is
-        // at least 1
-        size_t num_used_threads = std::min(n_l / efficient_operations_per_thread, num_threads);
-        num_used_threads = num_used_threads ? num_used_threads : 1;
-        size_t chunk_size = n_l / num_used_threads;
-        size_t last_chunk_size = (n_l % chunk_size) ? (n_l % num_used_threads) : chunk_size;
-
-        // Opening point is the same for all
-        const Fr u_l = multilinear_challenge[l];
-
-        // A_l_fold = Aₗ₊₁(X) = (1-uₗ)⋅even(Aₗ)(X) + uₗ⋅odd(Aₗ)(X)
-        auto A_l_fold = fold_polynomials[l].data();
-
-        parallel_for(num_used_threads, [&](size_t i) {
-            size_t current_chunk_size = (i == (num_used_threads - 1)) ? last_chunk_size : chunk_size;
-            for (std::ptrdiff_t j = (std::ptrdiff_t)(i * chunk_size);
-                 j < (std::ptrdiff_t)((i * chunk_size) + current_chunk_size);
-                 j++) {
-                // fold(Aₗ)[j] = (1-uₗ)⋅even(Aₗ)[j] + uₗ⋅odd(Aₗ)[j]
-                //            = (1-uₗ)⋅Aₗ[2j]      + uₗ⋅Aₗ[2j+1]
-                //            = Aₗ₊₁[j]
+    // fold(Aₗ)[j] = (1-uₗ)⋅even(Aₗ)[j] + uₗ⋅odd(Aₗ)[j]
+    //            = (1-uₗ)⋅Aₗ[2j]      + uₗ⋅Aₗ[2j+1]
+    //            = Aₗ₊₁[j]
+    // for the rows j in [start, end), where Aₗ is stored up to A_l_size and zero beyond
+    const auto fold_rows =
+        [](Fr* A_l_fold, const Fr* A_l, const size_t A_l_size, const Fr& u_l, const size_t start, const size_t end) {
+            const size_t full_end = std::max(start, std::min(end, A_l_size / 2));
+            for (size_t j = start; j < full_end; j++) {
                 A_l_fold[j] = A_l[j << 1] + u_l * (A_l[(j << 1) + 1] - A_l[j << 1]);
             }
+            for (size_t j = full_end; j < end; j++) {
+                const Fr even = (j << 1) < A_l_size ? A_l[j << 1] : Fr::zero();
+                A_l_fold[j] = even - u_l * even;
+            }
+        };
+
+    // A_l = Aₗ(X) is the polynomial being folded
+    // in the first pass, we take the batched polynomial
+    // in the next passes, it is the last fold of the previous pass
+    const Fr* A_l = A_0.data();
+    size_t A_l_size = A_0.end_index();
+    for (size_t level = 0; level < log_n - 1;) {
+        const size_t num_levels = std::min(FOLD_LEVELS_PER_PASS, log_n - 1 - level);
+        const size_t tile_size = 1 << num_levels;
+        const size_t num_tiles = std::max((A_l_size + tile_size - 1) / tile_size, size_t{ 1 });
+
+        parallel_for_range(num_tiles, [&](size_t start_tile, size_t end_tile) {
+            for (size_t tile = start_tile; tile < end_tile; tile++) {
+                const Fr* source = A_l;
+                size_t source_size = A_l_size;
+                for (size_t i = 0; i < num_levels; i++) {
+                    Polynomial& fold = fold_polynomials[level + i];
+                    const size_t start = (tile * tile_size) >> (i + 1);
+                    const size_t end = std::min(((tile + 1) * tile_size) >> (i + 1), fold.size());
+                    fold_rows(fold.data(), source, source_size, multilinear_challenge[level + i], start, end);
+                    source = fold.data();
+                    source_size = fold.size();
+                }
+            }
         });
-        // set Aₗ₊₁ = Aₗ for the next iteration
-        A_l = A_l_fold;
+        // set Aₗ to the last fold of this pass for the next one
+        level += num_levels;
+        A_l = fold_polynomials[level - 1].data();
+        A_l_size = fold_polynomials[level - 1].size();
     }
 
     return fold_polynomials;
@@ -122,6 +122,38 @@ TYPED_TEST(CommitmentKeyTest, CommitFull)
     EXPECT_EQ(commit_result, full_commit_result);
 }
 
+// Check that batch_commit agrees with commit on polynomials both above and below the single-threaded MSM size
+TYPED_TEST(CommitmentKeyTest, BatchCommit)
+{
+    using Curve = TypeParam;
+    using CK = CommitmentKey<Curve>;
+    using G1 = Curve::AffineElement;
+    using Fr = Curve::ScalarField;
+    using Polynomial = bb::Polynomial<Fr>;
+
+    const size_t num_points = 1 << 12;
+    auto key = TestFixture::template create_commitment_key<CK>(num_points);
+
+    // Halving sizes as for Gemini folds, plus an offset polynomial with some zero coefficients
+    std::vector<Polynomial> polys;
+    for (size_t size = num_points; size > 0; size /= 2) {
+        polys.push_back(Polynomial::random(size));
+    }
+    Polynomial offset_poly{ 50, num_points, 37 };
+    for (size_t i = 37; i < 87; i += 2) {
+        offset_poly.at(i) = Fr::random_element();
+    }
+    polys.push_back(std::move(offset_poly));
+
+    std::vector<PolynomialSpan<const Fr>> spans(polys.begin(), polys.end());
+    std::vector<G1> batch_result = key->batch_commit(spans);
+
+    ASSERT_EQ(batch_result.size(), polys.size());
+    for (size_t i = 0; i < polys.size(); ++i) {
+        EXPECT_EQ(batch_result[i], key->commit(polys[i]));
+    }
+}
+
 // Check that commit for a structured polynomial and the same polynomial but full return the same results
 TYPED_TEST(CommitmentKeyTest, CommitFullMedium)
 {
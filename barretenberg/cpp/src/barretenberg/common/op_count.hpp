@@ -29,6 +29,8 @@
 #define BB_OP_COUNT_CYCLES() (void)0
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
 #define BB_OP_COUNT_TIME() (void)0
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define BB_OP_COUNT_ADD_TIME_NAME(name, time_ns) (void)0
 #else
 /**
  * Provides an abstraction that counts operations based on function names.
@@ -170,4 +172,7 @@ struct OpCountTimeReporter {
     bb::detail::OpCountTimeReporter __bb_op_count_time(bb::detail::GlobalOpCount<name>::ensure_stats())
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
 #define BB_OP_COUNT_TIME() BB_OP_COUNT_TIME_NAME(__func__)
+// Adds a duration that was not measured in scope, e.g. time saved by a cache.
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define BB_OP_COUNT_ADD_TIME_NAME(name, time_ns) bb::detail::GlobalOpCount<name>::add_clock_time(time_ns)
 #endif
@@ -291,17 +291,8 @@ ContentAddressedAppendOnlyTree<Store, HashingPolicy>::ContentAddressedAppendOnly
     // start by reading the meta data from the backing store
     store_->get_meta(meta);
     depth_ = meta.depth;
-    zero_hashes_.resize(depth_ + 1);
-
-    // Create the zero hashes for the tree
-    auto current = HashingPolicy::zero_hash();
-    for (size_t i = depth_; i > 0; --i) {
-        // std::cout << "Zero hash at " << i << " : " << current << std::endl;
-        zero_hashes_[i] = current;
-        current = HashingPolicy::hash_pair(current, current);
-    }
-    zero_hashes_[0] = current;
-    // std::cout << "Zero root: " << current << std::endl;
+    zero_hashes_ = get_zero_hashes<HashingPolicy>(depth_);
+    fr current = zero_hashes_[0];
 
     max_size_ = numeric::pow64(2, depth_);
     // if root is non-zero it means the tree has already been initialized
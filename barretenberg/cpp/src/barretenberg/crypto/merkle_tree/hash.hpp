@@ -14,6 +14,9 @@
 #include "barretenberg/stdlib/hash/blake2s/blake2s.hpp"
 #include "barretenberg/stdlib/hash/pedersen/pedersen.hpp"
 #include "barretenberg/stdlib/primitives/field/field.hpp"
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 namespace bb::crypto::merkle_tree {
@@ -37,6 +40,31 @@ struct Poseidon2HashPolicy {
     static fr zero_hash() { return fr::zero(); }
 };
 
+/**
+ * @brief Returns the root of an empty subtree at each level of a tree of the given depth, the leaf level being at
+ * index depth. These are computed once for each depth and shared by all trees using the hashing policy
+ */
+template <typename HashingPolicy> const std::vector<fr>& get_zero_hashes(uint32_t depth)
+{
+    static std::mutex mtx;
+    // Elements of an unordered_map are not moved on rehashing so the references handed out remain valid
+    static std::unordered_map<uint32_t, std::vector<fr>> zero_hashes_by_depth;
+
+    std::unique_lock lock(mtx);
+    auto it = zero_hashes_by_depth.find(depth);
+    if (it != zero_hashes_by_depth.end()) {
+        return it->second;
+    }
+    std::vector<fr> zero_hashes(depth + 1);
+    auto current = HashingPolicy::zero_hash();
+    for (size_t i = depth; i > 0; --i) {
+        zero_hashes[i] = current;
+        current = HashingPolicy::hash_pair(current, current);
+    }
+    zero_hashes[0] = current;
+    return zero_hashes_by_depth.emplace(depth, std::move(zero_hashes)).first->second;
+}
+
 inline bb::fr hash_pair_native(bb::fr const& lhs, bb::fr const& rhs)
 {
     return crypto::pedersen_hash::hash({ lhs, rhs }); // uses lookup tables
@@ -20,7 +20,6 @@
 #include <sstream>
 #include <stdexcept>
 #include <unordered_map>
-#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -196,6 +195,8 @@ class ContentAddressedIndexedTree : public ContentAddressedAppendOnlyTree<Store,
 
     void sparse_batch_update(const std::vector<std::pair<index_t, fr>>& hashes_at_level, uint32_t level);
 
+    fr hash_dirty_nodes(std::vector<std::pair<index_t, fr>>& dirty_nodes, uint32_t level, uint32_t root_level);
+
     /**
      * @brief Adds or updates the given set of values in the tree
      * @param values The values to be added or updated
@@ -241,9 +242,26 @@ class ContentAddressedIndexedTree : public ContentAddressedAppendOnlyTree<Store,
         index_t highest_index;
     };
 
+    // The part of a low leaf search that can be performed before any of the values are inserted
+    struct LowLeafPrefetch {
+        // The committed low leaf key and index, committed data is not modified by the insertion
+        std::pair<fr, index_t> committed_low_value;
+        // The low leaf pre-image as it was before the insertion, if it was not already in the cache
+        index_t low_leaf_index;
+        std::optional<IndexedLeafValueType> low_leaf;
+    };
+
+    struct LowLeafPrefetchResponse {
+        std::shared_ptr<std::vector<LowLeafPrefetch>> prefetched;
+    };
+
+    using LowLeafPrefetchCallback = std::function<void(const TypedResponse<LowLeafPrefetchResponse>&)>;
+    void prefetch_low_leaves(const std::vector<LeafValueType>& values, const LowLeafPrefetchCallback& completion);
+
     using SequentialInsertionGenerationCallback =
         std::function<void(TypedResponse<SequentialInsertionGenerationResponse>&)>;
     void generate_sequential_insertions(const std::vector<LeafValueType>& values,
+                                        const std::vector<LowLeafPrefetch>& prefetched,
                                         const SequentialInsertionGenerationCallback& completion);
 
     struct UpdatesCompletionResponse {
@@ -292,16 +310,7 @@ ContentAddressedIndexedTree<Store, HashingPolicy>::ContentAddressedIndexedTree(
     if (prefilled_values.size() > initial_size) {
         throw std::runtime_error("Number of prefilled values can't be more than initial size");
     }
-    zero_hashes_.resize(depth_ + 1);
-
-    // Create the zero hashes for the tree
-    auto current = fr::zero();
-    for (uint32_t i = depth_; i > 0; --i) {
-        zero_hashes_[i] = current;
-        current = HashingPolicy::hash_pair(current, current);
-    }
-    zero_hashes_[0] = current;
-
+    // The zero hashes have been set up by the base class, an empty indexed leaf hashes to the policy's zero hash
     TreeMeta meta;
     store_->get_meta(meta);
 
@@ -1159,52 +1168,12 @@ template <typename Store, typename HashingPolicy>
 void ContentAddressedIndexedTree<Store, HashingPolicy>::sparse_batch_update(
     const std::vector<std::pair<index_t, fr>>& hashes_at_level, uint32_t level)
 {
-    auto get_optional_node = [&](uint32_t level, index_t index) -> std::optional<fr> {
-        fr value = fr::zero();
-
-        bool success = store_->get_cached_node_by_index(level, index, value);
-        // std::cout << "Getting node at " << level << " : " << index << " success " << success << std::endl;
-        return success ? std::optional<fr>(value) : std::nullopt;
-    };
-    std::vector<index_t> indices;
-    indices.reserve(hashes_at_level.size());
-    std::unordered_map<index_t, fr> hashes;
-    // grab the hashes
-    for (size_t i = 0; i < hashes_at_level.size(); ++i) {
-        index_t index = hashes_at_level[i].first;
-        fr hash = hashes_at_level[i].second;
-        hashes[index] = hash;
-        indices.push_back(index);
-        // std::cout << "index " << index << " hash " << hash << std::endl;
-    }
-    std::unordered_set<index_t> unique_indices;
-    while (level > 0) {
-        std::vector<index_t> next_indices;
-        std::unordered_map<index_t, fr> next_hashes;
-        for (index_t index : indices) {
-            index_t parent_index = index >> 1;
-            auto it = unique_indices.insert(parent_index);
-            if (!it.second) {
-                continue;
-            }
-            next_indices.push_back(parent_index);
-            bool is_right = static_cast<bool>(index & 0x01);
-            fr new_hash = hashes[index];
-            std::optional<fr> new_right_option = is_right ? new_hash : get_optional_node(level, index + 1);
-            std::optional<fr> new_left_option = is_right ? get_optional_node(level, index - 1) : new_hash;
-            fr new_right_value = new_right_option.has_value() ? new_right_option.value() : zero_hashes_[level];
-            fr new_left_value = new_left_option.has_value() ? new_left_option.value() : zero_hashes_[level];
-
-            new_hash = HashingPolicy::hash_pair(new_left_value, new_right_value);
-            store_->put_cached_node_by_index(level - 1, parent_index, new_hash);
-            store_->put_node_by_hash(new_hash, { .left = new_left_option, .right = new_right_option, .ref = 1 });
-            next_hashes[parent_index] = new_hash;
-        }
-        indices = std::move(next_indices);
-        hashes = std::move(next_hashes);
-        unique_indices.clear();
-        --level;
+    if (hashes_at_level.empty()) {
+        return;
     }
+    std::vector<std::pair<index_t, fr>> dirty_nodes(hashes_at_level);
+    std::sort(dirty_nodes.begin(), dirty_nodes.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+    hash_dirty_nodes(dirty_nodes, level, 0);
 }
 
 template <typename Store, typename HashingPolicy>
@@ -1214,84 +1183,117 @@ std::pair<bool, fr> ContentAddressedIndexedTree<Store, HashingPolicy>::sparse_ba
     const uint32_t& root_level,
     const std::vector<LeafUpdate>& updates)
 {
-    auto get_optional_node = [&](uint32_t level, index_t index) -> std::optional<fr> {
-        fr value = fr::zero();
-        // std::cout << "Getting node at " << level << " : " << index << std::endl;
-        bool success = store_->get_cached_node_by_index(level, index, value);
-        return success ? std::optional<fr>(value) : std::nullopt;
-    };
-
-    uint32_t level = depth_;
-
-    std::vector<index_t> indices;
-    indices.reserve(updates.size());
-
-    fr new_hash = fr::zero();
-
-    std::unordered_set<index_t> unique_indices;
-    std::unordered_map<index_t, fr> hashes;
+    // Collect the updates to the leaves within our range, ordered by index. Where a leaf is updated more than once only
+    // the last update is relevant
     index_t end_index = start_index + num_leaves_to_be_inserted;
-    // Insert the leaves
-    for (size_t i = 0; i < updates.size(); ++i) {
-
-        const LeafUpdate& update = updates[i];
-        if (update.leaf_index < start_index || update.leaf_index >= end_index) {
-            continue;
+    std::vector<const LeafUpdate*> leaf_updates;
+    for (const LeafUpdate& update : updates) {
+        if (update.leaf_index >= start_index && update.leaf_index < end_index) {
+            leaf_updates.push_back(&update);
         }
-
-        // one of our leaves
-        new_hash = update.updated_leaf.leaf.is_empty() ? fr::zero()
-                                                       : HashingPolicy::hash(update.updated_leaf.get_hash_inputs());
-
-        // std::cout << "Hashing leaf at level " << level << " index " << update.leaf_index << " batch start "
-        //           << start_index << " hash " << leaf_hash << std::endl;
-
-        // Write the new leaf hash in place
-        store_->put_cached_node_by_index(level, update.leaf_index, new_hash);
-        // std::cout << "Writing leaf hash: " << new_hash << " at index " << index << std::endl;
-        store_->put_leaf_by_hash(new_hash, update.updated_leaf);
-        // std::cout << "Writing level: " << level << std::endl;
-        store_->put_node_by_hash(new_hash, { .left = std::nullopt, .right = std::nullopt, .ref = 1 });
-        indices.push_back(update.leaf_index);
-        hashes[update.leaf_index] = new_hash;
-        // std::cout << "Leaf " << new_hash << " at index " << update.leaf_index << std::endl;
     }
 
-    if (indices.empty()) {
+    if (leaf_updates.empty()) {
         return std::make_pair(false, fr::zero());
     }
 
+    std::stable_sort(leaf_updates.begin(), leaf_updates.end(), [](const LeafUpdate* a, const LeafUpdate* b) {
+        return a->leaf_index < b->leaf_index;
+    });
+
+    std::vector<std::pair<index_t, fr>> dirty_nodes;
+    std::vector<typename Store::NodeWrite> leaf_nodes;
+    std::vector<std::pair<fr, IndexedLeafValueType>> leaves;
+    dirty_nodes.reserve(leaf_updates.size());
+    leaf_nodes.reserve(leaf_updates.size());
+    leaves.reserve(leaf_updates.size());
+    for (size_t i = 0; i < leaf_updates.size(); ++i) {
+        const LeafUpdate& update = *leaf_updates[i];
+        if (i + 1 < leaf_updates.size() && leaf_updates[i + 1]->leaf_index == update.leaf_index) {
+            continue;
+        }
+        fr leaf_hash = update.updated_leaf.leaf.is_empty() ? fr::zero()
+                                                           : HashingPolicy::hash(update.updated_leaf.get_hash_inputs());
+        dirty_nodes.emplace_back(update.leaf_index, leaf_hash);
+        leaf_nodes.push_back(
+            { .index = update.leaf_index, .hash = leaf_hash, .payload = { std::nullopt, std::nullopt, 1 } });
+        leaves.emplace_back(leaf_hash, update.updated_leaf);
+    }
+
+    // Write the new leaf hashes in place
+    store_->put_leaves_by_hash(leaves);
+    store_->put_cached_nodes(depth_, leaf_nodes);
+
+    return std::make_pair(true, hash_dirty_nodes(dirty_nodes, depth_, root_level));
+}
+
+/**
+ * @brief Computes the ancestors of the provided dirty nodes up to the given root level. Each ancestor is hashed exactly
+ * once and the nodes of each level are written to the cache together. Siblings that are not dirty are read from the
+ * cache, if they are not present they are assumed to be empty.
+ *
+ * @param dirty_nodes The index and hash of each modified node at the given level, ordered by index. Replaced by the
+ * nodes at the root level
+ * @return The hash of the first node at the root level
+ */
+template <typename Store, typename HashingPolicy>
+fr ContentAddressedIndexedTree<Store, HashingPolicy>::hash_dirty_nodes(std::vector<std::pair<index_t, fr>>& dirty_nodes,
+                                                                      uint32_t level,
+                                                                      uint32_t root_level)
+{
+    std::vector<index_t> sibling_indices;
+    std::vector<std::optional<fr>> siblings;
+    std::vector<typename Store::NodeWrite> parent_nodes;
+    sibling_indices.reserve(dirty_nodes.size());
+    parent_nodes.reserve(dirty_nodes.size());
+
     while (level > root_level) {
-        std::vector<index_t> next_indices;
-        std::unordered_map<index_t, fr> next_hashes;
-        for (index_t index : indices) {
-            index_t parent_index = index >> 1;
-            auto it = unique_indices.insert(parent_index);
-            if (!it.second) {
+        // Only the siblings that are not dirty themselves need to be read
+        sibling_indices.clear();
+        for (size_t i = 0; i < dirty_nodes.size(); ++i) {
+            index_t index = dirty_nodes[i].first;
+            bool is_right = static_cast<bool>(index & 0x01);
+            if (!is_right && i + 1 < dirty_nodes.size() && dirty_nodes[i + 1].first == index + 1) {
+                ++i;
                 continue;
             }
-            next_indices.push_back(parent_index);
+            sibling_indices.push_back(index ^ 0x01);
+        }
+        store_->get_cached_nodes_by_index(level, sibling_indices, siblings);
+
+        // Hash each parent once, the parents are written over the front of the dirty nodes as we go
+        parent_nodes.clear();
+        size_t sibling = 0;
+        size_t num_parents = 0;
+        for (size_t i = 0; i < dirty_nodes.size(); ++i) {
+            auto [index, hash] = dirty_nodes[i];
             bool is_right = static_cast<bool>(index & 0x01);
-            new_hash = hashes[index];
-            std::optional<fr> new_right_option = is_right ? new_hash : get_optional_node(level, index + 1);
-            std::optional<fr> new_left_option = is_right ? get_optional_node(level, index - 1) : new_hash;
-            fr new_right_value = new_right_option.has_value() ? new_right_option.value() : zero_hashes_[level];
+            std::optional<fr> new_left_option;
+            std::optional<fr> new_right_option;
+            if (is_right) {
+                new_left_option = siblings[sibling++];
+                new_right_option = hash;
+            } else if (i + 1 < dirty_nodes.size() && dirty_nodes[i + 1].first == index + 1) {
+                new_left_option = hash;
+                new_right_option = dirty_nodes[++i].second;
+            } else {
+                new_left_option = hash;
+                new_right_option = siblings[sibling++];
+            }
             fr new_left_value = new_left_option.has_value() ? new_left_option.value() : zero_hashes_[level];
+            fr new_right_value = new_right_option.has_value() ? new_right_option.value() : zero_hashes_[level];
 
-            new_hash = HashingPolicy::hash_pair(new_left_value, new_right_value);
-            store_->put_cached_node_by_index(level - 1, parent_index, new_hash);
-            store_->put_node_by_hash(new_hash, { .left = new_left_option, .right = new_right_option, .ref = 1 });
-            next_hashes[parent_index] = new_hash;
-            // std::cout << "Created parent hash at level " << level - 1 << " index " << parent_index << " hash "
-            //           << new_hash << " left " << new_left_value << " right " << new_right_value << std::endl;
+            fr new_hash = HashingPolicy::hash_pair(new_left_value, new_right_value);
+            index_t parent_index = index >> 1;
+            parent_nodes.push_back(
+                { .index = parent_index, .hash = new_hash, .payload = { new_left_option, new_right_option, 1 } });
+            dirty_nodes[num_parents++] = std::make_pair(parent_index, new_hash);
         }
-        indices = std::move(next_indices);
-        hashes = std::move(next_hashes);
-        unique_indices.clear();
+        dirty_nodes.resize(num_parents);
+        store_->put_cached_nodes(level - 1, parent_nodes);
         --level;
     }
-    // std::cout << "Returning hash " << new_hash << std::endl;
-    return std::make_pair(true, new_hash);
+    return dirty_nodes.front().second;
 }
 
 template <typename Store, typename HashingPolicy>
@@ -1428,16 +1430,106 @@ void ContentAddressedIndexedTree<Store, HashingPolicy>::add_or_update_values_seq
                 perform_updates(flat_updates->size(), flat_updates, final_completion);
                 return;
             }
-            perform_updates_without_witness(insertion_response.inner.highest_index, flat_updates, final_completion);
+            // Without witnesses only the final state of each leaf matters, so repeated writes to the same slot
+            // collapse into a single update and are only hashed once
+            std::unordered_map<index_t, size_t> update_positions;
+            auto unique_updates = std::make_shared<std::vector<LeafUpdate>>();
+            unique_updates->reserve(flat_updates->size());
+            for (LeafUpdate& update : *flat_updates) {
+                auto [it, inserted] = update_positions.try_emplace(update.leaf_index, unique_updates->size());
+                if (inserted) {
+                    unique_updates->push_back(std::move(update));
+                } else {
+                    (*unique_updates)[it->second] = std::move(update);
+                }
+            }
+            perform_updates_without_witness(insertion_response.inner.highest_index, unique_updates, final_completion);
         };
 
-    // Enqueue the insertion data generation
-    workers_->enqueue([=, this]() { generate_sequential_insertions(values, insertion_generation_completed); });
+    // The low leaf lookups are independent of the order of insertion up until they are resolved against the values
+    // inserted earlier in the batch. We perform them across the workers first and then generate the insertions
+    LowLeafPrefetchCallback prefetch_completed = [=, this](const TypedResponse<LowLeafPrefetchResponse>& response) {
+        if (!response.success) {
+            on_error(response.message);
+            return;
+        }
+        generate_sequential_insertions(values, *response.inner.prefetched, insertion_generation_completed);
+    };
+
+    // Enqueue the low leaf prefetch
+    workers_->enqueue([=, this]() { prefetch_low_leaves(values, prefetch_completed); });
+}
+
+template <typename Store, typename HashingPolicy>
+void ContentAddressedIndexedTree<Store, HashingPolicy>::prefetch_low_leaves(const std::vector<LeafValueType>& values,
+                                                                            const LowLeafPrefetchCallback& completion)
+{
+    struct PrefetchResults {
+        std::atomic_uint32_t count;
+        std::shared_ptr<std::vector<LowLeafPrefetch>> prefetched;
+        Status status;
+
+        PrefetchResults(uint32_t init, size_t num_values)
+            : count(init)
+            , prefetched(std::make_shared<std::vector<LowLeafPrefetch>>(num_values))
+        {}
+    };
+
+    size_t num_batches = std::max(std::min(workers_->num_threads(), values.size()), static_cast<size_t>(1));
+    size_t batch_size = (values.size() + num_batches - 1) / num_batches;
+    std::shared_ptr<PrefetchResults> results =
+        std::make_shared<PrefetchResults>(static_cast<uint32_t>(num_batches), values.size());
+
+    for (size_t i = 0; i < num_batches; ++i) {
+        size_t start = i * batch_size;
+        size_t end = std::min(start + batch_size, values.size());
+        std::function<void()> op = [=, this]() {
+            try {
+                ReadTransactionPtr tx = store_->create_read_transaction();
+                RequestContext requestContext;
+                requestContext.includeUncommitted = true;
+                requestContext.root = store_->get_current_root(*tx, true);
+                for (size_t j = start; j < end; ++j) {
+                    const LeafValueType& value = values[j];
+                    if (value.is_empty()) {
+                        continue;
+                    }
+                    LowLeafPrefetch& prefetch = (*results->prefetched)[j];
+                    prefetch.committed_low_value =
+                        store_->find_committed_low_value(value.get_key(), requestContext, *tx);
+                    prefetch.low_leaf_index =
+                        store_->find_low_value(value.get_key(), prefetch.committed_low_value, requestContext).second;
+                    if (store_->get_cached_leaf_by_index(prefetch.low_leaf_index).has_value()) {
+                        continue;
+                    }
+                    // This also brings the nodes along the low leaf's path into the cache
+                    std::optional<fr> low_leaf_hash =
+                        find_leaf_hash(prefetch.low_leaf_index, requestContext, *tx, true);
+                    if (low_leaf_hash.has_value()) {
+                        prefetch.low_leaf = store_->get_leaf_by_hash(low_leaf_hash.value(), *tx, true);
+                    }
+                }
+            } catch (std::exception& e) {
+                results->status.set_failure(e.what());
+            }
+
+            if (results->count.fetch_sub(1) == 1) {
+                TypedResponse<LowLeafPrefetchResponse> response;
+                response.success = results->status.success;
+                response.message = results->status.message;
+                response.inner.prefetched = results->prefetched;
+                completion(response);
+            }
+        };
+        workers_->enqueue(op);
+    }
 }
 
 template <typename Store, typename HashingPolicy>
 void ContentAddressedIndexedTree<Store, HashingPolicy>::generate_sequential_insertions(
-    const std::vector<LeafValueType>& values, const SequentialInsertionGenerationCallback& completion)
+    const std::vector<LeafValueType>& values,
+    const std::vector<LowLeafPrefetch>& prefetched,
+    const SequentialInsertionGenerationCallback& completion)
 {
     execute_and_report<SequentialInsertionGenerationResponse>(
         [=, this](TypedResponse<SequentialInsertionGenerationResponse>& response) {
@@ -1466,21 +1558,25 @@ void ContentAddressedIndexedTree<Store, HashingPolicy>::generate_sequential_inse
                 }
                 fr value = new_payload.get_key();
 
-                // This gives us the leaf that need updating
+                // This gives us the leaf that need updating. The committed part of the search has already been done,
+                // here we only need to account for the values inserted before this one
                 index_t low_leaf_index = 0;
                 bool is_already_present = false;
+                const LowLeafPrefetch& prefetch = prefetched[i];
 
                 std::tie(is_already_present, low_leaf_index) =
-                    store_->find_low_value(new_payload.get_key(), requestContext, *tx);
+                    store_->find_low_value(new_payload.get_key(), prefetch.committed_low_value, requestContext);
 
-                // Try and retrieve the leaf pre-image from the cache first.
-                // If unsuccessful, derive from the tree and hash based lookup
+                // Try and retrieve the leaf pre-image from the cache first, then from the prefetch if it is still the
+                // low leaf. If unsuccessful, derive from the tree and hash based lookup
                 std::optional<IndexedLeafValueType> optional_low_leaf =
                     store_->get_cached_leaf_by_index(low_leaf_index);
                 IndexedLeafValueType low_leaf;
 
                 if (optional_low_leaf.has_value()) {
                     low_leaf = optional_low_leaf.value();
+                } else if (prefetch.low_leaf.has_value() && prefetch.low_leaf_index == low_leaf_index) {
+                    low_leaf = prefetch.low_leaf.value();
                 } else {
                     std::optional<fr> low_leaf_hash = find_leaf_hash(low_leaf_index, requestContext, *tx, true);
 
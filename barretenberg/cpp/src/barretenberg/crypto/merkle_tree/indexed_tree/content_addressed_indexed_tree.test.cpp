@@ -1050,6 +1050,91 @@ TEST_F(PersistedContentAddressedIndexedTreeTest, sequential_insert_allows_multip
     check_size(tree, 3);
 }
 
+TEST_F(PersistedContentAddressedIndexedTreeTest, sequential_public_data_writes_match_across_thread_pools)
+{
+    const uint32_t initial_size = 2;
+    const uint32_t batch_size = 64;
+    const uint32_t num_slots = 96;
+    constexpr size_t depth = 20;
+    auto& random_engine = numeric::get_randomness();
+
+    auto create_public_data_tree = [&](uint32_t num_threads) {
+        std::string name = random_string();
+        std::filesystem::path directory = _directory;
+        directory.append(name);
+        std::filesystem::create_directories(directory);
+        LMDBTreeStore::SharedPtr db = std::make_shared<LMDBTreeStore>(directory, name, _mapSize, _maxReaders);
+        std::unique_ptr<PublicDataStore> store = std::make_unique<PublicDataStore>(name, depth, db);
+        return std::make_unique<PublicDataTreeType>(std::move(store), make_thread_pool(num_threads), initial_size);
+    };
+
+    // The reference tree generates everything on a single thread
+    auto reference_tree = create_public_data_tree(1);
+    auto witness_tree = create_public_data_tree(8);
+    auto sync_tree = create_public_data_tree(8);
+
+    using PublicDataWitness = std::shared_ptr<std::vector<LeafUpdateWitnessData<PublicDataLeafValue>>>;
+    auto insert_with_witness = [](PublicDataTreeType& tree,
+                                  const std::vector<PublicDataLeafValue>& values,
+                                  PublicDataWitness& low_leaf_witness_data,
+                                  PublicDataWitness& insertion_witness_data) {
+        Signal signal;
+        auto completion = [&](const TypedResponse<AddIndexedDataSequentiallyResponse<PublicDataLeafValue>>& response) {
+            EXPECT_TRUE(response.success);
+            low_leaf_witness_data = response.inner.low_leaf_witness_data;
+            insertion_witness_data = response.inner.insertion_witness_data;
+            signal.signal_level();
+        };
+        tree.add_or_update_values_sequentially(values, completion);
+        signal.wait_for_level();
+    };
+
+    for (uint32_t round = 0; round < 6; round++) {
+        // Draw the slots from a small set so that batches update committed slots, uncommitted slots and slots written
+        // earlier in the same batch, and new leaves become the low leaves of later values in the batch
+        std::vector<PublicDataLeafValue> batch;
+        for (uint32_t j = 0; j < batch_size; j++) {
+            uint32_t slot = (random_engine.get_random_uint32() % num_slots) + 1;
+            batch.emplace_back(fr(slot * 1000), fr(random_engine.get_random_uint32()));
+        }
+        // Leave some empty values in the batch
+        batch[batch_size / 2] = PublicDataLeafValue::empty();
+
+        PublicDataWitness reference_low_leaf_witness_data;
+        PublicDataWitness reference_insertion_witness_data;
+        PublicDataWitness low_leaf_witness_data;
+        PublicDataWitness insertion_witness_data;
+        insert_with_witness(*reference_tree, batch, reference_low_leaf_witness_data, reference_insertion_witness_data);
+        insert_with_witness(*witness_tree, batch, low_leaf_witness_data, insertion_witness_data);
+        block_sync_values_sequential(*sync_tree, batch);
+
+        fr expected_root = get_root(*reference_tree);
+        check_root(*witness_tree, expected_root);
+        check_root(*sync_tree, expected_root);
+
+        ASSERT_EQ(reference_low_leaf_witness_data->size(), low_leaf_witness_data->size());
+        ASSERT_EQ(reference_insertion_witness_data->size(), insertion_witness_data->size());
+        for (uint32_t j = 0; j < reference_low_leaf_witness_data->size(); j++) {
+            EXPECT_EQ(reference_low_leaf_witness_data->at(j).leaf, low_leaf_witness_data->at(j).leaf);
+            EXPECT_EQ(reference_low_leaf_witness_data->at(j).index, low_leaf_witness_data->at(j).index);
+            EXPECT_EQ(reference_low_leaf_witness_data->at(j).path, low_leaf_witness_data->at(j).path);
+        }
+        for (uint32_t j = 0; j < reference_insertion_witness_data->size(); j++) {
+            EXPECT_EQ(reference_insertion_witness_data->at(j).leaf, insertion_witness_data->at(j).leaf);
+            EXPECT_EQ(reference_insertion_witness_data->at(j).index, insertion_witness_data->at(j).index);
+            EXPECT_EQ(reference_insertion_witness_data->at(j).path, insertion_witness_data->at(j).path);
+        }
+
+        // Commit every other round so that the low leaves are found in both the committed and uncommitted state
+        if (round % 2 == 1) {
+            commit_tree(*reference_tree);
+            commit_tree(*witness_tree);
+            commit_tree(*sync_tree);
+            check_root(*sync_tree, expected_root, false);
+        }
+    }
+}
+
 template <typename LeafValueType> fr hash_leaf(const IndexedLeaf<LeafValueType>& leaf)
 {
     return HashPolicy::hash(leaf.get_hash_inputs());
@@ -54,9 +54,15 @@ int index_key_cmp(const MDB_val* a, const MDB_val* b)
     return value_cmp<uint64_t>(a, b);
 }
 
-LMDBTreeStore::LMDBTreeStore(std::string directory, std::string name, uint64_t mapSizeKb, uint64_t maxNumReaders)
+LMDBTreeStore::LMDBTreeStore(std::string directory,
+                             std::string name,
+                             uint64_t mapSizeKb,
+                             uint64_t maxNumReaders,
+                             uint64_t committedCacheSize)
     : LMDBStoreBase(directory, mapSizeKb, maxNumReaders, 5)
     , _name(std::move(name))
+    , _nodeCache(committedCacheSize)
+    , _leafCache(committedCacheSize)
 {
 
     {
@@ -109,6 +115,8 @@ void LMDBTreeStore::get_stats(TreeDBStats& stats, ReadTransaction& tx)
     stats.leafIndicesDBStats = _leafKeyToIndexDatabase->get_stats(tx);
     stats.nodesDBStats = _nodeDatabase->get_stats(tx);
     stats.blockIndicesDBStats = _indexToBlockDatabase->get_stats(tx);
+    stats.nodesCacheStats = _nodeCache.get_stats();
+    stats.leafPreimagesCacheStats = _leafCache.get_stats();
 }
 
 void LMDBTreeStore::write_block_data(const block_number_t& blockNumber,
@@ -262,13 +270,14 @@ void LMDBTreeStore::increment_node_reference_count(const fr& nodeHash, WriteTran
 
 void LMDBTreeStore::set_or_increment_node_reference_count(const fr& nodeHash,
                                                           NodePayload& nodeData,
-                                                          WriteTransaction& tx)
+                                                          WriteTransaction& tx,
+                                                          uint64_t increment)
 {
     // Set to zero here and enrich from DB if present
     nodeData.ref = 0;
     get_node_data(nodeHash, nodeData, tx);
     // Increment now to the correct value
-    ++nodeData.ref;
+    nodeData.ref += increment;
     // std::cout << "Setting node at " << nodeHash << ", to " << nodeData.ref << std::endl;
     write_node(nodeHash, nodeData, tx);
 }
@@ -282,6 +291,7 @@ void LMDBTreeStore::decrement_node_reference_count(const fr& nodeHash, NodePaylo
     if (--nodeData.ref == 0) {
         // std::cout << "Deleting node at " << nodeHash << std::endl;
         tx.delete_value(nodeHash, *_nodeDatabase);
+        _nodeCache.erase(nodeHash);
         return;
     }
     // std::cout << "Updating node at " << nodeHash << " ref is now " << nodeData.ref << std::endl;
@@ -292,6 +302,7 @@ void LMDBTreeStore::delete_leaf_by_hash(const fr& leafHash, WriteTransaction& tx
 {
     FrKeyType key(leafHash);
     tx.delete_value(key, *_leafHashToPreImageDatabase);
+    _leafCache.erase(leafHash);
 }
 
 fr LMDBTreeStore::find_low_leaf(const fr& leafValue,
@@ -324,6 +335,18 @@ bool LMDBTreeStore::read_node(const fr& nodeHash, NodePayload& nodeData, ReadTra
     return success;
 }
 
+bool LMDBTreeStore::read_cached_node(const fr& nodeHash, NodePayload& nodeData, ReadTransaction& tx)
+{
+    if (_nodeCache.get(nodeHash, nodeData)) {
+        return true;
+    }
+    if (!read_node(nodeHash, nodeData, tx)) {
+        return false;
+    }
+    _nodeCache.put(nodeHash, nodeData);
+    return true;
+}
+
 void LMDBTreeStore::write_node(const fr& nodeHash, const NodePayload& nodeData, WriteTransaction& tx)
 {
     msgpack::sbuffer buffer;
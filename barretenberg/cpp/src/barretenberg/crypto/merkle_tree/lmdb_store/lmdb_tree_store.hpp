@@ -8,6 +8,7 @@
 #include "barretenberg/common/log.hpp"
 #include "barretenberg/common/serialize.hpp"
 #include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
+#include "barretenberg/crypto/merkle_tree/lmdb_store/lru_cache.hpp"
 #include "barretenberg/crypto/merkle_tree/node_store/tree_meta.hpp"
 #include "barretenberg/crypto/merkle_tree/types.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
@@ -24,9 +25,11 @@
 #include <ostream>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <typeinfo>
 #include <unordered_map>
 #include <utility>
+#include <variant>
 
 namespace bb::crypto::merkle_tree {
 
@@ -159,6 +162,17 @@ struct BlockIndexPayload {
         blockNumbers[1] = blockNumber;
     }
 };
+// The leaf pre-image types held by the committed leaf cache, other leaf types are always read from the database
+using CachedLeafPreimage = std::variant<IndexedLeaf<NullifierLeafValue>, IndexedLeaf<PublicDataLeafValue>>;
+
+template <typename LeafType, typename Variant> struct is_variant_alternative : std::false_type {};
+template <typename LeafType, typename... Types>
+struct is_variant_alternative<LeafType, std::variant<Types...>>
+    : std::bool_constant<(std::is_same_v<LeafType, Types> || ...)> {};
+
+// The default number of entries held by each of the committed node and leaf pre-image caches
+const uint64_t DEFAULT_COMMITTED_CACHE_SIZE = 32 * 1024;
+
 /**
  * Creates an abstraction against a collection of LMDB databases within a single environment used to store merkle tree
  * data
@@ -170,7 +184,11 @@ class LMDBTreeStore : public LMDBStoreBase {
     using SharedPtr = std::shared_ptr<LMDBTreeStore>;
     using ReadTransaction = LMDBReadTransaction;
     using WriteTransaction = LMDBWriteTransaction;
-    LMDBTreeStore(std::string directory, std::string name, uint64_t mapSizeKb, uint64_t maxNumReaders);
+    LMDBTreeStore(std::string directory,
+                  std::string name,
+                  uint64_t mapSizeKb,
+                  uint64_t maxNumReaders,
+                  uint64_t committedCacheSize = DEFAULT_COMMITTED_CACHE_SIZE);
     LMDBTreeStore(const LMDBTreeStore& other) = delete;
     LMDBTreeStore(LMDBTreeStore&& other) = delete;
     LMDBTreeStore& operator=(const LMDBTreeStore& other) = delete;
@@ -208,17 +226,28 @@ class LMDBTreeStore : public LMDBStoreBase {
 
     bool read_node(const fr& nodeHash, NodePayload& nodeData, ReadTransaction& tx);
 
+    // Reads a committed node through the node cache. The reference counts of cached nodes are not kept up to date so
+    // this must only be used for navigating the tree, never for reference count management
+    bool read_cached_node(const fr& nodeHash, NodePayload& nodeData, ReadTransaction& tx);
+
     void write_node(const fr& nodeHash, const NodePayload& nodeData, WriteTransaction& tx);
 
     void increment_node_reference_count(const fr& nodeHash, WriteTransaction& tx);
 
-    void set_or_increment_node_reference_count(const fr& nodeHash, NodePayload& nodeData, WriteTransaction& tx);
+    void set_or_increment_node_reference_count(const fr& nodeHash,
+                                               NodePayload& nodeData,
+                                               WriteTransaction& tx,
+                                               uint64_t increment = 1);
 
     void decrement_node_reference_count(const fr& nodeHash, NodePayload& nodeData, WriteTransaction& tx);
 
     template <typename LeafType, typename TxType>
     bool read_leaf_by_hash(const fr& leafHash, LeafType& leafData, TxType& tx);
 
+    // Reads a committed leaf pre-image through the leaf cache
+    template <typename LeafType, typename TxType>
+    bool read_cached_leaf_by_hash(const fr& leafHash, LeafType& leafData, TxType& tx);
+
     template <typename LeafType>
     void write_leaf_by_hash(const fr& leafHash, const LeafType& leafData, WriteTransaction& tx);
 
@@ -246,6 +275,12 @@ class LMDBTreeStore : public LMDBStoreBase {
     LMDBDatabase::Ptr _leafHashToPreImageDatabase;
     LMDBDatabase::Ptr _indexToBlockDatabase;
 
+    // Committed data is content addressed so an entry stays valid for as long as its hash is present in the database.
+    // Entries are removed as their nodes and pre-images are deleted by unwinding or removing blocks. These caches are
+    // shared by every fork of the tree.
+    ShardedLRUCache<fr, NodePayload> _nodeCache;
+    ShardedLRUCache<fr, CachedLeafPreimage> _leafCache;
+
     template <typename TxType> bool get_node_data(const fr& nodeHash, NodePayload& nodeData, TxType& tx);
 };
 
@@ -267,6 +302,25 @@ bool LMDBTreeStore::read_leaf_by_hash(const fr& leafHash, LeafType& leafData, Tx
     return success;
 }
 
+template <typename LeafType, typename TxType>
+bool LMDBTreeStore::read_cached_leaf_by_hash(const fr& leafHash, LeafType& leafData, TxType& tx)
+{
+    if constexpr (is_variant_alternative<LeafType, CachedLeafPreimage>::value) {
+        CachedLeafPreimage cached;
+        if (_leafCache.get(leafHash, cached)) {
+            leafData = std::get<LeafType>(cached);
+            return true;
+        }
+        if (!read_leaf_by_hash(leafHash, leafData, tx)) {
+            return false;
+        }
+        _leafCache.put(leafHash, leafData);
+        return true;
+    } else {
+        return read_leaf_by_hash(leafHash, leafData, tx);
+    }
+}
+
 template <typename LeafType>
 void LMDBTreeStore::write_leaf_by_hash(const fr& leafHash, const LeafType& leafData, WriteTransaction& tx)
 {
@@ -300,6 +300,103 @@ TEST_F(LMDBTreeStoreTest, can_write_and_read_leaves_by_hash)
     }
 }
 
+TEST_F(LMDBTreeStoreTest, cached_reads_of_nodes_and_leaves)
+{
+    NodePayload nodePayload;
+    nodePayload.left = VALUES[4];
+    nodePayload.right = VALUES[5];
+    nodePayload.ref = 1;
+    bb::fr nodeKey = VALUES[6];
+    IndexedLeaf<PublicDataLeafValue> leafData(PublicDataLeafValue(VALUES[0], VALUES[1]), 3, VALUES[7]);
+    bb::fr leafKey = VALUES[2];
+    LMDBTreeStore store(_directory, "DB1", _mapSize, _maxReaders);
+    {
+        LMDBWriteTransaction::Ptr transaction = store.create_write_transaction();
+        store.write_node(nodeKey, nodePayload, *transaction);
+        store.write_leaf_by_hash(leafKey, leafData, *transaction);
+        transaction->commit();
+    }
+
+    {
+        // the first reads miss the caches, subsequent reads hit
+        LMDBReadTransaction::Ptr transaction = store.create_read_transaction();
+        for (uint32_t i = 0; i < 3; i++) {
+            NodePayload nodeReadBack;
+            EXPECT_TRUE(store.read_cached_node(nodeKey, nodeReadBack, *transaction));
+            EXPECT_EQ(nodeReadBack, nodePayload);
+            IndexedLeaf<PublicDataLeafValue> leafReadBack;
+            EXPECT_TRUE(store.read_cached_leaf_by_hash(leafKey, leafReadBack, *transaction));
+            EXPECT_EQ(leafReadBack, leafData);
+        }
+        NodePayload nodeReadBack;
+        EXPECT_FALSE(store.read_cached_node(VALUES[9], nodeReadBack, *transaction));
+
+        TreeDBStats stats;
+        store.get_stats(stats, *transaction);
+        EXPECT_EQ(stats.nodesCacheStats.hits, 2);
+        EXPECT_EQ(stats.nodesCacheStats.misses, 2);
+        EXPECT_EQ(stats.nodesCacheStats.numItems, 1);
+        EXPECT_EQ(stats.nodesCacheStats.capacity, DEFAULT_COMMITTED_CACHE_SIZE);
+        EXPECT_EQ(stats.leafPreimagesCacheStats.hits, 2);
+        EXPECT_EQ(stats.leafPreimagesCacheStats.misses, 1);
+        EXPECT_EQ(stats.leafPreimagesCacheStats.numItems, 1);
+    }
+
+    {
+        // deleting the node and the pre-image must remove them from the caches
+        LMDBWriteTransaction::Ptr transaction = store.create_write_transaction();
+        NodePayload deleted;
+        store.decrement_node_reference_count(nodeKey, deleted, *transaction);
+        store.delete_leaf_by_hash(leafKey, *transaction);
+        transaction->commit();
+    }
+
+    {
+        LMDBReadTransaction::Ptr transaction = store.create_read_transaction();
+        NodePayload nodeReadBack;
+        EXPECT_FALSE(store.read_cached_node(nodeKey, nodeReadBack, *transaction));
+        IndexedLeaf<PublicDataLeafValue> leafReadBack;
+        EXPECT_FALSE(store.read_cached_leaf_by_hash(leafKey, leafReadBack, *transaction));
+
+        TreeDBStats stats;
+        store.get_stats(stats, *transaction);
+        EXPECT_EQ(stats.nodesCacheStats.numItems, 0);
+        EXPECT_EQ(stats.leafPreimagesCacheStats.numItems, 0);
+    }
+}
+
+TEST_F(LMDBTreeStoreTest, committed_cache_is_bounded)
+{
+    const uint64_t cacheSize = 64;
+    LMDBTreeStore store(_directory, "DB1", _mapSize, _maxReaders, cacheSize);
+    std::vector<bb::fr> keys;
+    {
+        LMDBWriteTransaction::Ptr transaction = store.create_write_transaction();
+        for (uint32_t i = 0; i < cacheSize * 4; i++) {
+            keys.push_back(bb::fr::random_element());
+            store.write_node(keys.back(), NodePayload{ VALUES[0], VALUES[1], 1 }, *transaction);
+        }
+        transaction->commit();
+    }
+
+    LMDBReadTransaction::Ptr transaction = store.create_read_transaction();
+    for (const bb::fr& key : keys) {
+        NodePayload nodeReadBack;
+        EXPECT_TRUE(store.read_cached_node(key, nodeReadBack, *transaction));
+        EXPECT_EQ(nodeReadBack.left, VALUES[0]);
+    }
+    TreeDBStats stats;
+    store.get_stats(stats, *transaction);
+    EXPECT_LE(stats.nodesCacheStats.numItems, cacheSize);
+    EXPECT_EQ(stats.nodesCacheStats.misses, keys.size());
+
+    // the most recently read node is always still cached
+    NodePayload nodeReadBack;
+    EXPECT_TRUE(store.read_cached_node(keys.back(), nodeReadBack, *transaction));
+    store.get_stats(stats, *transaction);
+    EXPECT_EQ(stats.nodesCacheStats.hits, 1);
+}
+
 TEST_F(LMDBTreeStoreTest, can_write_and_retrieve_block_numbers_by_index)
 {
     struct BlockAndIndex {
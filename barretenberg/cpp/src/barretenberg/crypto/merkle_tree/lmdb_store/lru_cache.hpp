@@ -0,0 +1,140 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#pragma once
+#include "barretenberg/crypto/merkle_tree/types.hpp"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace bb::crypto::merkle_tree {
+
+/**
+ * @brief A bounded, thread-safe least recently used cache.
+ * Keys are distributed over a fixed number of independently locked shards so concurrent readers rarely contend.
+ * Each shard evicts its own least recently used entry once it holds its share of the total capacity.
+ * A capacity of 0 disables the cache.
+ */
+template <typename KeyType, typename ValueType, typename Hasher = std::hash<KeyType>> class ShardedLRUCache {
+  public:
+    static constexpr size_t NUM_SHARDS = 16;
+
+    explicit ShardedLRUCache(size_t capacity)
+        : capacity_(capacity)
+        , shardCapacity_((capacity + NUM_SHARDS - 1) / NUM_SHARDS)
+    {}
+    ShardedLRUCache(const ShardedLRUCache& other) = delete;
+    ShardedLRUCache(ShardedLRUCache&& other) = delete;
+    ShardedLRUCache& operator=(const ShardedLRUCache& other) = delete;
+    ShardedLRUCache& operator=(ShardedLRUCache&& other) = delete;
+    ~ShardedLRUCache() = default;
+
+    bool get(const KeyType& key, ValueType& value)
+    {
+        if (capacity_ == 0) {
+            return false;
+        }
+        Shard& shard = get_shard(key);
+        {
+            std::unique_lock lock(shard.mtx);
+            auto it = shard.index.find(key);
+            if (it != shard.index.end()) {
+                // move the entry to the front, it is now the most recently used
+                shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+                value = it->second->second;
+                hits_.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        misses_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    void put(const KeyType& key, const ValueType& value)
+    {
+        if (capacity_ == 0) {
+            return;
+        }
+        Shard& shard = get_shard(key);
+        std::unique_lock lock(shard.mtx);
+        auto it = shard.index.find(key);
+        if (it != shard.index.end()) {
+            it->second->second = value;
+            shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+            return;
+        }
+        if (shard.entries.size() >= shardCapacity_) {
+            shard.index.erase(shard.entries.back().first);
+            shard.entries.pop_back();
+        }
+        shard.entries.emplace_front(key, value);
+        shard.index[key] = shard.entries.begin();
+    }
+
+    void erase(const KeyType& key)
+    {
+        if (capacity_ == 0) {
+            return;
+        }
+        Shard& shard = get_shard(key);
+        std::unique_lock lock(shard.mtx);
+        auto it = shard.index.find(key);
+        if (it == shard.index.end()) {
+            return;
+        }
+        shard.entries.erase(it->second);
+        shard.index.erase(it);
+    }
+
+    void clear()
+    {
+        for (Shard& shard : shards_) {
+            std::unique_lock lock(shard.mtx);
+            shard.entries.clear();
+            shard.index.clear();
+        }
+    }
+
+    CacheStats get_stats() const
+    {
+        uint64_t size = 0;
+        for (const Shard& shard : shards_) {
+            std::unique_lock lock(shard.mtx);
+            size += shard.entries.size();
+        }
+        return { hits_.load(std::memory_order_relaxed), misses_.load(std::memory_order_relaxed), size, capacity_ };
+    }
+
+  private:
+    using EntryList = std::list<std::pair<KeyType, ValueType>>;
+
+    struct Shard {
+        mutable std::mutex mtx;
+        // Ordered from most to least recently used
+        EntryList entries;
+        std::unordered_map<KeyType, typename EntryList::iterator, Hasher> index;
+    };
+
+    Shard& get_shard(const KeyType& key)
+    {
+        // Mix the upper bits in, the shard's own map buckets on the lower ones
+        size_t h = Hasher{}(key);
+        return shards_[(h ^ (h >> 32)) % NUM_SHARDS];
+    }
+
+    size_t capacity_;
+    size_t shardCapacity_;
+    std::array<Shard, NUM_SHARDS> shards_;
+    std::atomic<uint64_t> hits_{ 0 };
+    std::atomic<uint64_t> misses_{ 0 };
+};
+} // namespace bb::crypto::merkle_tree
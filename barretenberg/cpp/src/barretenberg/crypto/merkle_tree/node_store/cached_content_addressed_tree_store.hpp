@@ -32,6 +32,15 @@
 
 namespace bb::crypto::merkle_tree {
 
+/**
+ * @brief The committed state that a fork is initialised from. This is constant for the lifetime of the fork so a single
+ * snapshot can be shared by all forks of the same block
+ */
+struct ForkSnapshot {
+    BlockPayload block;
+    TreeMeta meta;
+};
+
 /**
  * @brief Serves as a key-value node store for merkle trees. Caches all changes in memory before persisting them during
  * a 'commit' operation.
@@ -51,11 +60,22 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
     using ReadTransactionPtr = std::unique_ptr<ReadTransaction>;
     using WriteTransactionPtr = std::unique_ptr<WriteTransaction>;
 
+    // A node written both by its hash and by its index at a given level
+    struct NodeWrite {
+        index_t index;
+        fr hash;
+        NodePayload payload;
+    };
+
     ContentAddressedCachedTreeStore(std::string name, uint32_t levels, PersistedStoreType::SharedPtr dataStore);
     ContentAddressedCachedTreeStore(std::string name,
                                     uint32_t levels,
                                     const index_t& referenceBlockNumber,
                                     PersistedStoreType::SharedPtr dataStore);
+    ContentAddressedCachedTreeStore(std::string name,
+                                    uint32_t levels,
+                                    const ForkSnapshot& snapshot,
+                                    PersistedStoreType::SharedPtr dataStore);
     ~ContentAddressedCachedTreeStore() = default;
 
     ContentAddressedCachedTreeStore() = delete;
@@ -71,6 +91,22 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
                                             const RequestContext& requestContext,
                                             ReadTransaction& tx) const;
 
+    /**
+     * @brief Returns the key and index of the committed leaf with a value immediately lower than or equal to the value
+     * provided. Committed data does not change whilst values are being inserted, so this can be computed ahead of time
+     */
+    std::pair<fr, index_t> find_committed_low_value(const fr& new_leaf_key,
+                                                    const RequestContext& requestContext,
+                                                    ReadTransaction& tx) const;
+
+    /**
+     * @brief Returns the index of the leaf with a value immediately lower than the value provided, given the result of
+     * find_committed_low_value. Only the uncommitted cache is searched
+     */
+    std::pair<bool, index_t> find_low_value(const fr& new_leaf_key,
+                                            const std::pair<fr, index_t>& committed_low_value,
+                                            const RequestContext& requestContext) const;
+
     /**
      * @brief Returns the leaf at the provided index, if one exists
      */
@@ -111,6 +147,18 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
      */
     bool get_cached_node_by_index(uint32_t level, const index_t& index, fr& data) const;
 
+    /**
+     * @brief Writes the provided nodes at the given level, by both index and hash, under a single lock
+     */
+    void put_cached_nodes(uint32_t level, const std::vector<NodeWrite>& nodes);
+
+    /**
+     * @brief Returns the cached nodes at the given level for each of the provided indices, under a single lock
+     */
+    void get_cached_nodes_by_index(uint32_t level,
+                                   const std::vector<index_t>& indices,
+                                   std::vector<std::optional<fr>>& nodes) const;
+
     /**
      * @brief Writes the provided meta data to uncommitted state
      */
@@ -177,6 +225,8 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
 
     void put_leaf_by_hash(const fr& leaf_hash, const IndexedLeafValueType& leafPreImage);
 
+    void put_leaves_by_hash(const std::vector<std::pair<fr, IndexedLeafValueType>>& leaves);
+
     std::optional<IndexedLeafValueType> get_cached_leaf_by_index(const index_t& index) const;
 
     void put_cached_leaf_by_index(const index_t& index, const IndexedLeafValueType& leafPreImage);
@@ -195,6 +245,12 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
     void revert_checkpoint();
     void commit_checkpoint();
 
+    /**
+     * @brief Returns the state this fork was initialised from. Only valid for a store created from a block and before
+     * any changes have been made to it
+     */
+    ForkSnapshot get_fork_snapshot() const;
+
   private:
     using Cache = ContentAddressedCache<LeafValueType>;
 
@@ -267,6 +323,28 @@ ContentAddressedCachedTreeStore<LeafValueType>::ContentAddressedCachedTreeStore(
     initialise_from_block(referenceBlockNumber);
 }
 
+template <typename LeafValueType>
+ContentAddressedCachedTreeStore<LeafValueType>::ContentAddressedCachedTreeStore(std::string name,
+                                                                                uint32_t levels,
+                                                                                const ForkSnapshot& snapshot,
+                                                                                PersistedStoreType::SharedPtr dataStore)
+    : forkConstantData_{ .name_ = (std::move(name)), .depth_ = levels, .initialised_from_block_ = snapshot.block }
+    , dataStore_(dataStore)
+    , cache_(levels)
+{
+    // The snapshot has already been validated against the persisted meta data, there is nothing to read
+    cache_.put_meta(snapshot.meta);
+}
+
+template <typename LeafValueType> ForkSnapshot ContentAddressedCachedTreeStore<LeafValueType>::get_fork_snapshot() const
+{
+    if (!forkConstantData_.initialised_from_block_.has_value()) {
+        throw std::runtime_error(format("Unable to snapshot tree ", forkConstantData_.name_, ", not a fork"));
+    }
+    std::unique_lock lock(mtx_);
+    return ForkSnapshot{ .block = forkConstantData_.initialised_from_block_.value(), .meta = cache_.get_meta() };
+}
+
 // Much Like the commit/rollback/set finalised/remove historic blocks apis
 // These 3 apis (checkpoint/revert_checkpoint/commit_checkpoint) all assume they are not called
 // during the process of reading/writing uncommitted state
@@ -344,7 +422,13 @@ template <typename LeafValueType>
 std::pair<bool, index_t> ContentAddressedCachedTreeStore<LeafValueType>::find_low_value(
     const fr& new_leaf_key, const RequestContext& requestContext, ReadTransaction& tx) const
 {
-    auto new_value_as_number = uint256_t(new_leaf_key);
+    return find_low_value(new_leaf_key, find_committed_low_value(new_leaf_key, requestContext, tx), requestContext);
+}
+
+template <typename LeafValueType>
+std::pair<fr, index_t> ContentAddressedCachedTreeStore<LeafValueType>::find_committed_low_value(
+    const fr& new_leaf_key, const RequestContext& requestContext, ReadTransaction& tx) const
+{
     index_t committed = 0;
 
     // We first read committed data, so we must constrin the search to only the data committed from our perspective
@@ -353,8 +437,18 @@ std::pair<bool, index_t> ContentAddressedCachedTreeStore<LeafValueType>::find_lo
     std::optional<index_t> sizeLimit = constrain_tree_size_to_only_committed(requestContext, tx);
 
     fr found_key = dataStore_->find_low_leaf(new_leaf_key, committed, sizeLimit, tx);
-    index_t db_index = committed;
-    uint256_t retrieved_value = found_key;
+    return std::make_pair(found_key, committed);
+}
+
+template <typename LeafValueType>
+std::pair<bool, index_t> ContentAddressedCachedTreeStore<LeafValueType>::find_low_value(
+    const fr& new_leaf_key,
+    const std::pair<fr, index_t>& committed_low_value,
+    const RequestContext& requestContext) const
+{
+    auto new_value_as_number = uint256_t(new_leaf_key);
+    index_t db_index = committed_low_value.second;
+    uint256_t retrieved_value = committed_low_value.first;
 
     // If we already found the leaf then return it.
     bool already_present = retrieved_value == new_value_as_number;
@@ -386,7 +480,7 @@ ContentAddressedCachedTreeStore<LeafValueType>::get_leaf_by_hash(const fr& leaf_
             return leafData;
         }
     }
-    if (dataStore_->read_leaf_by_hash(leaf_hash, leafData, tx)) {
+    if (dataStore_->read_cached_leaf_by_hash(leaf_hash, leafData, tx)) {
         return leafData;
     }
     return std::nullopt;
@@ -401,6 +495,17 @@ void ContentAddressedCachedTreeStore<LeafValueType>::put_leaf_by_hash(const fr&
     cache_.put_leaf_preimage_by_hash(leaf_hash, leafPreImage);
 }
 
+template <typename LeafValueType>
+void ContentAddressedCachedTreeStore<LeafValueType>::put_leaves_by_hash(
+    const std::vector<std::pair<fr, IndexedLeafValueType>>& leaves)
+{
+    // Accessing the cache under a lock
+    std::unique_lock lock(mtx_);
+    for (const auto& [leaf_hash, leafPreImage] : leaves) {
+        cache_.put_leaf_preimage_by_hash(leaf_hash, leafPreImage);
+    }
+}
+
 template <typename LeafValueType>
 std::optional<typename ContentAddressedCachedTreeStore<LeafValueType>::IndexedLeafValueType>
 ContentAddressedCachedTreeStore<LeafValueType>::get_cached_leaf_by_index(const index_t& index) const
@@ -509,7 +614,7 @@ bool ContentAddressedCachedTreeStore<LeafValueType>::get_node_by_hash(const fr&
             return true;
         }
     }
-    return dataStore_->read_node(nodeHash, payload, transaction);
+    return dataStore_->read_cached_node(nodeHash, payload, transaction);
 }
 
 template <typename LeafValueType>
@@ -544,6 +649,30 @@ bool ContentAddressedCachedTreeStore<LeafValueType>::get_cached_node_by_index(ui
     return false;
 }
 
+template <typename LeafValueType>
+void ContentAddressedCachedTreeStore<LeafValueType>::put_cached_nodes(uint32_t level,
+                                                                      const std::vector<NodeWrite>& nodes)
+{
+    // Accessing the cache under a lock
+    std::unique_lock lock(mtx_);
+    for (const NodeWrite& node : nodes) {
+        cache_.put_node_by_index(level, node.index, node.hash);
+        cache_.put_node(node.hash, node.payload);
+    }
+}
+
+template <typename LeafValueType>
+void ContentAddressedCachedTreeStore<LeafValueType>::get_cached_nodes_by_index(
+    uint32_t level, const std::vector<index_t>& indices, std::vector<std::optional<fr>>& nodes) const
+{
+    nodes.resize(indices.size());
+    // Accessing the cache under a lock
+    std::unique_lock lock(mtx_);
+    for (size_t i = 0; i < indices.size(); ++i) {
+        nodes[i] = cache_.get_node_by_index(level, indices[i]);
+    }
+}
+
 template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValueType>::put_meta(const TreeMeta& m)
 {
     // Accessing the cache under a lock
@@ -65,6 +65,34 @@ const std::string LEAF_PREIMAGES_DB = "leaf preimages";
 const std::string LEAF_INDICES_DB = "leaf indices";
 const std::string BLOCK_INDICES_DB = "block indices";
 
+struct CacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t numItems = 0;
+    uint64_t capacity = 0;
+
+    MSGPACK_FIELDS(hits, misses, numItems, capacity)
+
+    bool operator==(const CacheStats& other) const
+    {
+        return hits == other.hits && misses == other.misses && numItems == other.numItems &&
+               capacity == other.capacity;
+    }
+
+    double hit_ratio() const
+    {
+        uint64_t lookups = hits + misses;
+        return lookups == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(lookups);
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const CacheStats& stats)
+    {
+        os << "Hits: " << stats.hits << ", Misses: " << stats.misses << ", Hit Ratio: " << stats.hit_ratio()
+           << ", Items: " << stats.numItems << ", Capacity: " << stats.capacity;
+        return os;
+    }
+};
+
 struct TreeDBStats {
     uint64_t mapSize;
     uint64_t physicalFileSize;
@@ -73,6 +101,8 @@ struct TreeDBStats {
     DBStats leafPreimagesDBStats;
     DBStats leafIndicesDBStats;
     DBStats blockIndicesDBStats;
+    CacheStats nodesCacheStats;
+    CacheStats leafPreimagesCacheStats;
 
     TreeDBStats() = default;
     TreeDBStats(uint64_t mapSize, uint64_t physicalFileSize)
@@ -105,14 +135,17 @@ struct TreeDBStats {
                    nodesDBStats,
                    leafPreimagesDBStats,
                    leafIndicesDBStats,
-                   blockIndicesDBStats)
+                   blockIndicesDBStats,
+                   nodesCacheStats,
+                   leafPreimagesCacheStats)
 
     bool operator==(const TreeDBStats& other) const
     {
         return mapSize == other.mapSize && physicalFileSize == other.physicalFileSize &&
                blocksDBStats == other.blocksDBStats && nodesDBStats == other.nodesDBStats &&
                leafPreimagesDBStats == other.leafPreimagesDBStats && leafIndicesDBStats == other.leafIndicesDBStats &&
-               blockIndicesDBStats == other.blockIndicesDBStats;
+               blockIndicesDBStats == other.blockIndicesDBStats && nodesCacheStats == other.nodesCacheStats &&
+               leafPreimagesCacheStats == other.leafPreimagesCacheStats;
     }
 
     TreeDBStats& operator=(TreeDBStats&& other) noexcept
@@ -125,6 +158,8 @@ struct TreeDBStats {
             leafPreimagesDBStats = std::move(other.leafPreimagesDBStats);
             leafIndicesDBStats = std::move(other.leafIndicesDBStats);
             blockIndicesDBStats = std::move(other.blockIndicesDBStats);
+            nodesCacheStats = other.nodesCacheStats;
+            leafPreimagesCacheStats = other.leafPreimagesCacheStats;
         }
         return *this;
     }
@@ -136,7 +171,8 @@ struct TreeDBStats {
         os << "Map Size: " << stats.mapSize << ", Physical File Size: " << stats.physicalFileSize << " Blocks DB "
            << stats.blocksDBStats << ", Nodes DB " << stats.nodesDBStats << ", Leaf Pre-images DB "
            << stats.leafPreimagesDBStats << ", Leaf Indices DB " << stats.leafIndicesDBStats << ", Block Indices DB "
-           << stats.blockIndicesDBStats;
+           << stats.blockIndicesDBStats << ", Nodes Cache " << stats.nodesCacheStats << ", Leaf Pre-images Cache "
+           << stats.leafPreimagesCacheStats;
         return os;
     }
 };
@@ -5,6 +5,7 @@
 // =====================
 
 #include "fr.hpp"
+#include "barretenberg/ecc/fields/field_vec.hpp"
 #include <benchmark/benchmark.h>
 
 using namespace benchmark;
@@ -453,5 +454,65 @@ void hash_bench(State& state) noexcept
 }
 BENCHMARK(hash_bench);
 
+/**
+ * @brief Bulk kernels of field_vec, over vectors of BULK_SIZE elements, for each backend (0: scalar, 1: avx2,
+ * 2: avx512). Backends that the CPU does not support are skipped.
+ */
+constexpr size_t BULK_SIZE = 1 << 16;
+
+template <typename Kernel> void bulk_bench(State& state, Kernel&& kernel) noexcept
+{
+    const auto backend = static_cast<field_vec::Backend>(state.range(0));
+    if (!field_vec::is_backend_supported(backend)) {
+        state.SkipWithError("backend not supported by this CPU");
+        return;
+    }
+    const field_vec::Backend previous_backend = field_vec::get_backend();
+    field_vec::set_backend(backend);
+
+    std::span<const fr> a(oldx.data(), BULK_SIZE);
+    std::span<const fr> b(oldy.data(), BULK_SIZE);
+    std::span<const fr> c(oldx.data() + BULK_SIZE, BULK_SIZE);
+    std::vector<fr> out(BULK_SIZE);
+    for (auto _ : state) {
+        kernel(std::span<fr>(out), a, b, c);
+        DoNotOptimize(out.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(BULK_SIZE));
+    state.SetLabel(std::string(field_vec::backend_name(backend)));
+    field_vec::set_backend(previous_backend);
+}
+
+void add_vec_bench(State& state) noexcept
+{
+    bulk_bench(state, [](auto out, auto a, auto b, auto) { field_vec::add_vec<fr>(out, a, b); });
+}
+BENCHMARK(add_vec_bench)->DenseRange(0, 2);
+
+void sub_vec_bench(State& state) noexcept
+{
+    bulk_bench(state, [](auto out, auto a, auto b, auto) { field_vec::sub_vec<fr>(out, a, b); });
+}
+BENCHMARK(sub_vec_bench)->DenseRange(0, 2);
+
+void mul_vec_bench(State& state) noexcept
+{
+    bulk_bench(state, [](auto out, auto a, auto b, auto) { field_vec::mul_vec<fr>(out, a, b); });
+}
+BENCHMARK(mul_vec_bench)->DenseRange(0, 2);
+
+void fma_vec_bench(State& state) noexcept
+{
+    bulk_bench(state, [](auto out, auto a, auto b, auto c) { field_vec::fma_vec<fr>(out, a, b, c); });
+}
+BENCHMARK(fma_vec_bench)->DenseRange(0, 2);
+
+void fold_vec_bench(State& state) noexcept
+{
+    bulk_bench(state, [](auto out, auto a, auto b, auto) { field_vec::fold_vec<fr>(out, a, b, accz); });
+}
+BENCHMARK(fold_vec_bench)->DenseRange(0, 2);
+
 // NOLINTNEXTLINE macro invokation triggers style guideline errors from googletest code
 BENCHMARK_MAIN();
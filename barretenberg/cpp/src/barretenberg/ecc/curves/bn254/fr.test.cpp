@@ -361,6 +361,35 @@ TEST(fr, BatchInvert)
     }
 }
 
+TEST(fr, BatchInvertSkipsZeroes)
+{
+    // Sizes below and above the minimum chunk size, the latter split into several chunks when threads are available.
+    for (size_t n : { 0UL, 1UL, 7UL, 3000UL }) {
+        std::vector<fr> coeffs(n);
+        for (size_t i = 0; i < n; ++i) {
+            coeffs[i] = (i % 3 == 1) ? fr::zero() : fr::random_element();
+            if (i % 7 == 2) {
+                // Zero in the non-canonical representation p
+                coeffs[i] = fr{ fr::modulus.data[0], fr::modulus.data[1], fr::modulus.data[2], fr::modulus.data[3] };
+            }
+        }
+        std::vector<fr> sequential = coeffs;
+        std::vector<fr> parallel = coeffs;
+        fr::batch_invert(sequential);
+        fr::parallel_batch_invert(parallel, /*min_chunk_size=*/100);
+
+        for (size_t i = 0; i < n; ++i) {
+            if (coeffs[i].is_zero()) {
+                EXPECT_EQ(sequential[i], coeffs[i]);
+                EXPECT_EQ(parallel[i], coeffs[i]);
+            } else {
+                EXPECT_EQ(sequential[i] * coeffs[i], fr::one());
+                EXPECT_EQ(parallel[i], sequential[i]);
+            }
+        }
+    }
+}
+
 TEST(fr, MultiplicativeGenerator)
 {
     EXPECT_EQ(fr::multiplicative_generator(), fr(5));
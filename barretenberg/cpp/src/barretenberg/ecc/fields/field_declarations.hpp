@@ -338,6 +338,15 @@ template <class Params_> struct alignas(32) field {
     constexpr field invert() const noexcept;
     static void batch_invert(std::span<field> coeffs) noexcept;
     static void batch_invert(field* coeffs, size_t n) noexcept;
+    /**
+     * @brief Multithreaded batch_invert: inverts every nonzero element of coeffs in place, zeroes are left untouched.
+     * @details The span is split into at most one chunk per thread, each at least min_chunk_size long. The chunk
+     * products are themselves batch inverted, so the whole span costs a single field inversion. Uses parallel_for,
+     * hence must not be called from within a parallel_for (use batch_invert there).
+     */
+    static constexpr size_t DEFAULT_BATCH_INVERT_CHUNK_SIZE = 1 << 12;
+    static void parallel_batch_invert(std::span<field> coeffs,
+                                      size_t min_chunk_size = DEFAULT_BATCH_INVERT_CHUNK_SIZE) noexcept;
     /**
      * @brief Compute square root of the field element.
      *
@@ -7,6 +7,7 @@
 #pragma once
 #include "barretenberg/common/op_count.hpp"
 #include "barretenberg/common/slab_allocator.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
@@ -405,6 +406,40 @@ template <class T> constexpr field<T> field<T>::invert() const noexcept
     return pow(modulus_minus_two);
 }
 
+namespace field_batch_invert_detail {
+
+// Forward pass of Montgomery's trick, skipping zeroes. temporaries[i] receives the product of the nonzero elements of
+// coeffs[0..i) and the product of all nonzero elements is returned.
+// Note: zero skipping keeps its branch. Making it branch-free (multiplying by one instead) costs a field multiplication
+// per zero, which is more than the mispredictions it avoids even on randomly scattered zeroes.
+template <typename Field> Field prefix_products(std::span<const Field> coeffs, Field* temporaries) noexcept
+{
+    Field accumulator = Field::one();
+    for (size_t i = 0; i < coeffs.size(); ++i) {
+        temporaries[i] = accumulator;
+        if (!coeffs[i].is_zero()) {
+            accumulator *= coeffs[i];
+        }
+    }
+    return accumulator;
+}
+
+// Backward pass of Montgomery's trick, given the inverse of the value returned by prefix_products. Whether an element
+// was skipped is recomputed rather than stored, saving a flag array as large as the input.
+template <typename Field>
+void invert_from_prefix_products(std::span<Field> coeffs, const Field* temporaries, Field accumulator) noexcept
+{
+    for (size_t i = coeffs.size() - 1; i < coeffs.size(); --i) {
+        if (!coeffs[i].is_zero()) {
+            const Field inverse = accumulator * temporaries[i];
+            accumulator *= coeffs[i];
+            coeffs[i] = inverse;
+        }
+    }
+}
+
+} // namespace field_batch_invert_detail
+
 template <class T> void field<T>::batch_invert(field* coeffs, const size_t n) noexcept
 {
     batch_invert(std::span{ coeffs, n });
@@ -417,47 +452,44 @@ template <class T> void field<T>::batch_invert(std::span<field> coeffs) noexcept
     const size_t n = coeffs.size();
 
     auto temporaries_ptr = std::static_pointer_cast<field[]>(get_mem_slab(n * sizeof(field)));
-    auto skipped_ptr = std::static_pointer_cast<bool[]>(get_mem_slab(n));
-    auto temporaries = temporaries_ptr.get();
-    auto* skipped = skipped_ptr.get();
+    auto* temporaries = temporaries_ptr.get();
 
-    field accumulator = one();
-    for (size_t i = 0; i < n; ++i) {
-        temporaries[i] = accumulator;
-        if (coeffs[i].is_zero()) {
-            skipped[i] = true;
-        } else {
-            skipped[i] = false;
-            accumulator *= coeffs[i];
-        }
-    }
+    const field product = field_batch_invert_detail::prefix_products<field>(coeffs, temporaries);
+    field_batch_invert_detail::invert_from_prefix_products<field>(coeffs, temporaries, product.invert());
+}
 
-    // std::vector<field> temporaries;
-    // std::vector<bool> skipped;
-    // temporaries.reserve(n);
-    // skipped.reserve(n);
-
-    // field accumulator = one();
-    // for (size_t i = 0; i < n; ++i) {
-    //     temporaries.emplace_back(accumulator);
-    //     if (coeffs[i].is_zero()) {
-    //         skipped.emplace_back(true);
-    //     } else {
-    //         skipped.emplace_back(false);
-    //         accumulator *= coeffs[i];
-    //     }
-    // }
-
-    accumulator = accumulator.invert();
-
-    field T0;
-    for (size_t i = n - 1; i < n; --i) {
-        if (!skipped[i]) {
-            T0 = accumulator * temporaries[i];
-            accumulator *= coeffs[i];
-            coeffs[i] = T0;
-        }
+template <class T>
+void field<T>::parallel_batch_invert(std::span<field> coeffs, const size_t min_chunk_size) noexcept
+{
+    PROFILE_THIS_NAME("fr::parallel_batch_invert");
+    const size_t n = coeffs.size();
+    const size_t num_chunks = calculate_num_threads(n, std::max(min_chunk_size, size_t(1)));
+    if (num_chunks <= 1) {
+        batch_invert(coeffs);
+        return;
     }
+
+    auto temporaries_ptr = std::static_pointer_cast<field[]>(get_mem_slab(n * sizeof(field)));
+    auto* temporaries = temporaries_ptr.get();
+    std::vector<field> chunk_products(num_chunks);
+    const auto chunk = [&](size_t chunk_idx) {
+        const size_t start = (n * chunk_idx) / num_chunks;
+        const size_t end = (n * (chunk_idx + 1)) / num_chunks;
+        return std::pair{ start, end };
+    };
+
+    parallel_for(num_chunks, [&](size_t chunk_idx) {
+        const auto [start, end] = chunk(chunk_idx);
+        chunk_products[chunk_idx] =
+            field_batch_invert_detail::prefix_products<field>(coeffs.subspan(start, end - start), &temporaries[start]);
+    });
+    // Chunk products are nonzero by construction: invert all of them with a single inversion.
+    batch_invert(chunk_products);
+    parallel_for(num_chunks, [&](size_t chunk_idx) {
+        const auto [start, end] = chunk(chunk_idx);
+        field_batch_invert_detail::invert_from_prefix_products<field>(
+            coeffs.subspan(start, end - start), &temporaries[start], chunk_products[chunk_idx]);
+    });
 }
 
 /**
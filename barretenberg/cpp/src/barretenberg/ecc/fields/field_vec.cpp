@@ -0,0 +1,120 @@
+#include "barretenberg/ecc/fields/field_vec.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/ecc/fields/field_vec_simd.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <string>
+
+namespace bb::field_vec {
+namespace {
+
+Backend best_supported_backend()
+{
+    if (is_backend_supported(Backend::AVX512)) {
+        return Backend::AVX512;
+    }
+    if (is_backend_supported(Backend::AVX2)) {
+        return Backend::AVX2;
+    }
+    return Backend::SCALAR;
+}
+
+Backend initial_backend()
+{
+    const char* name = std::getenv("BB_FIELD_VEC_BACKEND");
+    if (name == nullptr) {
+        return best_supported_backend();
+    }
+    for (Backend backend : { Backend::SCALAR, Backend::AVX2, Backend::AVX512 }) {
+        if (backend_name(backend) == name) {
+            if (is_backend_supported(backend)) {
+                return backend;
+            }
+            info("BB_FIELD_VEC_BACKEND=", name, " is not supported by this CPU, ignoring it.");
+            return best_supported_backend();
+        }
+    }
+    info("Unknown BB_FIELD_VEC_BACKEND=", name, ", expected scalar, avx2 or avx512.");
+    return best_supported_backend();
+}
+
+std::atomic<Backend>& current_backend()
+{
+    static std::atomic<Backend> backend = initial_backend();
+    return backend;
+}
+
+} // namespace
+
+bool is_backend_supported(Backend backend)
+{
+    switch (backend) {
+    case Backend::SCALAR:
+        return true;
+#if BB_FIELD_VEC_HAS_X86_KERNELS
+    case Backend::AVX2:
+        return __builtin_cpu_supports("avx2") != 0;
+    case Backend::AVX512:
+        return __builtin_cpu_supports("avx512f") != 0 && __builtin_cpu_supports("avx512ifma") != 0;
+#endif
+    default:
+        return false;
+    }
+}
+
+Backend get_backend()
+{
+    return current_backend().load(std::memory_order_relaxed);
+}
+
+void set_backend(Backend backend)
+{
+    if (!is_backend_supported(backend)) {
+        throw_or_abort("field_vec: " + std::string(backend_name(backend)) + " is not supported by this CPU.");
+    }
+    current_backend().store(backend, std::memory_order_relaxed);
+}
+
+std::string_view backend_name(Backend backend)
+{
+    switch (backend) {
+    case Backend::SCALAR:
+        return "scalar";
+    case Backend::AVX2:
+        return "avx2";
+    case Backend::AVX512:
+        return "avx512";
+    }
+    return "unknown";
+}
+
+namespace detail {
+
+void run_simd(Backend backend,
+              Op op,
+              const Modulus& modulus,
+              uint64_t* out,
+              const uint64_t* a,
+              const uint64_t* b,
+              const uint64_t* c,
+              const uint64_t* u,
+              size_t n)
+{
+    switch (backend) {
+#if BB_FIELD_VEC_HAS_X86_KERNELS
+    case Backend::AVX2:
+        run_avx2(op, modulus, out, a, b, c, u, n);
+        return;
+    case Backend::AVX512:
+        run_avx512(op, modulus, out, a, b, c, u, n);
+        return;
+#endif
+    default:
+        throw_or_abort("field_vec: no SIMD kernels for backend " + std::string(backend_name(backend)));
+    }
+}
+
+} // namespace detail
+} // namespace bb::field_vec
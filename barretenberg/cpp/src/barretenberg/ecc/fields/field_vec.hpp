@@ -0,0 +1,212 @@
+#pragma once
+
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/ecc/fields/field.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+/**
+ * @brief Bulk field arithmetic over vectors of field elements.
+ *
+ * @details The single element operations of field<T> are already optimised (see field_impl_x64.hpp), but a loop over
+ * them processes one element at a time. These kernels process several elements at once in SIMD registers, using a
+ * "multi-lane" layout: the elements of a block are transposed so that each register holds the same limb of
+ * LANES different elements.
+ *  - AVX-512 (with IFMA): 8 lanes of 5 52-bit limbs, the limb products are computed with 52x52->104-bit multiply-adds.
+ *    The Montgomery multiplication uses R = 2^260 internally, and pre-multiplies one operand by 2^4 so that inputs and
+ *    outputs stay in the Montgomery form of the field class (R = 2^256).
+ *  - AVX2: 4 lanes of 5 52-bit limbs, for the additive kernels only. Multiplicative kernels fall back to the scalar
+ *    loops, which are as fast as an AVX2 Montgomery multiplication.
+ * Inputs and outputs are in the coarse [0, 2p) range, like the results of the scalar operations.
+ *
+ * The backend is selected at runtime from the CPU features (or with the BB_FIELD_VEC_BACKEND environment variable set
+ * to "scalar", "avx2" or "avx512"). The SIMD backends only support the moduli of less than 254 bits, i.e. bn254 and
+ * grumpkin fields; every other field, and every other platform, uses the scalar loops.
+ *
+ * The output of each kernel may alias one of its inputs exactly, but it must not partially overlap them.
+ */
+namespace bb::field_vec {
+
+enum class Backend : uint8_t { SCALAR, AVX2, AVX512 };
+
+bool is_backend_supported(Backend backend);
+// The backend used by the kernels below.
+Backend get_backend();
+// Overrides the backend (e.g. for benchmarks and tests). The backend must be supported.
+void set_backend(Backend backend);
+std::string_view backend_name(Backend backend);
+
+namespace detail {
+
+enum class Op : uint8_t { ADD, SUB, MUL, FMA, SCALE, ADD_SCALED, FOLD };
+
+// Whether `backend` has a SIMD kernel for `op`.
+constexpr bool has_kernel(Backend backend, Op op)
+{
+    return backend == Backend::AVX512 || (backend == Backend::AVX2 && (op == Op::ADD || op == Op::SUB));
+}
+
+// Vectors of fewer elements are not worth transposing.
+constexpr size_t MIN_SIMD_SIZE = 16;
+
+// The parameters of a field modulus needed by the SIMD kernels.
+struct Modulus {
+    uint64_t limbs[4]; // NOLINT(cppcoreguidelines-avoid-c-arrays)
+    uint64_t r_inv;
+};
+
+template <typename Fr>
+concept HasSimdKernels = requires { typename Fr::Params; } && std::same_as<Fr, field<typename Fr::Params>> &&
+                         (Fr::modulus.data[3] < 0x4000000000000000ULL) && (Fr::modulus.data[3] != 0);
+
+/**
+ * @brief Runs `op` over n elements with a SIMD backend, on the raw (Montgomery form) limbs of the elements.
+ *
+ * @param u Pointer to a single element, the scalar of SCALE, ADD_SCALED and FOLD.
+ */
+void run_simd(Backend backend,
+              Op op,
+              const Modulus& modulus,
+              uint64_t* out,
+              const uint64_t* a,
+              const uint64_t* b,
+              const uint64_t* c,
+              const uint64_t* u,
+              size_t n);
+
+/**
+ * @brief Runs `op` with a SIMD backend if the field and the current backend allow it.
+ * @return false if the caller has to run the scalar loop instead.
+ */
+template <typename Fr>
+bool try_run_simd([[maybe_unused]] Op op,
+                  [[maybe_unused]] Fr* out,
+                  [[maybe_unused]] const Fr* a,
+                  [[maybe_unused]] const Fr* b,
+                  [[maybe_unused]] const Fr* c,
+                  [[maybe_unused]] const Fr* u,
+                  [[maybe_unused]] size_t n)
+{
+    if constexpr (HasSimdKernels<Fr>) {
+        static_assert(sizeof(Fr) == 4 * sizeof(uint64_t));
+        static constexpr Modulus MODULUS{ { Fr::modulus.data[0],
+                                            Fr::modulus.data[1],
+                                            Fr::modulus.data[2],
+                                            Fr::modulus.data[3] },
+                                          Fr::Params::r_inv };
+        if (n < MIN_SIMD_SIZE) {
+            return false;
+        }
+        const Backend backend = get_backend();
+        if (!has_kernel(backend, op)) {
+            return false;
+        }
+        auto limbs = [](const Fr* element) { return element == nullptr ? nullptr : &element->data[0]; };
+        run_simd(backend, op, MODULUS, &out->data[0], limbs(a), limbs(b), limbs(c), limbs(u), n);
+        return true;
+    } else {
+        return false;
+    }
+}
+
+} // namespace detail
+
+// out[i] = a[i] + b[i]
+template <typename Fr> void add_vec(std::span<Fr> out, std::span<const Fr> a, std::span<const Fr> b)
+{
+    BB_ASSERT_EQ(a.size(), out.size());
+    BB_ASSERT_EQ(b.size(), out.size());
+    if (detail::try_run_simd<Fr>(detail::Op::ADD, out.data(), a.data(), b.data(), nullptr, nullptr, out.size())) {
+        return;
+    }
+    for (size_t i = 0; i < out.size(); ++i) {
+        out[i] = a[i] + b[i];
+    }
+}
+
+// out[i] = a[i] - b[i]
+template <typename Fr> void sub_vec(std::span<Fr> out, std::span<const Fr> a, std::span<const Fr> b)
+{
+    BB_ASSERT_EQ(a.size(), out.size());
+    BB_ASSERT_EQ(b.size(), out.size());
+    if (detail::try_run_simd<Fr>(detail::Op::SUB, out.data(), a.data(), b.data(), nullptr, nullptr, out.size())) {
+        return;
+    }
+    for (size_t i = 0; i < out.size(); ++i) {
+        out[i] = a[i] - b[i];
+    }
+}
+
+// out[i] = a[i] * b[i]
+template <typename Fr> void mul_vec(std::span<Fr> out, std::span<const Fr> a, std::span<const Fr> b)
+{
+    BB_ASSERT_EQ(a.size(), out.size());
+    BB_ASSERT_EQ(b.size(), out.size());
+    if (detail::try_run_simd<Fr>(detail::Op::MUL, out.data(), a.data(), b.data(), nullptr, nullptr, out.size())) {
+        return;
+    }
+    for (size_t i = 0; i < out.size(); ++i) {
+        out[i] = a[i] * b[i];
+    }
+}
+
+// out[i] = a[i] * b[i] + c[i]
+template <typename Fr>
+void fma_vec(std::span<Fr> out, std::span<const Fr> a, std::span<const Fr> b, std::span<const Fr> c)
+{
+    BB_ASSERT_EQ(a.size(), out.size());
+    BB_ASSERT_EQ(b.size(), out.size());
+    BB_ASSERT_EQ(c.size(), out.size());
+    if (detail::try_run_simd<Fr>(detail::Op::FMA, out.data(), a.data(), b.data(), c.data(), nullptr, out.size())) {
+        return;
+    }
+    for (size_t i = 0; i < out.size(); ++i) {
+        out[i] = a[i] * b[i] + c[i];
+    }
+}
+
+// out[i] = u * a[i]
+template <typename Fr> void scale_vec(std::span<Fr> out, std::span<const Fr> a, const Fr& u)
+{
+    BB_ASSERT_EQ(a.size(), out.size());
+    if (detail::try_run_simd<Fr>(detail::Op::SCALE, out.data(), a.data(), nullptr, nullptr, &u, out.size())) {
+        return;
+    }
+    for (size_t i = 0; i < out.size(); ++i) {
+        out[i] = u * a[i];
+    }
+}
+
+// out[i] = a[i] + u * b[i]
+template <typename Fr> void add_scaled_vec(std::span<Fr> out, std::span<const Fr> a, const Fr& u, std::span<const Fr> b)
+{
+    BB_ASSERT_EQ(a.size(), out.size());
+    BB_ASSERT_EQ(b.size(), out.size());
+    if (detail::try_run_simd<Fr>(detail::Op::ADD_SCALED, out.data(), a.data(), b.data(), nullptr, &u, out.size())) {
+        return;
+    }
+    for (size_t i = 0; i < out.size(); ++i) {
+        out[i] = a[i] + u * b[i];
+    }
+}
+
+/**
+ * @brief out[i] = a[i] + u * (b[i] - a[i]), the linear interpolation used to fold multilinear polynomials (partial
+ * evaluation in sumcheck, Gemini folds...).
+ */
+template <typename Fr> void fold_vec(std::span<Fr> out, std::span<const Fr> a, std::span<const Fr> b, const Fr& u)
+{
+    BB_ASSERT_EQ(a.size(), out.size());
+    BB_ASSERT_EQ(b.size(), out.size());
+    if (detail::try_run_simd<Fr>(detail::Op::FOLD, out.data(), a.data(), b.data(), nullptr, &u, out.size())) {
+        return;
+    }
+    for (size_t i = 0; i < out.size(); ++i) {
+        out[i] = a[i] + u * (b[i] - a[i]);
+    }
+}
+
+} // namespace bb::field_vec
@@ -0,0 +1,108 @@
+#include "barretenberg/ecc/fields/field_vec.hpp"
+#include "barretenberg/ecc/curves/bn254/fq.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/ecc/curves/secp256k1/secp256k1.hpp"
+
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace bb;
+
+namespace {
+
+template <typename FF> class FieldVecTest : public ::testing::Test {
+  public:
+    void TearDown() override { field_vec::set_backend(initial_backend); }
+
+    // Random elements, some of them in the coarse [p, 2p) range when the field uses it.
+    static std::vector<FF> random_elements(size_t size)
+    {
+        std::vector<FF> result(size);
+        for (size_t i = 0; i < size; ++i) {
+            result[i] = FF::random_element().reduce_once();
+            if (FF::modulus.data[3] < 0x4000000000000000ULL && i % 3 == 0) {
+                const auto& limbs = result[i].data;
+                const uint256_t coarse = uint256_t(limbs[0], limbs[1], limbs[2], limbs[3]) + FF::modulus;
+                result[i] = FF{ coarse.data[0], coarse.data[1], coarse.data[2], coarse.data[3] };
+            }
+        }
+        return result;
+    }
+
+    static std::vector<field_vec::Backend> supported_backends()
+    {
+        std::vector<field_vec::Backend> result;
+        for (auto backend : { field_vec::Backend::SCALAR, field_vec::Backend::AVX2, field_vec::Backend::AVX512 }) {
+            if (field_vec::is_backend_supported(backend)) {
+                result.push_back(backend);
+            }
+        }
+        return result;
+    }
+
+  private:
+    field_vec::Backend initial_backend = field_vec::get_backend();
+};
+
+using FieldTypes = ::testing::Types<bb::fr, bb::fq, secp256k1::fq>;
+
+TYPED_TEST_SUITE(FieldVecTest, FieldTypes);
+
+} // namespace
+
+TYPED_TEST(FieldVecTest, MatchesScalarOperations)
+{
+    using FF = TypeParam;
+    // Covers empty inputs, inputs below the SIMD threshold and partial SIMD blocks.
+    for (size_t size : { 0UL, 5UL, 16UL, 37UL, 1000UL }) {
+        const auto a = TestFixture::random_elements(size);
+        const auto b = TestFixture::random_elements(size);
+        const auto c = TestFixture::random_elements(size);
+        const FF u = FF::random_element();
+        for (auto backend : TestFixture::supported_backends()) {
+            field_vec::set_backend(backend);
+            std::vector<FF> out(size);
+            auto check = [&](const char* op, auto expected) {
+                for (size_t i = 0; i < size; ++i) {
+                    EXPECT_EQ(out[i], expected(i)) << op << " " << field_vec::backend_name(backend) << " " << i;
+                }
+            };
+            field_vec::add_vec<FF>(out, a, b);
+            check("add", [&](size_t i) { return a[i] + b[i]; });
+            field_vec::sub_vec<FF>(out, a, b);
+            check("sub", [&](size_t i) { return a[i] - b[i]; });
+            field_vec::mul_vec<FF>(out, a, b);
+            check("mul", [&](size_t i) { return a[i] * b[i]; });
+            field_vec::fma_vec<FF>(out, a, b, c);
+            check("fma", [&](size_t i) { return (a[i] * b[i]) + c[i]; });
+            field_vec::scale_vec<FF>(out, a, u);
+            check("scale", [&](size_t i) { return u * a[i]; });
+            field_vec::add_scaled_vec<FF>(out, a, u, b);
+            check("add_scaled", [&](size_t i) { return a[i] + (u * b[i]); });
+            field_vec::fold_vec<FF>(out, a, b, u);
+            check("fold", [&](size_t i) { return a[i] + (u * (b[i] - a[i])); });
+        }
+    }
+}
+
+TYPED_TEST(FieldVecTest, InPlace)
+{
+    using FF = TypeParam;
+    constexpr size_t SIZE = 100;
+    const auto a = TestFixture::random_elements(SIZE);
+    const auto b = TestFixture::random_elements(SIZE);
+    const FF u = FF::random_element();
+    for (auto backend : TestFixture::supported_backends()) {
+        field_vec::set_backend(backend);
+        std::vector<FF> out = a;
+        field_vec::fold_vec<FF>(out, out, b, u);
+        for (size_t i = 0; i < SIZE; ++i) {
+            EXPECT_EQ(out[i], a[i] + (u * (b[i] - a[i])));
+        }
+        out = b;
+        field_vec::sub_vec<FF>(out, a, out);
+        for (size_t i = 0; i < SIZE; ++i) {
+            EXPECT_EQ(out[i], a[i] - b[i]);
+        }
+    }
+}
@@ -0,0 +1,92 @@
+#include "barretenberg/ecc/fields/field_vec_simd.hpp"
+
+#if BB_FIELD_VEC_HAS_X86_KERNELS
+#include <immintrin.h>
+
+#define BB_FIELD_VEC_TARGET __attribute__((target("avx2")))
+#include "barretenberg/ecc/fields/field_vec_simd_impl.hpp"
+
+namespace bb::field_vec::detail {
+namespace {
+
+// 4 lanes of 5 52-bit limbs. Only the additive kernels are implemented: AVX2 has no 64-bit multiplier, and a
+// Montgomery multiplication built from its 32x32->64-bit multiplications (with 9 29-bit limbs) turned out no faster
+// than the scalar mulx/adx one.
+struct Avx2 {
+    using V = __m256i;
+    static constexpr size_t LANES = 4;
+    static constexpr uint64_t LIMB_BITS = 52;
+    static constexpr size_t NUM_LIMBS = 5;
+    static constexpr bool HAS_MUL = false;
+
+    BB_FIELD_VEC_TARGET static V zero() { return _mm256_setzero_si256(); }
+    BB_FIELD_VEC_TARGET static V set1(uint64_t x) { return _mm256_set1_epi64x(static_cast<long long>(x)); }
+    BB_FIELD_VEC_TARGET static V add(V x, V y) { return _mm256_add_epi64(x, y); }
+    BB_FIELD_VEC_TARGET static V sub(V x, V y) { return _mm256_sub_epi64(x, y); }
+    BB_FIELD_VEC_TARGET static V and_(V x, V y) { return _mm256_and_si256(x, y); }
+    BB_FIELD_VEC_TARGET static V or_(V x, V y) { return _mm256_or_si256(x, y); }
+    BB_FIELD_VEC_TARGET static V srl(V x, uint64_t count)
+    {
+        return _mm256_srl_epi64(x, _mm_cvtsi64_si128(static_cast<long long>(count)));
+    }
+    BB_FIELD_VEC_TARGET static V sll(V x, uint64_t count)
+    {
+        return _mm256_sll_epi64(x, _mm_cvtsi64_si128(static_cast<long long>(count)));
+    }
+    // Lane-wise borrow == 0 ? if_zero : if_one, for borrow in {0, 1}
+    BB_FIELD_VEC_TARGET static V select(V borrow, V if_zero, V if_one)
+    {
+        return _mm256_blendv_epi8(if_zero, if_one, _mm256_sub_epi64(zero(), borrow));
+    }
+
+    // Loads 4 consecutive elements, words[k] holds the k-th 64-bit limb of each of them (a 4x4 transposition).
+    BB_FIELD_VEC_TARGET static void load(const uint64_t* src, V* words)
+    {
+        const V r0 = _mm256_loadu_si256(reinterpret_cast<const V*>(src));
+        const V r1 = _mm256_loadu_si256(reinterpret_cast<const V*>(src + 4));
+        const V r2 = _mm256_loadu_si256(reinterpret_cast<const V*>(src + 8));
+        const V r3 = _mm256_loadu_si256(reinterpret_cast<const V*>(src + 12));
+        transpose(r0, r1, r2, r3, words);
+    }
+
+    // Inverse of load.
+    BB_FIELD_VEC_TARGET static void store(uint64_t* dst, const V* words)
+    {
+        V rows[4]; // NOLINT(cppcoreguidelines-avoid-c-arrays)
+        transpose(words[0], words[1], words[2], words[3], rows);
+        _mm256_storeu_si256(reinterpret_cast<V*>(dst), rows[0]);
+        _mm256_storeu_si256(reinterpret_cast<V*>(dst + 4), rows[1]);
+        _mm256_storeu_si256(reinterpret_cast<V*>(dst + 8), rows[2]);
+        _mm256_storeu_si256(reinterpret_cast<V*>(dst + 12), rows[3]);
+    }
+
+    BB_FIELD_VEC_TARGET static void transpose(V r0, V r1, V r2, V r3, V* out)
+    {
+        const V t0 = _mm256_unpacklo_epi64(r0, r1);
+        const V t1 = _mm256_unpackhi_epi64(r0, r1);
+        const V t2 = _mm256_unpacklo_epi64(r2, r3);
+        const V t3 = _mm256_unpackhi_epi64(r2, r3);
+        out[0] = _mm256_permute2x128_si256(t0, t2, 0x20);
+        out[1] = _mm256_permute2x128_si256(t1, t3, 0x20);
+        out[2] = _mm256_permute2x128_si256(t0, t2, 0x31);
+        out[3] = _mm256_permute2x128_si256(t1, t3, 0x31);
+    }
+};
+
+} // namespace
+
+void run_avx2(Op op,
+              const Modulus& modulus,
+              uint64_t* out,
+              const uint64_t* a,
+              const uint64_t* b,
+              const uint64_t* c,
+              const uint64_t* u,
+              size_t n)
+{
+    SimdKernels<Avx2>::run(op, modulus, out, a, b, c, u, n);
+}
+
+} // namespace bb::field_vec::detail
+
+#endif
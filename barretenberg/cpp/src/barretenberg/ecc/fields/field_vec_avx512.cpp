@@ -0,0 +1,124 @@
+#include "barretenberg/ecc/fields/field_vec_simd.hpp"
+
+#if BB_FIELD_VEC_HAS_X86_KERNELS
+#include <immintrin.h>
+
+#define BB_FIELD_VEC_TARGET __attribute__((target("avx512f,avx512ifma")))
+#include "barretenberg/ecc/fields/field_vec_simd_impl.hpp"
+
+namespace bb::field_vec::detail {
+namespace {
+
+// 8 lanes of 5 52-bit limbs. Limb products are accumulated with the 52-bit multiply-add instructions of AVX512-IFMA,
+// which add either the low or the high 52 bits of the 104-bit product to a 64-bit accumulator.
+struct Avx512 {
+    using V = __m512i;
+    static constexpr size_t LANES = 8;
+    static constexpr uint64_t LIMB_BITS = 52;
+    static constexpr size_t NUM_LIMBS = 5;
+    static constexpr bool HAS_MUL = true;
+
+    BB_FIELD_VEC_TARGET static V zero() { return _mm512_setzero_si512(); }
+    BB_FIELD_VEC_TARGET static V set1(uint64_t x) { return _mm512_set1_epi64(static_cast<long long>(x)); }
+    BB_FIELD_VEC_TARGET static V add(V x, V y) { return _mm512_add_epi64(x, y); }
+    BB_FIELD_VEC_TARGET static V sub(V x, V y) { return _mm512_sub_epi64(x, y); }
+    BB_FIELD_VEC_TARGET static V and_(V x, V y) { return _mm512_and_si512(x, y); }
+    BB_FIELD_VEC_TARGET static V or_(V x, V y) { return _mm512_or_si512(x, y); }
+    BB_FIELD_VEC_TARGET static V srl(V x, uint64_t count)
+    {
+        return _mm512_srl_epi64(x, _mm_cvtsi64_si128(static_cast<long long>(count)));
+    }
+    BB_FIELD_VEC_TARGET static V sll(V x, uint64_t count)
+    {
+        return _mm512_sll_epi64(x, _mm_cvtsi64_si128(static_cast<long long>(count)));
+    }
+    // Lane-wise borrow == 0 ? if_zero : if_one
+    BB_FIELD_VEC_TARGET static V select(V borrow, V if_zero, V if_one)
+    {
+        return _mm512_mask_blend_epi64(_mm512_test_epi64_mask(borrow, borrow), if_zero, if_one);
+    }
+
+    // Loads 8 consecutive elements, words[k] holds the k-th 64-bit limb of each of them.
+    BB_FIELD_VEC_TARGET static void load(const uint64_t* src, V* words)
+    {
+        const V z0 = _mm512_loadu_si512(src);
+        const V z1 = _mm512_loadu_si512(src + 8);
+        const V z2 = _mm512_loadu_si512(src + 16);
+        const V z3 = _mm512_loadu_si512(src + 24);
+        const V limbs_01 = _mm512_setr_epi64(0, 4, 8, 12, 1, 5, 9, 13);
+        const V limbs_23 = _mm512_setr_epi64(2, 6, 10, 14, 3, 7, 11, 15);
+        const V low_halves = _mm512_setr_epi64(0, 1, 2, 3, 8, 9, 10, 11);
+        const V high_halves = _mm512_setr_epi64(4, 5, 6, 7, 12, 13, 14, 15);
+        // Limbs 0 and 1 (resp. 2 and 3) of elements 0-3 and of elements 4-7.
+        const V lo_01 = _mm512_permutex2var_epi64(z0, limbs_01, z1);
+        const V lo_23 = _mm512_permutex2var_epi64(z0, limbs_23, z1);
+        const V hi_01 = _mm512_permutex2var_epi64(z2, limbs_01, z3);
+        const V hi_23 = _mm512_permutex2var_epi64(z2, limbs_23, z3);
+        words[0] = _mm512_permutex2var_epi64(lo_01, low_halves, hi_01);
+        words[1] = _mm512_permutex2var_epi64(lo_01, high_halves, hi_01);
+        words[2] = _mm512_permutex2var_epi64(lo_23, low_halves, hi_23);
+        words[3] = _mm512_permutex2var_epi64(lo_23, high_halves, hi_23);
+    }
+
+    // Inverse of load.
+    BB_FIELD_VEC_TARGET static void store(uint64_t* dst, const V* words)
+    {
+        const V limbs_01 = _mm512_setr_epi64(0, 4, 8, 12, 1, 5, 9, 13);
+        const V limbs_23 = _mm512_setr_epi64(2, 6, 10, 14, 3, 7, 11, 15);
+        const V low_halves = _mm512_setr_epi64(0, 1, 2, 3, 8, 9, 10, 11);
+        const V high_halves = _mm512_setr_epi64(4, 5, 6, 7, 12, 13, 14, 15);
+        const V lo_01 = _mm512_permutex2var_epi64(words[0], low_halves, words[1]);
+        const V hi_01 = _mm512_permutex2var_epi64(words[0], high_halves, words[1]);
+        const V lo_23 = _mm512_permutex2var_epi64(words[2], low_halves, words[3]);
+        const V hi_23 = _mm512_permutex2var_epi64(words[2], high_halves, words[3]);
+        _mm512_storeu_si512(dst, _mm512_permutex2var_epi64(lo_01, limbs_01, lo_23));
+        _mm512_storeu_si512(dst + 8, _mm512_permutex2var_epi64(lo_01, limbs_23, lo_23));
+        _mm512_storeu_si512(dst + 16, _mm512_permutex2var_epi64(hi_01, limbs_01, hi_23));
+        _mm512_storeu_si512(dst + 24, _mm512_permutex2var_epi64(hi_01, limbs_23, hi_23));
+    }
+
+    // out = x * y / 2^260 mod p (not normalized), see SimdKernels::mul for the ranges.
+    BB_FIELD_VEC_TARGET static void mont_mul(const V* x, const V* y, const V* p, V p_inv, V /*mask*/, V* out)
+    {
+        V t[2 * NUM_LIMBS]; // NOLINT(cppcoreguidelines-avoid-c-arrays)
+        for (auto& limb : t) {
+            limb = zero();
+        }
+        for (size_t i = 0; i < NUM_LIMBS; ++i) {
+            for (size_t j = 0; j < NUM_LIMBS; ++j) {
+                t[i + j] = _mm512_madd52lo_epu64(t[i + j], x[i], y[j]);
+                t[i + j + 1] = _mm512_madd52hi_epu64(t[i + j + 1], x[i], y[j]);
+            }
+        }
+        for (size_t i = 0; i < NUM_LIMBS; ++i) {
+            // Only the low 52 bits of t[i] are used, which is all that matters to zero them out.
+            const V m = _mm512_madd52lo_epu64(zero(), t[i], p_inv);
+            for (size_t j = 0; j < NUM_LIMBS; ++j) {
+                t[i + j] = _mm512_madd52lo_epu64(t[i + j], m, p[j]);
+                t[i + j + 1] = _mm512_madd52hi_epu64(t[i + j + 1], m, p[j]);
+            }
+            t[i + 1] = add(t[i + 1], srl(t[i], LIMB_BITS));
+        }
+        for (size_t i = 0; i < NUM_LIMBS; ++i) {
+            out[i] = t[NUM_LIMBS + i];
+        }
+    }
+};
+
+} // namespace
+
+void run_avx512(Op op,
+                const Modulus& modulus,
+                uint64_t* out,
+                const uint64_t* a,
+                const uint64_t* b,
+                const uint64_t* c,
+                const uint64_t* u,
+                size_t n)
+{
+    SimdKernels<Avx512>::run(op, modulus, out, a, b, c, u, n);
+}
+
+} // namespace bb::field_vec::detail
+
+#endif
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "barretenberg/ecc/fields/field_vec.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+// The SIMD kernels are compiled with per-function target attributes, so they can be built into a generic x86_64
+// binary and only selected at runtime on CPUs that support them.
+#if defined(__x86_64__) && !defined(__wasm__) && (defined(__GNUC__) || defined(__clang__))
+#define BB_FIELD_VEC_HAS_X86_KERNELS 1
+#else
+#define BB_FIELD_VEC_HAS_X86_KERNELS 0
+#endif
+
+namespace bb::field_vec::detail {
+
+#if BB_FIELD_VEC_HAS_X86_KERNELS
+// Defined in field_vec_avx2.cpp and field_vec_avx512.cpp. Must only be called when the CPU supports the instructions.
+void run_avx2(Op op,
+              const Modulus& modulus,
+              uint64_t* out,
+              const uint64_t* a,
+              const uint64_t* b,
+              const uint64_t* c,
+              const uint64_t* u,
+              size_t n);
+void run_avx512(Op op,
+                const Modulus& modulus,
+                uint64_t* out,
+                const uint64_t* a,
+                const uint64_t* b,
+                const uint64_t* c,
+                const uint64_t* u,
+                size_t n);
+#endif
+
+} // namespace bb::field_vec::detail
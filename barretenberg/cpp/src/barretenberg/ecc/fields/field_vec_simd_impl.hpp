@@ -0,0 +1,321 @@
+#pragma once
+
+/**
+ * @brief ISA-independent part of the SIMD field kernels, see field_vec.hpp.
+ *
+ * @details Only included by field_vec_avx2.cpp and field_vec_avx512.cpp, after defining BB_FIELD_VEC_TARGET to the
+ * target attribute of the ISA. Everything here has internal linkage, so that the two instantiations (compiled for
+ * different targets) never get merged by the linker.
+ *
+ * The Isa parameter provides the vector type V, the layout constants (LANES, LIMB_BITS, NUM_LIMBS, HAS_MUL) and the
+ * primitives zero, set1, add, sub, and_, or_, srl, sll, select, load, store, and mont_mul if HAS_MUL.
+ */
+
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/ecc/fields/field_vec_simd.hpp"
+
+#include <cstring>
+
+#ifndef BB_FIELD_VEC_TARGET
+#error "BB_FIELD_VEC_TARGET must be defined before including field_vec_simd_impl.hpp"
+#endif
+
+namespace bb::field_vec::detail {
+namespace {
+
+template <typename Isa> struct SimdKernels {
+    using V = typename Isa::V;
+    static constexpr size_t LANES = Isa::LANES;
+    static constexpr size_t NUM_LIMBS = Isa::NUM_LIMBS;
+    static constexpr uint64_t LIMB_BITS = Isa::LIMB_BITS;
+    // The kernels use R = 2^(LIMB_BITS * NUM_LIMBS). The first operand of every multiplication is multiplied by
+    // 2^SHIFT, so that the product comes out in the R = 2^256 Montgomery form of the field class.
+    static constexpr uint64_t SHIFT = (LIMB_BITS * NUM_LIMBS) - 256;
+    static_assert(LIMB_BITS * NUM_LIMBS > 256 && SHIFT < LIMB_BITS);
+
+    struct Params {
+        V p[NUM_LIMBS];     // NOLINT(cppcoreguidelines-avoid-c-arrays)
+        V two_p[NUM_LIMBS]; // NOLINT(cppcoreguidelines-avoid-c-arrays)
+        // -p^{-1} mod 2^LIMB_BITS
+        V p_inv;
+        V mask;
+    };
+
+    // Splits bits [i * LIMB_BITS - shift, (i + 1) * LIMB_BITS - shift) of the 4 64-bit words into limb i, i.e. the
+    // limbs of (words << shift). The shifts saturate to zero for counts >= 64.
+    BB_FIELD_VEC_TARGET static void to_limbs(const V* words, uint64_t shift, V mask, V* limbs)
+    {
+        for (size_t i = 0; i < NUM_LIMBS; ++i) {
+            const auto start = static_cast<int64_t>((i * LIMB_BITS) - shift);
+            V limb = Isa::zero();
+            for (size_t k = 0; k < 4; ++k) {
+                const auto word_start = static_cast<int64_t>(64 * k);
+                if (word_start >= start + static_cast<int64_t>(LIMB_BITS) || word_start + 64 <= start) {
+                    continue;
+                }
+                limb = Isa::or_(limb,
+                                start >= word_start ? Isa::srl(words[k], static_cast<uint64_t>(start - word_start))
+                                                    : Isa::sll(words[k], static_cast<uint64_t>(word_start - start)));
+            }
+            limbs[i] = Isa::and_(limb, mask);
+        }
+    }
+
+    // Inverse of to_limbs (with no shift). The limbs must be normalized and hold a value < 2^256.
+    BB_FIELD_VEC_TARGET static void from_limbs(const V* limbs, V* words)
+    {
+        for (size_t k = 0; k < 4; ++k) {
+            const uint64_t word_start = 64 * k;
+            V word = Isa::zero();
+            for (size_t i = 0; i < NUM_LIMBS; ++i) {
+                const uint64_t start = i * LIMB_BITS;
+                if (start >= word_start + 64 || start + LIMB_BITS <= word_start) {
+                    continue;
+                }
+                word = Isa::or_(word,
+                                start >= word_start ? Isa::sll(limbs[i], start - word_start)
+                                                    : Isa::srl(limbs[i], word_start - start));
+            }
+            words[k] = word;
+        }
+    }
+
+    // Propagates the carries so that every limb but the last one is < 2^LIMB_BITS.
+    BB_FIELD_VEC_TARGET static void normalize(V* x, V mask)
+    {
+        for (size_t i = 0; i + 1 < NUM_LIMBS; ++i) {
+            x[i + 1] = Isa::add(x[i + 1], Isa::srl(x[i], LIMB_BITS));
+            x[i] = Isa::and_(x[i], mask);
+        }
+    }
+
+    // out = x - y for normalized limbs, returns the final borrow (1 if x < y).
+    BB_FIELD_VEC_TARGET static V sub_limbs(const V* x, const V* y, V mask, V* out)
+    {
+        V borrow = Isa::zero();
+        for (size_t i = 0; i < NUM_LIMBS; ++i) {
+            const V diff = Isa::sub(Isa::sub(x[i], y[i]), borrow);
+            borrow = Isa::srl(diff, 63);
+            out[i] = Isa::and_(diff, mask);
+        }
+        return borrow;
+    }
+
+    // x in [0, 4p) -> x in [0, 2p)
+    BB_FIELD_VEC_TARGET static void reduce_once(const Params& params, V* x)
+    {
+        V diff[NUM_LIMBS]; // NOLINT(cppcoreguidelines-avoid-c-arrays)
+        const V borrow = sub_limbs(x, params.two_p, params.mask, diff);
+        for (size_t i = 0; i < NUM_LIMBS; ++i) {
+            x[i] = Isa::select(borrow, diff[i], x[i]);
+        }
+    }
+
+    // out = x + y, for x, y in [0, 2p)
+    BB_FIELD_VEC_TARGET static void add(const Params& params, const V* x, const V* y, V* out)
+    {
+        for (size_t i = 0; i < NUM_LIMBS; ++i) {
+            out[i] = Isa::add(x[i], y[i]);
+        }
+        normalize(out, params.mask);
+        reduce_once(params, out);
+    }
+
+    // out = 2p - x, for x in [0, 2p)
+    BB_FIELD_VEC_TARGET static void negate(const Params& params, const V* x, V* out)
+    {
+        sub_limbs(params.two_p, x, params.mask, out);
+    }
+
+    // out = x * y / R, for x < 2^SHIFT * 2p (i.e. the scaled operand) and y in [0, 2p). The result is in [0, 2p).
+    BB_FIELD_VEC_TARGET static void mul(const Params& params, const V* x, const V* y, V* out)
+    {
+        Isa::mont_mul(x, y, params.p, params.p_inv, params.mask, out);
+        normalize(out, params.mask);
+    }
+
+    BB_FIELD_VEC_TARGET static void load_limbs(const Params& params, const uint64_t* src, uint64_t shift, V* limbs)
+    {
+        V words[4]; // NOLINT(cppcoreguidelines-avoid-c-arrays)
+        Isa::load(src, words);
+        to_limbs(words, shift, params.mask, limbs);
+    }
+
+    BB_FIELD_VEC_TARGET static void store_limbs(uint64_t* dst, const V* limbs)
+    {
+        V words[4]; // NOLINT(cppcoreguidelines-avoid-c-arrays)
+        from_limbs(limbs, words);
+        Isa::store(dst, words);
+    }
+
+    // Processes LANES elements.
+    template <Op op>
+    BB_FIELD_VEC_TARGET static void run_block(const Params& params,
+                                              uint64_t* out,
+                                              const uint64_t* a,
+                                              const uint64_t* b,
+                                              const uint64_t* c,
+                                              const V* u_scaled)
+    {
+        // NOLINTBEGIN(cppcoreguidelines-avoid-c-arrays)
+        V x[NUM_LIMBS];
+        V y[NUM_LIMBS];
+        V t[NUM_LIMBS];
+        V r[NUM_LIMBS];
+        // NOLINTEND(cppcoreguidelines-avoid-c-arrays)
+        if constexpr (op == Op::ADD) {
+            load_limbs(params, a, 0, x);
+            load_limbs(params, b, 0, y);
+            add(params, x, y, r);
+        } else if constexpr (op == Op::SUB) {
+            load_limbs(params, a, 0, x);
+            load_limbs(params, b, 0, y);
+            negate(params, y, t);
+            add(params, x, t, r);
+        } else if constexpr (op == Op::MUL) {
+            load_limbs(params, a, SHIFT, x);
+            load_limbs(params, b, 0, y);
+            mul(params, x, y, r);
+        } else if constexpr (op == Op::FMA) {
+            load_limbs(params, a, SHIFT, x);
+            load_limbs(params, b, 0, y);
+            mul(params, x, y, t);
+            load_limbs(params, c, 0, y);
+            add(params, t, y, r);
+        } else if constexpr (op == Op::SCALE) {
+            load_limbs(params, a, 0, x);
+            mul(params, u_scaled, x, r);
+        } else if constexpr (op == Op::ADD_SCALED) {
+            load_limbs(params, a, 0, x);
+            load_limbs(params, b, 0, y);
+            mul(params, u_scaled, y, t);
+            add(params, x, t, r);
+        } else if constexpr (op == Op::FOLD) {
+            // a + u * (b - a), with b - a computed as b + (2p - a) in [0, 2p).
+            load_limbs(params, a, 0, x);
+            load_limbs(params, b, 0, y);
+            negate(params, x, t);
+            add(params, y, t, r);
+            mul(params, u_scaled, r, t);
+            add(params, x, t, r);
+        }
+        store_limbs(out, r);
+    }
+
+    template <Op op>
+    BB_FIELD_VEC_TARGET static void run_op(const Params& params,
+                                           uint64_t* out,
+                                           const uint64_t* a,
+                                           const uint64_t* b,
+                                           const uint64_t* c,
+                                           const uint64_t* u,
+                                           size_t n)
+    {
+        constexpr size_t BLOCK_WORDS = 4 * LANES;
+
+        V u_scaled[NUM_LIMBS]; // NOLINT(cppcoreguidelines-avoid-c-arrays)
+        if (u != nullptr) {
+            V words[4]; // NOLINT(cppcoreguidelines-avoid-c-arrays)
+            for (size_t k = 0; k < 4; ++k) {
+                words[k] = Isa::set1(u[k]);
+            }
+            to_limbs(words, SHIFT, params.mask, u_scaled);
+        }
+
+        auto at = [](const uint64_t* ptr, size_t offset) { return ptr == nullptr ? nullptr : ptr + offset; };
+        const size_t num_full_blocks = n / LANES;
+        for (size_t block = 0; block < num_full_blocks; ++block) {
+            const size_t offset = block * BLOCK_WORDS;
+            run_block<op>(params, out + offset, at(a, offset), at(b, offset), at(c, offset), u_scaled);
+        }
+
+        // The last partial block goes through zero-padded buffers (zero is a valid input of every op).
+        const size_t tail = n - (num_full_blocks * LANES);
+        if (tail == 0) {
+            return;
+        }
+        const size_t offset = num_full_blocks * BLOCK_WORDS;
+        const size_t tail_bytes = tail * 4 * sizeof(uint64_t);
+        // NOLINTBEGIN(cppcoreguidelines-avoid-c-arrays)
+        uint64_t tail_out[BLOCK_WORDS] = {};
+        uint64_t tail_a[BLOCK_WORDS] = {};
+        uint64_t tail_b[BLOCK_WORDS] = {};
+        uint64_t tail_c[BLOCK_WORDS] = {};
+        // NOLINTEND(cppcoreguidelines-avoid-c-arrays)
+        std::memcpy(tail_a, a + offset, tail_bytes);
+        if (b != nullptr) {
+            std::memcpy(tail_b, b + offset, tail_bytes);
+        }
+        if (c != nullptr) {
+            std::memcpy(tail_c, c + offset, tail_bytes);
+        }
+        run_block<op>(params, tail_out, tail_a, tail_b, tail_c, u_scaled);
+        std::memcpy(out + offset, tail_out, tail_bytes);
+    }
+
+    BB_FIELD_VEC_TARGET static void run(Op op,
+                                        const Modulus& modulus,
+                                        uint64_t* out,
+                                        const uint64_t* a,
+                                        const uint64_t* b,
+                                        const uint64_t* c,
+                                        const uint64_t* u,
+                                        size_t n)
+    {
+        Params params;
+        params.mask = Isa::set1((uint64_t(1) << LIMB_BITS) - 1);
+        params.p_inv = Isa::set1(modulus.r_inv & ((uint64_t(1) << LIMB_BITS) - 1));
+        // 2p < 2^255 for the supported moduli.
+        const uint64_t two_p[4] = { // NOLINT(cppcoreguidelines-avoid-c-arrays)
+                                    modulus.limbs[0] << 1,
+                                    (modulus.limbs[1] << 1) | (modulus.limbs[0] >> 63),
+                                    (modulus.limbs[2] << 1) | (modulus.limbs[1] >> 63),
+                                    (modulus.limbs[3] << 1) | (modulus.limbs[2] >> 63)
+        };
+        V words[4]; // NOLINT(cppcoreguidelines-avoid-c-arrays)
+        for (size_t k = 0; k < 4; ++k) {
+            words[k] = Isa::set1(modulus.limbs[k]);
+        }
+        to_limbs(words, 0, params.mask, params.p);
+        for (size_t k = 0; k < 4; ++k) {
+            words[k] = Isa::set1(two_p[k]);
+        }
+        to_limbs(words, 0, params.mask, params.two_p);
+
+        switch (op) {
+        case Op::ADD:
+            run_op<Op::ADD>(params, out, a, b, c, u, n);
+            return;
+        case Op::SUB:
+            run_op<Op::SUB>(params, out, a, b, c, u, n);
+            return;
+        default:
+            break;
+        }
+        if constexpr (Isa::HAS_MUL) {
+            switch (op) {
+            case Op::MUL:
+                run_op<Op::MUL>(params, out, a, b, c, u, n);
+                return;
+            case Op::FMA:
+                run_op<Op::FMA>(params, out, a, b, c, u, n);
+                return;
+            case Op::SCALE:
+                run_op<Op::SCALE>(params, out, a, b, c, u, n);
+                return;
+            case Op::ADD_SCALED:
+                run_op<Op::ADD_SCALED>(params, out, a, b, c, u, n);
+                return;
+            case Op::FOLD:
+                run_op<Op::FOLD>(params, out, a, b, c, u, n);
+                return;
+            default:
+                break;
+            }
+        }
+        throw_or_abort("field_vec: unsupported SIMD operation.");
+    }
+};
+
+} // namespace
+} // namespace bb::field_vec::detail
@@ -6,6 +6,9 @@
 
 #include "runtime_states.hpp"
 
+#include <cstdlib>
+#include <string_view>
+
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/common/slab_allocator.hpp"
 #include "barretenberg/common/thread.hpp"
@@ -14,6 +17,16 @@
 // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
 namespace bb::scalar_multiplication {
 
+BucketAccumulation get_default_bucket_accumulation()
+{
+    static const BucketAccumulation default_accumulation = []() {
+        const char* env = std::getenv("BB_MSM_BUCKET_ACCUMULATION");
+        return env != nullptr && std::string_view(env) == "batched_affine" ? BucketAccumulation::BatchedAffine
+                                                                            : BucketAccumulation::AdditionChains;
+    }();
+    return default_accumulation;
+}
+
 size_t get_num_pippenger_rounds(const size_t num_points)
 {
     const auto num_points_floor = static_cast<size_t>(1ULL << (numeric::get_msb(num_points)));
@@ -45,6 +58,7 @@ pippenger_runtime_state<Curve>::pippenger_runtime_state(const size_t num_initial
     , bit_counts(reinterpret_cast<uint32_t*>(aligned_alloc(64, num_threads * num_buckets * sizeof(uint32_t))))
     , bucket_empty_status(reinterpret_cast<bool*>(aligned_alloc(64, num_threads * num_buckets * sizeof(bool))))
     , round_counts(reinterpret_cast<uint64_t*>(aligned_alloc(32, MAX_NUM_ROUNDS * sizeof(uint64_t))))
+    , bucket_accumulation(get_default_bucket_accumulation())
 {
     PROFILE_THIS();
 
@@ -103,7 +117,7 @@ pippenger_runtime_state<Curve>::pippenger_runtime_state(pippenger_runtime_state&
     , bit_counts(other.bit_counts)
     , bucket_empty_status(other.bucket_empty_status)
     , round_counts(other.round_counts)
-
+    , bucket_accumulation(other.bucket_accumulation)
 {
     PROFILE_THIS();
 
@@ -170,6 +184,7 @@ pippenger_runtime_state<Curve>& pippenger_runtime_state<Curve>::operator=(
     other.round_counts = nullptr;
 
     num_points = other.num_points;
+    bucket_accumulation = other.bucket_accumulation;
     return *this;
 }
 
@@ -221,6 +236,8 @@ template <typename Curve> pippenger_runtime_state<Curve>::~pippenger_runtime_sta
 
 template struct affine_product_runtime_state<curve::BN254>;
 template struct affine_product_runtime_state<curve::Grumpkin>;
+template struct batched_affine_runtime_state<curve::BN254>;
+template struct batched_affine_runtime_state<curve::Grumpkin>;
 template struct pippenger_runtime_state<curve::BN254>;
 template struct pippenger_runtime_state<curve::Grumpkin>;
 } // namespace bb::scalar_multiplication
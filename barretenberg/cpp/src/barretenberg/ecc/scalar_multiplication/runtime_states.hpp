@@ -10,6 +10,9 @@
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include "barretenberg/ecc/groups/wnaf.hpp"
 
+#include <utility>
+#include <vector>
+
 namespace bb::scalar_multiplication {
 // simple helper functions to retrieve pointers to pre-allocated memory for the scalar multiplication algorithm.
 // This is to eliminate page faults when allocating (and writing) to large tranches of memory.
@@ -69,6 +72,19 @@ constexpr size_t get_num_rounds(const size_t num_points)
     return WNAF_SIZE(bits_per_bucket + 1);
 }
 
+/**
+ * @brief How points are accumulated into the pippenger buckets of a round.
+ *
+ * AdditionChains: points are sorted into base-2 addition chains that are reduced with the affine trick, level by level
+ * (see `reduce_buckets`).
+ * BatchedAffine: each bucket is kept as an affine point and receives one point per pass, so all additions of a pass
+ * are independent and share a single inversion per batch (see `accumulate_buckets_batched_affine`).
+ */
+enum class BucketAccumulation { AdditionChains, BatchedAffine };
+
+// Reads BB_MSM_BUCKET_ACCUMULATION ("addition_chains" or "batched_affine"). Defaults to AdditionChains.
+BucketAccumulation get_default_bucket_accumulation();
+
 template <typename Curve> struct affine_product_runtime_state {
     const typename Curve::AffineElement* points;
     typename Curve::AffineElement* point_pairs_1;
@@ -82,6 +98,32 @@ template <typename Curve> struct affine_product_runtime_state {
     bool* bucket_empty_status;
 };
 
+// Per-thread memory of the batched affine bucket accumulation, reused across rounds.
+template <typename Curve> struct batched_affine_runtime_state {
+    using AffineElement = typename Curve::AffineElement;
+    using Element = typename Curve::Element;
+    using Fq = typename Curve::BaseField;
+
+    // Number of independent additions sharing one inversion.
+    static constexpr size_t BATCH_SIZE = 1024;
+    // Below this many buckets left with pending points, a batch would not amortize the inversion well enough and the
+    // remaining points are added with mixed (Jacobian + affine) additions instead.
+    static constexpr size_t MIN_BATCH_SIZE = 64;
+
+    std::vector<AffineElement> buckets;
+    // Bucket b owns the schedule entries [bucket_offsets[b], bucket_offsets[b + 1]).
+    std::vector<uint32_t> bucket_offsets;
+    // Next schedule entry to add into each bucket.
+    std::vector<uint32_t> cursors;
+    // Buckets that still have points to add, in increasing bucket order.
+    std::vector<uint32_t> pending_buckets;
+    // Points being added, and prefix products of the denominators of the current batch (sized BATCH_SIZE).
+    std::vector<AffineElement> batch_points;
+    std::vector<Fq> batch_products;
+    // Buckets finished with mixed additions, in increasing bucket order.
+    std::vector<std::pair<uint32_t, Element>> jacobian_buckets;
+};
+
 template <typename Curve> struct pippenger_runtime_state {
     using Fq = typename Curve::BaseField;
     using AffineElement = typename Curve::AffineElement;
@@ -107,6 +149,8 @@ template <typename Curve> struct pippenger_runtime_state {
     bool* bucket_empty_status;
     uint64_t* round_counts;
 
+    BucketAccumulation bucket_accumulation;
+
     pippenger_runtime_state(size_t num_initial_points) noexcept;
     pippenger_runtime_state(pippenger_runtime_state&& other) noexcept;
     pippenger_runtime_state& operator=(pippenger_runtime_state&& other) noexcept;
@@ -784,6 +784,153 @@ uint32_t construct_addition_chains(affine_product_runtime_state<Curve>& state, b
     return max_bucket_bits;
 }
 
+/**
+ * Accumulates the points of one thread's round into its buckets, keeping the buckets in affine form, and computes the
+ * bucket sums used by `evaluate_pippenger_rounds`.
+ *
+ * The point schedule is sorted by bucket, so the points of each bucket are contiguous. We add the points in passes:
+ * each pass adds the next pending point of every bucket that still has points. Two additions of the same pass never
+ * touch the same bucket, so they are all independent and can be evaluated with the affine addition formula, sharing one
+ * (Montgomery batch) inversion per BATCH_SIZE additions. This costs ~6 multiplications per addition, versus ~11 for a
+ * mixed addition, and unlike the addition chains it needs no intermediate copies of the points.
+ *
+ * Passes get shorter as buckets run out of points. Once fewer than MIN_BATCH_SIZE buckets are pending, the inversion
+ * is no longer amortized, and the remaining points are added with mixed additions into Jacobian buckets.
+ *
+ * On return, `running_sum` is the sum of all buckets and `accumulator` is sum_k (2k + 1) * bucket_k, where k is the
+ * bucket index relative to the first bucket of the thread. This matches the addition chain path.
+ *
+ * Like `add_affine_points`, this assumes that the incomplete addition formula exceptions are never triggered.
+ **/
+template <typename Curve>
+void accumulate_buckets_batched_affine(const typename Curve::AffineElement* points,
+                                       const uint64_t* point_schedule,
+                                       const size_t num_points,
+                                       const size_t first_bucket,
+                                       const size_t num_buckets,
+                                       batched_affine_runtime_state<Curve>& state,
+                                       typename Curve::Element& accumulator,
+                                       typename Curve::Element& running_sum)
+{
+    PROFILE_THIS();
+
+    using Group = typename Curve::Group;
+    using Fq = typename Curve::BaseField;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    constexpr size_t BATCH_SIZE = batched_affine_runtime_state<Curve>::BATCH_SIZE;
+    constexpr size_t MIN_BATCH_SIZE = batched_affine_runtime_state<Curve>::MIN_BATCH_SIZE;
+
+    const auto fetch_point = [&](size_t schedule_index, AffineElement* out) {
+        const uint64_t schedule = point_schedule[schedule_index];
+        Group::conditional_negate_affine(points + (schedule >> 32ULL), out, (schedule >> 31ULL) & 1ULL);
+    };
+
+    // Find the range of schedule entries of each bucket.
+    auto& offsets = state.bucket_offsets;
+    offsets.assign(num_buckets + 1, 0);
+    for (size_t i = 0; i < num_points; ++i) {
+        ++offsets[(point_schedule[i] & 0x7fffffffU) - first_bucket + 1];
+    }
+    for (size_t i = 1; i <= num_buckets; ++i) {
+        offsets[i] += offsets[i - 1];
+    }
+
+    // The first point of each bucket is its initial value.
+    state.buckets.resize(num_buckets);
+    state.cursors.resize(num_buckets);
+    state.pending_buckets.clear();
+    state.batch_points.resize(BATCH_SIZE);
+    state.batch_products.resize(BATCH_SIZE);
+    for (size_t b = 0; b < num_buckets; ++b) {
+        if (offsets[b] == offsets[b + 1]) {
+            continue;
+        }
+        fetch_point(offsets[b], &state.buckets[b]);
+        state.cursors[b] = offsets[b] + 1;
+        if (state.cursors[b] < offsets[b + 1]) {
+            state.pending_buckets.push_back(static_cast<uint32_t>(b));
+        }
+    }
+
+    while (state.pending_buckets.size() >= MIN_BATCH_SIZE) {
+        const size_t num_pending = state.pending_buckets.size();
+        for (size_t batch_start = 0; batch_start < num_pending; batch_start += BATCH_SIZE) {
+            const size_t batch_size = std::min(BATCH_SIZE, num_pending - batch_start);
+            const uint32_t* batch_buckets = &state.pending_buckets[batch_start];
+
+            // Accumulate the denominators (x_2 - x_1), keeping the prefix products.
+            Fq batch_inversion_accumulator = Fq::one();
+            for (size_t k = 0; k < batch_size; ++k) {
+                if (k + 8 < batch_size) {
+                    __builtin_prefetch(points + (point_schedule[state.cursors[batch_buckets[k + 8]]] >> 32ULL));
+                }
+                const uint32_t b = batch_buckets[k];
+                AffineElement& point = state.batch_points[k];
+                fetch_point(state.cursors[b]++, &point);
+                state.batch_products[k] = batch_inversion_accumulator;
+                batch_inversion_accumulator *= (point.x - state.buckets[b].x);
+            }
+
+            if (batch_inversion_accumulator == 0) {
+                // prefer abort to throw for code that might emit from multiple threads
+                abort_with_message("attempted to invert zero in accumulate_buckets_batched_affine");
+            }
+            batch_inversion_accumulator = batch_inversion_accumulator.invert();
+
+            // Peel off the individual inverses and apply the affine addition formula.
+            for (size_t k = batch_size - 1; k < batch_size; --k) {
+                AffineElement& bucket = state.buckets[batch_buckets[k]];
+                const AffineElement& point = state.batch_points[k];
+                const Fq denominator = point.x - bucket.x;
+                const Fq lambda = (point.y - bucket.y) * (batch_inversion_accumulator * state.batch_products[k]);
+                batch_inversion_accumulator *= denominator;
+                const Fq x_3 = lambda.sqr() - (bucket.x + point.x);
+                bucket.y = lambda * (bucket.x - x_3) - bucket.y;
+                bucket.x = x_3;
+            }
+        }
+
+        // Drop the buckets that have no points left. This keeps the bucket order.
+        size_t num_still_pending = 0;
+        for (uint32_t b : state.pending_buckets) {
+            if (state.cursors[b] < offsets[b + 1]) {
+                state.pending_buckets[num_still_pending++] = b;
+            }
+        }
+        state.pending_buckets.resize(num_still_pending);
+    }
+
+    // Tail: add the few remaining points with mixed additions.
+    state.jacobian_buckets.clear();
+    for (uint32_t b : state.pending_buckets) {
+        Element bucket(state.buckets[b]);
+        AffineElement point;
+        for (uint32_t i = state.cursors[b]; i < offsets[b + 1]; ++i) {
+            fetch_point(i, &point);
+            bucket += point;
+        }
+        state.jacobian_buckets.emplace_back(b, bucket);
+    }
+
+    // Bucket concatenation, as in the addition chain path.
+    size_t jacobian_it = state.jacobian_buckets.size();
+    const auto add_bucket = [&](size_t b) {
+        if (jacobian_it > 0 && state.jacobian_buckets[jacobian_it - 1].first == b) {
+            running_sum += state.jacobian_buckets[--jacobian_it].second;
+        } else if (offsets[b] != offsets[b + 1]) {
+            running_sum += state.buckets[b];
+        }
+    };
+    for (size_t k = num_buckets - 1; k > 0; --k) {
+        add_bucket(k);
+        accumulator += running_sum;
+    }
+    add_bucket(0);
+    accumulator.self_dbl();
+    accumulator += running_sum;
+}
+
 template <typename Curve>
 typename Curve::Element evaluate_pippenger_rounds(pippenger_runtime_state<Curve>& state,
                                                   std::span<const typename Curve::AffineElement> points,
@@ -801,8 +948,12 @@ typename Curve::Element evaluate_pippenger_rounds(pippenger_runtime_state<Curve>
     std::unique_ptr<Element[], decltype(&aligned_free)> thread_accumulators(
         static_cast<Element*>(aligned_alloc(64, num_threads * sizeof(Element))), &aligned_free);
 
+    const bool use_batched_affine =
+        state.bucket_accumulation == BucketAccumulation::BatchedAffine && !handle_edge_cases;
+
     parallel_for(num_threads, [&](size_t j) {
         thread_accumulators[j].self_set_infinity();
+        batched_affine_runtime_state<Curve> batched_affine_state;
 
         for (size_t i = 0; i < num_rounds; ++i) {
 
@@ -825,29 +976,41 @@ typename Curve::Element evaluate_pippenger_rounds(pippenger_runtime_state<Curve>
                     thread_point_schedule[(num_round_points_per_thread - 1 + leftovers)] & 0x7fffffffU;
                 const size_t num_thread_buckets = (last_bucket - first_bucket) + 1;
 
-                affine_product_runtime_state<Curve> product_state =
-                    state.get_affine_product_runtime_state(num_threads, j);
-                product_state.num_points = static_cast<uint32_t>(num_round_points_per_thread + leftovers);
-                product_state.points = points.data();
-                product_state.point_schedule = thread_point_schedule;
-                product_state.num_buckets = static_cast<uint32_t>(num_thread_buckets);
-                AffineElement* output_buckets = reduce_buckets(product_state, true, handle_edge_cases);
                 Element running_sum;
                 running_sum.self_set_infinity();
 
-                // one nice side-effect of the affine trick, is that half of the bucket concatenation
-                // algorithm can use mixed addition formulae, instead of full addition formulae
-                size_t output_it = product_state.num_points - 1;
-                for (size_t k = num_thread_buckets - 1; k > 0; --k) {
-                    if (__builtin_expect(!product_state.bucket_empty_status[k], 1)) {
-                        running_sum += (output_buckets[output_it]);
-                        --output_it;
+                if (use_batched_affine) {
+                    accumulate_buckets_batched_affine<Curve>(points.data(),
+                                                             thread_point_schedule,
+                                                             num_round_points_per_thread + leftovers,
+                                                             first_bucket,
+                                                             num_thread_buckets,
+                                                             batched_affine_state,
+                                                             accumulator,
+                                                             running_sum);
+                } else {
+                    affine_product_runtime_state<Curve> product_state =
+                        state.get_affine_product_runtime_state(num_threads, j);
+                    product_state.num_points = static_cast<uint32_t>(num_round_points_per_thread + leftovers);
+                    product_state.points = points.data();
+                    product_state.point_schedule = thread_point_schedule;
+                    product_state.num_buckets = static_cast<uint32_t>(num_thread_buckets);
+                    AffineElement* output_buckets = reduce_buckets(product_state, true, handle_edge_cases);
+
+                    // one nice side-effect of the affine trick, is that half of the bucket concatenation
+                    // algorithm can use mixed addition formulae, instead of full addition formulae
+                    size_t output_it = product_state.num_points - 1;
+                    for (size_t k = num_thread_buckets - 1; k > 0; --k) {
+                        if (__builtin_expect(!product_state.bucket_empty_status[k], 1)) {
+                            running_sum += (output_buckets[output_it]);
+                            --output_it;
+                        }
+                        accumulator += running_sum;
                     }
+                    running_sum += output_buckets[0];
+                    accumulator.self_dbl();
                     accumulator += running_sum;
                 }
-                running_sum += output_buckets[0];
-                accumulator.self_dbl();
-                accumulator += running_sum;
 
                 // we now need to scale up 'running sum' up to the value of the first bucket.
                 // e.g. if first bucket is 0, no scaling
@@ -1059,6 +1222,72 @@ typename Curve::Element pippenger_without_endomorphism_basis_points(
     return pippenger(scalars, G_mod, state, false);
 }
 
+/**
+ * @brief Single-threaded bucket MSM over a pippenger point table
+ * @details Each scalar is split into two ~128-bit endomorphism scalars, one for each point of its pair in the table,
+ * and the 2n resulting (point, scalar) pairs are processed window by window from the most significant one: the points
+ * are added into Jacobian buckets indexed by their window digit, and the buckets are combined with a running sum. The
+ * mixed additions handle all edge cases, so unlike pippenger_unsafe there is no distinctness assumption on the points.
+ */
+template <typename Curve>
+typename Curve::Element pippenger_single_threaded(PolynomialSpan<const typename Curve::ScalarField> scalars,
+                                                  std::span<const typename Curve::AffineElement> points)
+{
+    using Fr = typename Curve::ScalarField;
+    using Element = typename Curve::Element;
+
+    Element result;
+    result.self_set_infinity();
+    const size_t num_scalars = scalars.size();
+    if (num_scalars == 0) {
+        return result;
+    }
+    BB_ASSERT_LTE((scalars.start_index + num_scalars) * 2, points.size());
+
+    // Endomorphism scalars, two 64-bit limbs each, ordered as the points of the table
+    std::vector<std::array<uint64_t, 2>> endo_scalars(num_scalars * 2);
+    for (size_t i = 0; i < num_scalars; ++i) {
+        auto [k1, k2] = Fr::split_into_endomorphism_scalars(scalars.span[i].from_montgomery_form());
+        endo_scalars[i * 2] = k1;
+        endo_scalars[i * 2 + 1] = k2;
+    }
+    std::span<const typename Curve::AffineElement> table = points.subspan(scalars.start_index * 2, num_scalars * 2);
+
+    const size_t bits_per_window = get_optimal_bucket_width(num_scalars) + 1;
+    const size_t num_windows = (128 + bits_per_window - 1) / bits_per_window;
+    const uint64_t digit_mask = (1ULL << bits_per_window) - 1;
+    std::vector<Element> buckets(1ULL << bits_per_window);
+    for (size_t window = num_windows; window-- > 0;) {
+        for (size_t i = 0; i < bits_per_window; ++i) {
+            result.self_dbl();
+        }
+        for (auto& bucket : buckets) {
+            bucket.self_set_infinity();
+        }
+        const size_t bit_offset = window * bits_per_window;
+        const size_t limb = bit_offset / 64;
+        const size_t shift = bit_offset % 64;
+        for (size_t i = 0; i < table.size(); ++i) {
+            uint64_t digit = endo_scalars[i][limb] >> shift;
+            if (shift + bits_per_window > 64 && limb == 0) {
+                digit |= endo_scalars[i][1] << (64 - shift);
+            }
+            digit &= digit_mask;
+            if (digit != 0) {
+                buckets[digit] += table[i];
+            }
+        }
+        // ∑ᵢ i⋅bucketᵢ, as the sum of the suffix sums of the buckets
+        Element running_sum;
+        running_sum.self_set_infinity();
+        for (size_t i = buckets.size() - 1; i > 0; --i) {
+            running_sum += buckets[i];
+            result += running_sum;
+        }
+    }
+    return result;
+}
+
 // Explicit instantiation
 // BN254
 template void generate_pippenger_point_table<curve::BN254>(const curve::BN254::AffineElement* points,
@@ -1085,6 +1314,15 @@ template void add_affine_points_with_edge_cases<curve::BN254>(curve::BN254::Affi
 template void evaluate_addition_chains<curve::BN254>(affine_product_runtime_state<curve::BN254>& state,
                                                      const size_t max_bucket_bits,
                                                      bool handle_edge_cases);
+template void accumulate_buckets_batched_affine<curve::BN254>(const curve::BN254::AffineElement* points,
+                                                             const uint64_t* point_schedule,
+                                                             size_t num_points,
+                                                             size_t first_bucket,
+                                                             size_t num_buckets,
+                                                             batched_affine_runtime_state<curve::BN254>& state,
+                                                             curve::BN254::Element& accumulator,
+                                                             curve::BN254::Element& running_sum);
+
 template curve::BN254::Element pippenger_internal<curve::BN254>(std::span<const curve::BN254::AffineElement> points,
                                                                 PolynomialSpan<const curve::BN254::ScalarField> scalars,
                                                                 const size_t num_initial_points,
@@ -1120,6 +1358,9 @@ template curve::BN254::Element pippenger_without_endomorphism_basis_points<curve
     std::span<const curve::BN254::AffineElement> points,
     pippenger_runtime_state<curve::BN254>& state);
 
+template curve::BN254::Element pippenger_single_threaded<curve::BN254>(
+    PolynomialSpan<const curve::BN254::ScalarField> scalars, std::span<const curve::BN254::AffineElement> points);
+
 // Grumpkin
 template void generate_pippenger_point_table<curve::Grumpkin>(const curve::Grumpkin::AffineElement* points,
                                                               curve::Grumpkin::AffineElement* table,
@@ -1145,6 +1386,16 @@ template void add_affine_points_with_edge_cases<curve::Grumpkin>(curve::Grumpkin
 template void evaluate_addition_chains<curve::Grumpkin>(affine_product_runtime_state<curve::Grumpkin>& state,
                                                         const size_t max_bucket_bits,
                                                         bool handle_edge_cases);
+template void accumulate_buckets_batched_affine<curve::Grumpkin>(
+    const curve::Grumpkin::AffineElement* points,
+    const uint64_t* point_schedule,
+    size_t num_points,
+    size_t first_bucket,
+    size_t num_buckets,
+    batched_affine_runtime_state<curve::Grumpkin>& state,
+    curve::Grumpkin::Element& accumulator,
+    curve::Grumpkin::Element& running_sum);
+
 template curve::Grumpkin::Element pippenger_internal<curve::Grumpkin>(
     std::span<const curve::Grumpkin::AffineElement> points,
     PolynomialSpan<const curve::Grumpkin::ScalarField> scalars,
@@ -1180,6 +1431,9 @@ template curve::Grumpkin::Element pippenger_without_endomorphism_basis_points<cu
     std::span<const curve::Grumpkin::AffineElement> points,
     pippenger_runtime_state<curve::Grumpkin>& state);
 
+template curve::Grumpkin::Element pippenger_single_threaded<curve::Grumpkin>(
+    PolynomialSpan<const curve::Grumpkin::ScalarField> scalars, std::span<const curve::Grumpkin::AffineElement> points);
+
 } // namespace bb::scalar_multiplication
 
 // NOLINTEND(cppcoreguidelines-avoid-c-arrays, google-readability-casting)
@@ -141,6 +141,16 @@ void evaluate_addition_chains(affine_product_runtime_state<Curve>& state,
                               size_t max_bucket_bits,
                               bool handle_edge_cases);
 template <typename Curve>
+void accumulate_buckets_batched_affine(const typename Curve::AffineElement* points,
+                                       const uint64_t* point_schedule,
+                                       size_t num_points,
+                                       size_t first_bucket,
+                                       size_t num_buckets,
+                                       batched_affine_runtime_state<Curve>& state,
+                                       typename Curve::Element& accumulator,
+                                       typename Curve::Element& running_sum);
+
+template <typename Curve>
 typename Curve::Element pippenger_internal(typename Curve::AffineElement* points,
                                            PolynomialSpan<const typename Curve::ScalarField> scalars,
                                            size_t num_initial_points,
@@ -173,6 +183,16 @@ typename Curve::Element pippenger_without_endomorphism_basis_points(
     std::span<const typename Curve::AffineElement> points,
     pippenger_runtime_state<Curve>& state);
 
+/**
+ * @brief Bucket MSM that runs entirely on the calling thread.
+ * @details Meant for MSMs too small to keep every thread busy in pippenger: several of them can be computed at once
+ * from inside a parallel_for (which pippenger, being multithreaded itself, cannot be called from). `points` is a
+ * pippenger point table, i.e. each SRS point followed by its endomorphism point.
+ */
+template <typename Curve>
+typename Curve::Element pippenger_single_threaded(PolynomialSpan<const typename Curve::ScalarField> scalars,
+                                                  std::span<const typename Curve::AffineElement> points);
+
 // NOTE: pippenger_unsafe_optimized_for_non_dyadic_polys requires SRS to have #scalars
 // rounded up to nearest power of 2 or above points.
 template <typename Curve>
@@ -524,8 +524,7 @@ class ECCVMFlavor {
             const auto transcript_rows =
                 ECCVMTranscriptBuilder::compute_rows(builder.op_queue->get_eccvm_ops(), builder.get_number_of_muls());
             const std::vector<MSM> msms = builder.get_msms();
-            const auto point_table_rows =
-                ECCVMPointTablePrecomputationBuilder::compute_rows(CircuitBuilder::get_flattened_scalar_muls(msms));
+            const auto point_table_rows = ECCVMPointTablePrecomputationBuilder::compute_rows(msms);
             const auto result = ECCVMMSMMBuilder::compute_rows(
                 msms, builder.get_number_of_muls(), builder.op_queue->get_num_msm_rows());
             const auto& msm_rows = std::get<0>(result);
@@ -786,7 +785,7 @@ class ECCVMFlavor {
 
             for (auto [polynomial, commitment] :
                  zip_view(proving_key->polynomials.get_precomputed(), this->get_all())) {
-                commitment = proving_key->commitment_key->commit(polynomial);
+                commitment = proving_key->commitment_key->commit_fixed(polynomial);
             }
         }
         // TODO(https://github.com/AztecProtocol/barretenberg/issues/1324): Remove `circuit_size` and `log_circuit_size`
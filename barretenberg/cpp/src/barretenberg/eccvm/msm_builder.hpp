@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 
 #include "./eccvm_builder_types.hpp"
@@ -51,6 +52,37 @@ class ECCVMMSMMBuilder {
         FF accumulator_y = 0;
     };
 
+    /**
+     * @brief Splits the MSMs into contiguous segments of roughly equal numbers of rows, one segment per thread.
+     *
+     * @param msm_row_counts The row each MSM starts at, followed by the row after the last MSM
+     * @return std::vector<size_t> The index of the first MSM in each segment, followed by the number of MSMs
+     */
+    static std::vector<size_t> compute_msm_segments(const std::vector<size_t>& msm_row_counts)
+    {
+        const size_t num_msms = msm_row_counts.size() - 1;
+        const size_t first_row = msm_row_counts.front();
+        const size_t num_rows = msm_row_counts.back() - first_row;
+        const size_t num_segments = std::max<size_t>(std::min(get_num_cpus(), num_msms), 1);
+
+        std::vector<size_t> segments;
+        segments.reserve(num_segments + 1);
+        segments.push_back(0);
+        size_t msm_idx = 0;
+        for (size_t segment = 1; segment < num_segments; ++segment) {
+            // each segment ends at the first MSM starting at or beyond its share of the rows
+            const size_t target_row = first_row + ((num_rows * segment) / num_segments);
+            while (msm_idx < num_msms && msm_row_counts[msm_idx] < target_row) {
+                msm_idx++;
+            }
+            if (msm_idx > segments.back() && msm_idx < num_msms) {
+                segments.push_back(msm_idx);
+            }
+        }
+        segments.push_back(num_msms);
+        return segments;
+    }
+
     /**
      * @brief Computes the row values for the Straus MSM columns of the ECCVM.
      *
@@ -91,13 +123,9 @@ class ECCVMMSMMBuilder {
 
         const size_t num_rows_in_read_counts_table =
             static_cast<size_t>(total_number_of_muls) * (eccvm::POINT_TABLE_SIZE >> 1);
-        std::array<std::vector<size_t>, 2> point_table_read_counts;
-        point_table_read_counts[0].reserve(num_rows_in_read_counts_table);
-        point_table_read_counts[1].reserve(num_rows_in_read_counts_table);
-        for (size_t i = 0; i < num_rows_in_read_counts_table; ++i) {
-            point_table_read_counts[0].emplace_back(0);
-            point_table_read_counts[1].emplace_back(0);
-        }
+        std::array<std::vector<size_t>, 2> point_table_read_counts{
+            std::vector<size_t>(num_rows_in_read_counts_table, 0), std::vector<size_t>(num_rows_in_read_counts_table, 0)
+        };
 
         const auto update_read_count = [&point_table_read_counts](const size_t point_idx, const int slice) {
             /**
@@ -136,6 +164,12 @@ class ECCVMMSMMBuilder {
         }
         ASSERT(pc_values.back() == 0);
 
+        // MSMs are independent of one another: each one starts its accumulator at the offset generator, and owns a
+        // disjoint range of rows, point trace entries and read counts, given by the prefix sums above. We split the
+        // MSMs into contiguous segments with a similar number of rows and fill each segment on its own thread.
+        const std::vector<size_t> msm_segments = compute_msm_segments(msm_row_counts);
+        const size_t num_segments = msm_segments.size() - 1;
+
         // compute the MSM rows
 
         std::vector<MSMRow> msm_rows(num_msm_rows);
@@ -143,52 +177,53 @@ class ECCVMMSMMBuilder {
         msm_rows[0] = (MSMRow{});
         // compute "read counts" so that we can determine the number of times entries in our log-derivative lookup
         // tables are called.
-        // Note: this part is single-threaded. The amount of compute is low, however, so this is likely not a big
-        // concern.
-        for (size_t msm_idx = 0; msm_idx < msms.size(); ++msm_idx) {
-            for (size_t digit_idx = 0; digit_idx < NUM_WNAF_DIGITS_PER_SCALAR; ++digit_idx) {
-                auto pc = static_cast<uint32_t>(pc_values[msm_idx]);
-                const auto& msm = msms[msm_idx];
-                const size_t msm_size = msm.size();
-                const size_t num_rows_per_digit =
-                    (msm_size / ADDITIONS_PER_ROW) + ((msm_size % ADDITIONS_PER_ROW != 0) ? 1 : 0);
-
-                for (size_t relative_row_idx = 0; relative_row_idx < num_rows_per_digit; ++relative_row_idx) {
-                    const size_t num_points_in_row = (relative_row_idx + 1) * ADDITIONS_PER_ROW > msm_size
-                                                         ? (msm_size % ADDITIONS_PER_ROW)
-                                                         : ADDITIONS_PER_ROW;
-                    const size_t offset = relative_row_idx * ADDITIONS_PER_ROW;
-                    for (size_t relative_point_idx = 0; relative_point_idx < ADDITIONS_PER_ROW; ++relative_point_idx) {
-                        const size_t point_idx = offset + relative_point_idx;
-                        const bool add = num_points_in_row > relative_point_idx;
-                        if (add) {
-                            int slice = msm[point_idx].wnaf_digits[digit_idx];
-                            // pc starts at total_number_of_muls and decreses non-uniformly to 0
-                            update_read_count((total_number_of_muls - pc) + point_idx, slice);
-                        }
-                    }
-                }
-
-                if (digit_idx == NUM_WNAF_DIGITS_PER_SCALAR - 1) {
-                    for (size_t row_idx = 0; row_idx < num_rows_per_digit; ++row_idx) {
-                        const size_t num_points_in_row = (row_idx + 1) * ADDITIONS_PER_ROW > msm_size
+        parallel_for(num_segments, [&](size_t segment) {
+            for (size_t msm_idx = msm_segments[segment]; msm_idx < msm_segments[segment + 1]; ++msm_idx) {
+                for (size_t digit_idx = 0; digit_idx < NUM_WNAF_DIGITS_PER_SCALAR; ++digit_idx) {
+                    auto pc = static_cast<uint32_t>(pc_values[msm_idx]);
+                    const auto& msm = msms[msm_idx];
+                    const size_t msm_size = msm.size();
+                    const size_t num_rows_per_digit =
+                        (msm_size / ADDITIONS_PER_ROW) + ((msm_size % ADDITIONS_PER_ROW != 0) ? 1 : 0);
+
+                    for (size_t relative_row_idx = 0; relative_row_idx < num_rows_per_digit; ++relative_row_idx) {
+                        const size_t num_points_in_row = (relative_row_idx + 1) * ADDITIONS_PER_ROW > msm_size
                                                              ? (msm_size % ADDITIONS_PER_ROW)
                                                              : ADDITIONS_PER_ROW;
-                        const size_t offset = row_idx * ADDITIONS_PER_ROW;
+                        const size_t offset = relative_row_idx * ADDITIONS_PER_ROW;
                         for (size_t relative_point_idx = 0; relative_point_idx < ADDITIONS_PER_ROW;
                              ++relative_point_idx) {
-                            bool add = num_points_in_row > relative_point_idx;
                             const size_t point_idx = offset + relative_point_idx;
+                            const bool add = num_points_in_row > relative_point_idx;
                             if (add) {
+                                int slice = msm[point_idx].wnaf_digits[digit_idx];
                                 // pc starts at total_number_of_muls and decreses non-uniformly to 0
-                                int slice = msm[point_idx].wnaf_skew ? -1 : -15;
                                 update_read_count((total_number_of_muls - pc) + point_idx, slice);
                             }
                         }
                     }
+
+                    if (digit_idx == NUM_WNAF_DIGITS_PER_SCALAR - 1) {
+                        for (size_t row_idx = 0; row_idx < num_rows_per_digit; ++row_idx) {
+                            const size_t num_points_in_row = (row_idx + 1) * ADDITIONS_PER_ROW > msm_size
+                                                                 ? (msm_size % ADDITIONS_PER_ROW)
+                                                                 : ADDITIONS_PER_ROW;
+                            const size_t offset = row_idx * ADDITIONS_PER_ROW;
+                            for (size_t relative_point_idx = 0; relative_point_idx < ADDITIONS_PER_ROW;
+                                 ++relative_point_idx) {
+                                bool add = num_points_in_row > relative_point_idx;
+                                const size_t point_idx = offset + relative_point_idx;
+                                if (add) {
+                                    // pc starts at total_number_of_muls and decreses non-uniformly to 0
+                                    int slice = msm[point_idx].wnaf_skew ? -1 : -15;
+                                    update_read_count((total_number_of_muls - pc) + point_idx, slice);
+                                }
+                            }
+                        }
+                    }
                 }
             }
-        }
+        });
 
         // The execution trace data for the MSM columns requires knowledge of intermediate values from *affine* point
         // addition. The naive solution to compute this data requires 2 field inversions per in-circuit group addition
@@ -210,7 +245,8 @@ class ECCVMMSMMBuilder {
         std::span<Element> p2_trace(&points_to_normalize[num_point_adds_and_doubles], num_point_adds_and_doubles);
         std::span<Element> p3_trace(&points_to_normalize[num_point_adds_and_doubles * 2], num_point_adds_and_doubles);
         // operation_trace records whether an entry in the p1/p2/p3 trace represents a point addition or doubling
-        std::vector<bool> operation_trace(num_point_adds_and_doubles);
+        // (not a std::vector<bool>, neighbouring entries are written by different threads)
+        std::vector<uint8_t> operation_trace(num_point_adds_and_doubles);
         // accumulator_trace tracks the value of the ECCVM accumulator for each row
         std::span<Element> accumulator_trace(&points_to_normalize[num_point_adds_and_doubles * 3], num_accumulators);
 
@@ -218,133 +254,133 @@ class ECCVMMSMMBuilder {
         constexpr auto offset_generator = bb::g1::derive_generators("ECCVM_OFFSET_GENERATOR", 1)[0];
         accumulator_trace[0] = offset_generator;
 
-        // TODO(https://github.com/AztecProtocol/barretenberg/issues/973): Reinstate multitreading?
         // populate point trace, and the components of the MSM execution trace that do not relate to affine point
         // operations
-        for (size_t msm_idx = 0; msm_idx < msms.size(); msm_idx++) {
-            Element accumulator = offset_generator;
-            const auto& msm = msms[msm_idx];
-            size_t msm_row_index = msm_row_counts[msm_idx];
-            const size_t msm_size = msm.size();
-            const size_t num_rows_per_digit =
-                (msm_size / ADDITIONS_PER_ROW) + ((msm_size % ADDITIONS_PER_ROW != 0) ? 1 : 0);
-            size_t trace_index = (msm_row_counts[msm_idx] - 1) * 4;
-
-            for (size_t digit_idx = 0; digit_idx < NUM_WNAF_DIGITS_PER_SCALAR; ++digit_idx) {
-                const auto pc = static_cast<uint32_t>(pc_values[msm_idx]);
-                for (size_t row_idx = 0; row_idx < num_rows_per_digit; ++row_idx) {
-                    const size_t num_points_in_row = (row_idx + 1) * ADDITIONS_PER_ROW > msm_size
-                                                         ? (msm_size % ADDITIONS_PER_ROW)
-                                                         : ADDITIONS_PER_ROW;
-                    auto& row = msm_rows[msm_row_index];
-                    const size_t offset = row_idx * ADDITIONS_PER_ROW;
-                    row.msm_transition = (digit_idx == 0) && (row_idx == 0);
-                    for (size_t point_idx = 0; point_idx < ADDITIONS_PER_ROW; ++point_idx) {
-
-                        auto& add_state = row.add_state[point_idx];
-                        add_state.add = num_points_in_row > point_idx;
-                        int slice = add_state.add ? msm[offset + point_idx].wnaf_digits[digit_idx] : 0;
-                        // In the MSM columns in the ECCVM circuit, we can add up to 4 points per row.
-                        // if `row.add_state[point_idx].add = 1`, this indicates that we want to add the
-                        // `point_idx`'th point in the MSM columns into the MSM accumulator `add_state.slice` = A
-                        // 4-bit WNAF slice of the scalar multiplier associated with the point we are adding (the
-                        // specific slice chosen depends on the value of msm_round) (WNAF =
-                        // windowed-non-adjacent-form. Value range is `-15, -13,
-                        // ..., 15`) If `add_state.add = 1`, we want `add_state.slice` to be the *compressed*
-                        // form of the WNAF slice value. (compressed = no gaps in the value range. i.e. -15,
-                        // -13, ..., 15 maps to 0, ... , 15)
-                        add_state.slice = add_state.add ? (slice + 15) / 2 : 0;
-                        add_state.point =
-                            add_state.add
-                                ? msm[offset + point_idx].precomputed_table[static_cast<size_t>(add_state.slice)]
-                                : AffineElement{ 0, 0 };
-
-                        Element p1(accumulator);
-                        Element p2(add_state.point);
-                        accumulator = add_state.add ? (accumulator + add_state.point) : Element(p1);
-                        p1_trace[trace_index] = p1;
-                        p2_trace[trace_index] = p2;
-                        p3_trace[trace_index] = accumulator;
-                        operation_trace[trace_index] = false;
-                        trace_index++;
-                    }
-                    accumulator_trace[msm_row_index] = accumulator;
-                    row.q_add = true;
-                    row.q_double = false;
-                    row.q_skew = false;
-                    row.msm_round = static_cast<uint32_t>(digit_idx);
-                    row.msm_size = static_cast<uint32_t>(msm_size);
-                    row.msm_count = static_cast<uint32_t>(offset);
-                    row.pc = pc;
-                    msm_row_index++;
-                }
-                // doubling
-                if (digit_idx < NUM_WNAF_DIGITS_PER_SCALAR - 1) {
-                    auto& row = msm_rows[msm_row_index];
-                    row.msm_transition = false;
-                    row.msm_round = static_cast<uint32_t>(digit_idx + 1);
-                    row.msm_size = static_cast<uint32_t>(msm_size);
-                    row.msm_count = static_cast<uint32_t>(0);
-                    row.q_add = false;
-                    row.q_double = true;
-                    row.q_skew = false;
-                    for (size_t point_idx = 0; point_idx < ADDITIONS_PER_ROW; ++point_idx) {
-                        auto& add_state = row.add_state[point_idx];
-                        add_state.add = false;
-                        add_state.slice = 0;
-                        add_state.point = { 0, 0 };
-                        add_state.collision_inverse = 0;
-
-                        p1_trace[trace_index] = accumulator;
-                        p2_trace[trace_index] = accumulator;
-                        accumulator = accumulator.dbl();
-                        p3_trace[trace_index] = accumulator;
-                        operation_trace[trace_index] = true;
-                        trace_index++;
-                    }
-                    accumulator_trace[msm_row_index] = accumulator;
-                    msm_row_index++;
-                } else {
-                    for (size_t row_idx = 0; row_idx < num_rows_per_digit; ++row_idx) {
-                        auto& row = msm_rows[msm_row_index];
+        parallel_for(num_segments, [&](size_t segment) {
+            for (size_t msm_idx = msm_segments[segment]; msm_idx < msm_segments[segment + 1]; ++msm_idx) {
+                Element accumulator = offset_generator;
+                const auto& msm = msms[msm_idx];
+                size_t msm_row_index = msm_row_counts[msm_idx];
+                const size_t msm_size = msm.size();
+                const size_t num_rows_per_digit =
+                    (msm_size / ADDITIONS_PER_ROW) + ((msm_size % ADDITIONS_PER_ROW != 0) ? 1 : 0);
+                size_t trace_index = (msm_row_counts[msm_idx] - 1) * 4;
 
+                for (size_t digit_idx = 0; digit_idx < NUM_WNAF_DIGITS_PER_SCALAR; ++digit_idx) {
+                    const auto pc = static_cast<uint32_t>(pc_values[msm_idx]);
+                    for (size_t row_idx = 0; row_idx < num_rows_per_digit; ++row_idx) {
                         const size_t num_points_in_row = (row_idx + 1) * ADDITIONS_PER_ROW > msm_size
-                                                             ? msm_size % ADDITIONS_PER_ROW
+                                                             ? (msm_size % ADDITIONS_PER_ROW)
                                                              : ADDITIONS_PER_ROW;
+                        auto& row = msm_rows[msm_row_index];
                         const size_t offset = row_idx * ADDITIONS_PER_ROW;
-                        row.msm_transition = false;
-                        Element acc_expected = accumulator;
+                        row.msm_transition = (digit_idx == 0) && (row_idx == 0);
                         for (size_t point_idx = 0; point_idx < ADDITIONS_PER_ROW; ++point_idx) {
+
                             auto& add_state = row.add_state[point_idx];
                             add_state.add = num_points_in_row > point_idx;
-                            add_state.slice = add_state.add ? msm[offset + point_idx].wnaf_skew ? 7 : 0 : 0;
-
+                            int slice = add_state.add ? msm[offset + point_idx].wnaf_digits[digit_idx] : 0;
+                            // In the MSM columns in the ECCVM circuit, we can add up to 4 points per row.
+                            // if `row.add_state[point_idx].add = 1`, this indicates that we want to add the
+                            // `point_idx`'th point in the MSM columns into the MSM accumulator `add_state.slice` = A
+                            // 4-bit WNAF slice of the scalar multiplier associated with the point we are adding (the
+                            // specific slice chosen depends on the value of msm_round) (WNAF =
+                            // windowed-non-adjacent-form. Value range is `-15, -13,
+                            // ..., 15`) If `add_state.add = 1`, we want `add_state.slice` to be the *compressed*
+                            // form of the WNAF slice value. (compressed = no gaps in the value range. i.e. -15,
+                            // -13, ..., 15 maps to 0, ... , 15)
+                            add_state.slice = add_state.add ? (slice + 15) / 2 : 0;
                             add_state.point =
                                 add_state.add
                                     ? msm[offset + point_idx].precomputed_table[static_cast<size_t>(add_state.slice)]
                                     : AffineElement{ 0, 0 };
-                            bool add_predicate = add_state.add ? msm[offset + point_idx].wnaf_skew : false;
-                            auto p1 = accumulator;
-                            accumulator = add_predicate ? accumulator + add_state.point : accumulator;
+
+                            Element p1(accumulator);
+                            Element p2(add_state.point);
+                            accumulator = add_state.add ? (accumulator + add_state.point) : Element(p1);
                             p1_trace[trace_index] = p1;
-                            p2_trace[trace_index] = add_state.point;
+                            p2_trace[trace_index] = p2;
                             p3_trace[trace_index] = accumulator;
-                            operation_trace[trace_index] = false;
+                            operation_trace[trace_index] = 0;
                             trace_index++;
                         }
-                        row.q_add = false;
+                        accumulator_trace[msm_row_index] = accumulator;
+                        row.q_add = true;
                         row.q_double = false;
-                        row.q_skew = true;
-                        row.msm_round = static_cast<uint32_t>(digit_idx + 1);
+                        row.q_skew = false;
+                        row.msm_round = static_cast<uint32_t>(digit_idx);
                         row.msm_size = static_cast<uint32_t>(msm_size);
                         row.msm_count = static_cast<uint32_t>(offset);
                         row.pc = pc;
+                        msm_row_index++;
+                    }
+                    // doubling
+                    if (digit_idx < NUM_WNAF_DIGITS_PER_SCALAR - 1) {
+                        auto& row = msm_rows[msm_row_index];
+                        row.msm_transition = false;
+                        row.msm_round = static_cast<uint32_t>(digit_idx + 1);
+                        row.msm_size = static_cast<uint32_t>(msm_size);
+                        row.msm_count = static_cast<uint32_t>(0);
+                        row.q_add = false;
+                        row.q_double = true;
+                        row.q_skew = false;
+                        for (size_t point_idx = 0; point_idx < ADDITIONS_PER_ROW; ++point_idx) {
+                            auto& add_state = row.add_state[point_idx];
+                            add_state.add = false;
+                            add_state.slice = 0;
+                            add_state.point = { 0, 0 };
+                            add_state.collision_inverse = 0;
+
+                            p1_trace[trace_index] = accumulator;
+                            p2_trace[trace_index] = accumulator;
+                            accumulator = accumulator.dbl();
+                            p3_trace[trace_index] = accumulator;
+                            operation_trace[trace_index] = 1;
+                            trace_index++;
+                        }
                         accumulator_trace[msm_row_index] = accumulator;
                         msm_row_index++;
+                    } else {
+                        for (size_t row_idx = 0; row_idx < num_rows_per_digit; ++row_idx) {
+                            auto& row = msm_rows[msm_row_index];
+
+                            const size_t num_points_in_row = (row_idx + 1) * ADDITIONS_PER_ROW > msm_size
+                                                                 ? msm_size % ADDITIONS_PER_ROW
+                                                                 : ADDITIONS_PER_ROW;
+                            const size_t offset = row_idx * ADDITIONS_PER_ROW;
+                            row.msm_transition = false;
+                            Element acc_expected = accumulator;
+                            for (size_t point_idx = 0; point_idx < ADDITIONS_PER_ROW; ++point_idx) {
+                                auto& add_state = row.add_state[point_idx];
+                                add_state.add = num_points_in_row > point_idx;
+                                add_state.slice = add_state.add ? msm[offset + point_idx].wnaf_skew ? 7 : 0 : 0;
+
+                                const auto table_index = static_cast<size_t>(add_state.slice);
+                                add_state.point = add_state.add ? msm[offset + point_idx].precomputed_table[table_index]
+                                                                : AffineElement{ 0, 0 };
+                                bool add_predicate = add_state.add ? msm[offset + point_idx].wnaf_skew : false;
+                                auto p1 = accumulator;
+                                accumulator = add_predicate ? accumulator + add_state.point : accumulator;
+                                p1_trace[trace_index] = p1;
+                                p2_trace[trace_index] = add_state.point;
+                                p3_trace[trace_index] = accumulator;
+                                operation_trace[trace_index] = 0;
+                                trace_index++;
+                            }
+                            row.q_add = false;
+                            row.q_double = false;
+                            row.q_skew = true;
+                            row.msm_round = static_cast<uint32_t>(digit_idx + 1);
+                            row.msm_size = static_cast<uint32_t>(msm_size);
+                            row.msm_count = static_cast<uint32_t>(offset);
+                            row.pc = pc;
+                            accumulator_trace[msm_row_index] = accumulator;
+                            msm_row_index++;
+                        }
                     }
                 }
             }
-        }
+        });
 
         // Normalize the points in the point trace
         parallel_for_range(points_to_normalize.size(), [&](size_t start, size_t end) {
@@ -361,85 +397,87 @@ class ECCVMMSMMBuilder {
                     inverse_trace[operation_idx] = (p2_trace[operation_idx].x - p1_trace[operation_idx].x);
                 }
             }
-            FF::batch_invert(&inverse_trace[start], end - start);
         });
+        FF::parallel_batch_invert(inverse_trace);
 
         // complete the computation of the ECCVM execution trace, by adding the affine intermediate point data
         // i.e. row.accumulator_x, row.accumulator_y, row.add_state[0...3].collision_inverse,
         // row.add_state[0...3].lambda
-        for (size_t msm_idx = 0; msm_idx < msms.size(); msm_idx++) {
-            const auto& msm = msms[msm_idx];
-            size_t trace_index = ((msm_row_counts[msm_idx] - 1) * ADDITIONS_PER_ROW);
-            size_t msm_row_index = msm_row_counts[msm_idx];
-            // 1st MSM row will have accumulator equal to the previous MSM output
-            // (or point at infinity for 1st MSM)
-            size_t accumulator_index = msm_row_counts[msm_idx] - 1;
-            const size_t msm_size = msm.size();
-            const size_t num_rows_per_digit =
-                (msm_size / ADDITIONS_PER_ROW) + ((msm_size % ADDITIONS_PER_ROW != 0) ? 1 : 0);
-
-            for (size_t digit_idx = 0; digit_idx < NUM_WNAF_DIGITS_PER_SCALAR; ++digit_idx) {
-                for (size_t row_idx = 0; row_idx < num_rows_per_digit; ++row_idx) {
-                    auto& row = msm_rows[msm_row_index];
-                    const Element& normalized_accumulator = accumulator_trace[accumulator_index];
-                    ASSERT(normalized_accumulator.is_point_at_infinity() == 0);
-                    row.accumulator_x = normalized_accumulator.x;
-                    row.accumulator_y = normalized_accumulator.y;
-                    for (size_t point_idx = 0; point_idx < ADDITIONS_PER_ROW; ++point_idx) {
-                        auto& add_state = row.add_state[point_idx];
-                        const auto& inverse = inverse_trace[trace_index];
-                        const auto& p1 = p1_trace[trace_index];
-                        const auto& p2 = p2_trace[trace_index];
-                        add_state.collision_inverse = add_state.add ? inverse : 0;
-                        add_state.lambda = add_state.add ? (p2.y - p1.y) * inverse : 0;
-                        trace_index++;
-                    }
-                    accumulator_index++;
-                    msm_row_index++;
-                }
+        parallel_for(num_segments, [&](size_t segment) {
+            for (size_t msm_idx = msm_segments[segment]; msm_idx < msm_segments[segment + 1]; ++msm_idx) {
+                const auto& msm = msms[msm_idx];
+                size_t trace_index = ((msm_row_counts[msm_idx] - 1) * ADDITIONS_PER_ROW);
+                size_t msm_row_index = msm_row_counts[msm_idx];
+                // 1st MSM row will have accumulator equal to the previous MSM output
+                // (or point at infinity for 1st MSM)
+                size_t accumulator_index = msm_row_counts[msm_idx] - 1;
+                const size_t msm_size = msm.size();
+                const size_t num_rows_per_digit =
+                    (msm_size / ADDITIONS_PER_ROW) + ((msm_size % ADDITIONS_PER_ROW != 0) ? 1 : 0);
 
-                if (digit_idx < NUM_WNAF_DIGITS_PER_SCALAR - 1) {
-                    MSMRow& row = msm_rows[msm_row_index];
-                    const Element& normalized_accumulator = accumulator_trace[accumulator_index];
-                    const FF& acc_x = normalized_accumulator.is_point_at_infinity() ? 0 : normalized_accumulator.x;
-                    const FF& acc_y = normalized_accumulator.is_point_at_infinity() ? 0 : normalized_accumulator.y;
-                    row.accumulator_x = acc_x;
-                    row.accumulator_y = acc_y;
-                    for (size_t point_idx = 0; point_idx < ADDITIONS_PER_ROW; ++point_idx) {
-                        auto& add_state = row.add_state[point_idx];
-                        add_state.collision_inverse = 0;
-                        const FF& dx = p1_trace[trace_index].x;
-                        const FF& inverse = inverse_trace[trace_index];
-                        add_state.lambda = ((dx + dx + dx) * dx) * inverse;
-                        trace_index++;
-                    }
-                    accumulator_index++;
-                    msm_row_index++;
-                } else {
+                for (size_t digit_idx = 0; digit_idx < NUM_WNAF_DIGITS_PER_SCALAR; ++digit_idx) {
                     for (size_t row_idx = 0; row_idx < num_rows_per_digit; ++row_idx) {
-                        MSMRow& row = msm_rows[msm_row_index];
+                        auto& row = msm_rows[msm_row_index];
                         const Element& normalized_accumulator = accumulator_trace[accumulator_index];
                         ASSERT(normalized_accumulator.is_point_at_infinity() == 0);
-                        const size_t offset = row_idx * ADDITIONS_PER_ROW;
                         row.accumulator_x = normalized_accumulator.x;
                         row.accumulator_y = normalized_accumulator.y;
                         for (size_t point_idx = 0; point_idx < ADDITIONS_PER_ROW; ++point_idx) {
                             auto& add_state = row.add_state[point_idx];
-                            bool add_predicate = add_state.add ? msm[offset + point_idx].wnaf_skew : false;
-
                             const auto& inverse = inverse_trace[trace_index];
                             const auto& p1 = p1_trace[trace_index];
                             const auto& p2 = p2_trace[trace_index];
-                            add_state.collision_inverse = add_predicate ? inverse : 0;
-                            add_state.lambda = add_predicate ? (p2.y - p1.y) * inverse : 0;
+                            add_state.collision_inverse = add_state.add ? inverse : 0;
+                            add_state.lambda = add_state.add ? (p2.y - p1.y) * inverse : 0;
                             trace_index++;
                         }
                         accumulator_index++;
                         msm_row_index++;
                     }
+
+                    if (digit_idx < NUM_WNAF_DIGITS_PER_SCALAR - 1) {
+                        MSMRow& row = msm_rows[msm_row_index];
+                        const Element& normalized_accumulator = accumulator_trace[accumulator_index];
+                        const FF& acc_x = normalized_accumulator.is_point_at_infinity() ? 0 : normalized_accumulator.x;
+                        const FF& acc_y = normalized_accumulator.is_point_at_infinity() ? 0 : normalized_accumulator.y;
+                        row.accumulator_x = acc_x;
+                        row.accumulator_y = acc_y;
+                        for (size_t point_idx = 0; point_idx < ADDITIONS_PER_ROW; ++point_idx) {
+                            auto& add_state = row.add_state[point_idx];
+                            add_state.collision_inverse = 0;
+                            const FF& dx = p1_trace[trace_index].x;
+                            const FF& inverse = inverse_trace[trace_index];
+                            add_state.lambda = ((dx + dx + dx) * dx) * inverse;
+                            trace_index++;
+                        }
+                        accumulator_index++;
+                        msm_row_index++;
+                    } else {
+                        for (size_t row_idx = 0; row_idx < num_rows_per_digit; ++row_idx) {
+                            MSMRow& row = msm_rows[msm_row_index];
+                            const Element& normalized_accumulator = accumulator_trace[accumulator_index];
+                            ASSERT(normalized_accumulator.is_point_at_infinity() == 0);
+                            const size_t offset = row_idx * ADDITIONS_PER_ROW;
+                            row.accumulator_x = normalized_accumulator.x;
+                            row.accumulator_y = normalized_accumulator.y;
+                            for (size_t point_idx = 0; point_idx < ADDITIONS_PER_ROW; ++point_idx) {
+                                auto& add_state = row.add_state[point_idx];
+                                bool add_predicate = add_state.add ? msm[offset + point_idx].wnaf_skew : false;
+
+                                const auto& inverse = inverse_trace[trace_index];
+                                const auto& p1 = p1_trace[trace_index];
+                                const auto& p2 = p2_trace[trace_index];
+                                add_state.collision_inverse = add_predicate ? inverse : 0;
+                                add_state.lambda = add_predicate ? (p2.y - p1.y) * inverse : 0;
+                                trace_index++;
+                            }
+                            accumulator_index++;
+                            msm_row_index++;
+                        }
+                    }
                 }
             }
-        }
+        });
 
         // populate the final row in the MSM execution trace.
         // we always require 1 extra row at the end of the trace, because the accumulator x/y coordinates for row `i`
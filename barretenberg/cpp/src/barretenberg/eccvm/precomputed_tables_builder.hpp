@@ -42,77 +42,119 @@ class ECCVMPointTablePrecomputationBuilder {
     static std::vector<PointTablePrecoputationRow> compute_rows(
         const std::vector<bb::eccvm::ScalarMul<CycleGroup>>& ecc_muls)
     {
-        static constexpr size_t num_rows_per_scalar = NUM_WNAF_DIGITS_PER_SCALAR / WNAF_DIGITS_PER_ROW;
+        std::vector<const bb::eccvm::ScalarMul<CycleGroup>*> entries(ecc_muls.size());
+        for (size_t j = 0; j < ecc_muls.size(); j++) {
+            entries[j] = &ecc_muls[j];
+        }
+        return compute_rows_for_scalar_muls(entries);
+    }
+
+    /**
+     * @brief Computes the rows straight from the MSMs, rather than from a flattened copy of their scalar muls.
+     * @details The rows of each scalar mul start at its index among all muls, which we get from a prefix sum of the
+     * MSM sizes.
+     */
+    static std::vector<PointTablePrecoputationRow> compute_rows(const std::vector<bb::eccvm::MSM<CycleGroup>>& msms)
+    {
+        std::vector<size_t> mul_offsets(msms.size() + 1, 0);
+        for (size_t i = 0; i < msms.size(); i++) {
+            mul_offsets[i + 1] = mul_offsets[i] + msms[i].size();
+        }
+        std::vector<const bb::eccvm::ScalarMul<CycleGroup>*> entries(mul_offsets.back());
+        parallel_for_range(msms.size(), [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; i++) {
+                for (size_t j = 0; j < msms[i].size(); j++) {
+                    entries[mul_offsets[i] + j] = &msms[i][j];
+                }
+            }
+        });
+        return compute_rows_for_scalar_muls(entries);
+    }
+
+  private:
+    static constexpr size_t num_rows_per_scalar = NUM_WNAF_DIGITS_PER_SCALAR / WNAF_DIGITS_PER_ROW;
+
+    static std::vector<PointTablePrecoputationRow> compute_rows_for_scalar_muls(
+        const std::vector<const bb::eccvm::ScalarMul<CycleGroup>*>& ecc_muls)
+    {
         const size_t num_precompute_rows = num_rows_per_scalar * ecc_muls.size() + 1;
         std::vector<PointTablePrecoputationRow> precompute_state(num_precompute_rows);
 
         // start with empty row (shiftable polynomials must have 0 as first coefficient)
         precompute_state[0] = PointTablePrecoputationRow{};
 
-        // current impl doesn't work if not 4
-        static_assert(WNAF_DIGITS_PER_ROW == 4);
-
         parallel_for_range(ecc_muls.size(), [&](size_t start, size_t end) {
             for (size_t j = start; j < end; j++) {
-                const auto& entry = ecc_muls[j];
-                const auto& slices = entry.wnaf_digits;
-                uint256_t scalar_sum = 0;
-
-                for (size_t i = 0; i < num_rows_per_scalar; ++i) {
-                    PointTablePrecoputationRow row;
-                    const int slice0 = slices[i * WNAF_DIGITS_PER_ROW];
-                    const int slice1 = slices[i * WNAF_DIGITS_PER_ROW + 1];
-                    const int slice2 = slices[i * WNAF_DIGITS_PER_ROW + 2];
-                    const int slice3 = slices[i * WNAF_DIGITS_PER_ROW + 3];
-
-                    const int slice0base2 = (slice0 + 15) / 2;
-                    const int slice1base2 = (slice1 + 15) / 2;
-                    const int slice2base2 = (slice2 + 15) / 2;
-                    const int slice3base2 = (slice3 + 15) / 2;
-
-                    // convert into 2-bit chunks
-                    row.s1 = slice0base2 >> 2;
-                    row.s2 = slice0base2 & 3;
-                    row.s3 = slice1base2 >> 2;
-                    row.s4 = slice1base2 & 3;
-                    row.s5 = slice2base2 >> 2;
-                    row.s6 = slice2base2 & 3;
-                    row.s7 = slice3base2 >> 2;
-                    row.s8 = slice3base2 & 3;
-                    bool last_row = (i == num_rows_per_scalar - 1);
-
-                    row.skew = last_row ? entry.wnaf_skew : false;
-
-                    row.scalar_sum = scalar_sum;
-
-                    // N.B. we apply a constraint that requires slice1 to be positive for the 1st row of each scalar
-                    // sum. This ensures we do not have WNAF representations of negative values
-                    const int row_chunk = slice3 + slice2 * (1 << 4) + slice1 * (1 << 8) + slice0 * (1 << 12);
-
-                    bool chunk_negative = row_chunk < 0;
-
-                    scalar_sum = scalar_sum << (NUM_WNAF_DIGIT_BITS * WNAF_DIGITS_PER_ROW);
-                    if (chunk_negative) {
-                        scalar_sum -= static_cast<uint64_t>(-row_chunk);
-                    } else {
-                        scalar_sum += static_cast<uint64_t>(row_chunk);
-                    }
-                    row.round = static_cast<uint32_t>(i);
-                    row.point_transition = last_row;
-                    row.pc = entry.pc;
-
-                    if (last_row) {
-                        ASSERT(scalar_sum - entry.wnaf_skew == entry.scalar);
-                    }
-
-                    row.precompute_double = entry.precomputed_table[bb::eccvm::POINT_TABLE_SIZE];
-                    // fill accumulator in reverse order i.e. first row = 15[P], then 13[P], ..., 1[P]
-                    row.precompute_accumulator = entry.precomputed_table[bb::eccvm::POINT_TABLE_SIZE - 1 - i];
-                    precompute_state[j * num_rows_per_scalar + i + 1] = (row);
-                }
+                compute_rows_for_scalar_mul(*ecc_muls[j], &precompute_state[j * num_rows_per_scalar + 1]);
             }
         });
         return precompute_state;
     }
+
+    /**
+     * @brief Fills the num_rows_per_scalar rows of a single scalar mul, starting at rows.
+     */
+    static void compute_rows_for_scalar_mul(const bb::eccvm::ScalarMul<CycleGroup>& entry,
+                                            PointTablePrecoputationRow* rows)
+    {
+        // current impl doesn't work if not 4
+        static_assert(WNAF_DIGITS_PER_ROW == 4);
+
+        const auto& slices = entry.wnaf_digits;
+        uint256_t scalar_sum = 0;
+
+        for (size_t i = 0; i < num_rows_per_scalar; ++i) {
+            PointTablePrecoputationRow row;
+            const int slice0 = slices[i * WNAF_DIGITS_PER_ROW];
+            const int slice1 = slices[i * WNAF_DIGITS_PER_ROW + 1];
+            const int slice2 = slices[i * WNAF_DIGITS_PER_ROW + 2];
+            const int slice3 = slices[i * WNAF_DIGITS_PER_ROW + 3];
+
+            const int slice0base2 = (slice0 + 15) / 2;
+            const int slice1base2 = (slice1 + 15) / 2;
+            const int slice2base2 = (slice2 + 15) / 2;
+            const int slice3base2 = (slice3 + 15) / 2;
+
+            // convert into 2-bit chunks
+            row.s1 = slice0base2 >> 2;
+            row.s2 = slice0base2 & 3;
+            row.s3 = slice1base2 >> 2;
+            row.s4 = slice1base2 & 3;
+            row.s5 = slice2base2 >> 2;
+            row.s6 = slice2base2 & 3;
+            row.s7 = slice3base2 >> 2;
+            row.s8 = slice3base2 & 3;
+            bool last_row = (i == num_rows_per_scalar - 1);
+
+            row.skew = last_row ? entry.wnaf_skew : false;
+
+            row.scalar_sum = scalar_sum;
+
+            // N.B. we apply a constraint that requires slice1 to be positive for the 1st row of each scalar
+            // sum. This ensures we do not have WNAF representations of negative values
+            const int row_chunk = slice3 + slice2 * (1 << 4) + slice1 * (1 << 8) + slice0 * (1 << 12);
+
+            bool chunk_negative = row_chunk < 0;
+
+            scalar_sum = scalar_sum << (NUM_WNAF_DIGIT_BITS * WNAF_DIGITS_PER_ROW);
+            if (chunk_negative) {
+                scalar_sum -= static_cast<uint64_t>(-row_chunk);
+            } else {
+                scalar_sum += static_cast<uint64_t>(row_chunk);
+            }
+            row.round = static_cast<uint32_t>(i);
+            row.point_transition = last_row;
+            row.pc = entry.pc;
+
+            if (last_row) {
+                ASSERT(scalar_sum - entry.wnaf_skew == entry.scalar);
+            }
+
+            row.precompute_double = entry.precomputed_table[bb::eccvm::POINT_TABLE_SIZE];
+            // fill accumulator in reverse order i.e. first row = 15[P], then 13[P], ..., 1[P]
+            row.precompute_accumulator = entry.precomputed_table[bb::eccvm::POINT_TABLE_SIZE - 1 - i];
+            rows[i] = (row);
+        }
+    }
 };
 } // namespace bb
\ No newline at end of file
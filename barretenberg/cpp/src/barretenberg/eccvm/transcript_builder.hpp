@@ -7,6 +7,7 @@
 #pragma once
 
 #include "./eccvm_builder_types.hpp"
+#include "barretenberg/op_queue/ecc_ops_table.hpp"
 
 namespace bb {
 
@@ -17,6 +18,7 @@ class ECCVMTranscriptBuilder {
     using Element = typename CycleGroup::element;
     using AffineElement = typename CycleGroup::affine_element;
     using VMOperation = typename bb::VMOperation<CycleGroup>;
+    using VMOperations = EccOpsTableView<VMOperation>;
     using Accumulator = typename std::vector<Element>;
 
     struct TranscriptRow {
@@ -99,12 +101,12 @@ class ECCVMTranscriptBuilder {
      * elliptic curve operations in Jacobian coordinates, and then normalizes these points to affine coordinates. Batch
      * inversion is used to optimize expensive finite field inversions.
      *
-     * @param vm_operations ECCOpQueue
+     * @param vm_operations A view of the ECCOpQueue's ECCVM ops table
      * @param total_number_of_muls The total number of multiplications in the series of operations.
      *
      * @return A vector of TranscriptRows
      */
-    static std::vector<TranscriptRow> compute_rows(const std::vector<VMOperation>& vm_operations,
+    static std::vector<TranscriptRow> compute_rows(const VMOperations& vm_operations,
                                                    const uint32_t total_number_of_muls)
     {
         const size_t num_vm_entries = vm_operations.size();
@@ -125,6 +127,18 @@ class ECCVMTranscriptBuilder {
         Accumulator accumulator_trace(num_vm_entries);
         Accumulator intermediate_accumulator_trace(num_vm_entries);
 
+        // The scalar multiplications of mul ops don't depend on the VM state, so we compute them up front in parallel
+        // and leave only the (cheap) accumulation to the sequential pass over the ops below
+        Accumulator mul_products(num_vm_entries);
+        parallel_for_range(num_vm_entries, [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; i++) {
+                const VMOperation& entry = vm_operations[i];
+                if (entry.op_code.mul) {
+                    mul_products[i] = Element(entry.base_point) * entry.mul_scalar_full;
+                }
+            }
+        });
+
         VMState state{
             .pc = total_number_of_muls,
             .count = 0,
@@ -141,9 +155,10 @@ class ECCVMTranscriptBuilder {
         // during the first iteration over the ECCOpQueue, the operations are being performed using Jacobian
         // coordinates and the base point coordinates are recorded in the transcript. at the same time, the transcript
         // logic is being populated
+        auto next_entry = vm_operations.begin();
         for (size_t i = 0; i < num_vm_entries; i++) {
             TranscriptRow& row = transcript_state[i + 1];
-            const VMOperation& entry = vm_operations[i];
+            const VMOperation& entry = *next_entry++;
             updated_state = state;
 
             const bool is_mul = entry.op_code.mul;
@@ -172,7 +187,7 @@ class ECCVMTranscriptBuilder {
             // msm transition = current row is doing a lookup to validate output = msm output
             // i.e. next row is not part of MSM and current row is part of MSM
             //   or next row is irrelevant and current row is a straight MUL
-            const bool next_not_msm = last_row || !vm_operations[i + 1].op_code.mul;
+            const bool next_not_msm = last_row || !next_entry->op_code.mul;
 
             // we reset the count in updated state if we are not accumulating and not doing an msm
             const bool msm_transition = is_mul && next_not_msm && (state.count + num_muls > 0);
@@ -183,7 +198,7 @@ class ECCVMTranscriptBuilder {
             updated_state.count = current_ongoing_msm ? state.count + num_muls : 0;
 
             if (is_mul) {
-                process_mul(entry, updated_state, state);
+                process_mul(mul_products[i], updated_state, state);
             }
 
             if (msm_transition) {
@@ -223,57 +238,61 @@ class ECCVMTranscriptBuilder {
 
         // process the slopes when adding points or results of MSMs. to increase efficiency, we use batch inversion
         // after the loop
-        for (size_t i = 0; i < accumulator_trace.size(); ++i) {
-            TranscriptRow& row = transcript_state[i + 1];
-            const bool msm_transition = row.msm_transition;
-
-            const VMOperation& entry = vm_operations[i];
-            const bool is_add = entry.op_code.add;
-
-            if (msm_transition || is_add) {
-                // compute the differences between point coordinates
-                compute_inverse_trace_coordinates(msm_transition,
-                                                  row,
-                                                  intermediate_accumulator_trace[i],
-                                                  transcript_msm_x_inverse_trace[i],
-                                                  msm_accumulator_trace[i],
-                                                  accumulator_trace[i],
-                                                  inverse_trace_x[i],
-                                                  inverse_trace_y[i]);
-
-                // compute the numerators and denominators of slopes between the points
-                compute_lambda_numerator_and_denominator(row,
-                                                         entry,
-                                                         intermediate_accumulator_trace[i],
-                                                         accumulator_trace[i],
-                                                         add_lambda_numerator[i],
-                                                         add_lambda_denominator[i]);
-            } else {
-                row.transcript_add_x_equal = 0;
-                row.transcript_add_y_equal = 0;
-                add_lambda_numerator[i] = 0;
-                add_lambda_denominator[i] = 0;
-                inverse_trace_x[i] = 0;
-                inverse_trace_y[i] = 0;
+        parallel_for_range(num_vm_entries, [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                TranscriptRow& row = transcript_state[i + 1];
+                const bool msm_transition = row.msm_transition;
+
+                const VMOperation& entry = vm_operations[i];
+                const bool is_add = entry.op_code.add;
+
+                if (msm_transition || is_add) {
+                    // compute the differences between point coordinates
+                    compute_inverse_trace_coordinates(msm_transition,
+                                                      row,
+                                                      intermediate_accumulator_trace[i],
+                                                      transcript_msm_x_inverse_trace[i],
+                                                      msm_accumulator_trace[i],
+                                                      accumulator_trace[i],
+                                                      inverse_trace_x[i],
+                                                      inverse_trace_y[i]);
+
+                    // compute the numerators and denominators of slopes between the points
+                    compute_lambda_numerator_and_denominator(row,
+                                                             entry,
+                                                             intermediate_accumulator_trace[i],
+                                                             accumulator_trace[i],
+                                                             add_lambda_numerator[i],
+                                                             add_lambda_denominator[i]);
+                } else {
+                    row.transcript_add_x_equal = 0;
+                    row.transcript_add_y_equal = 0;
+                    add_lambda_numerator[i] = 0;
+                    add_lambda_denominator[i] = 0;
+                    inverse_trace_x[i] = 0;
+                    inverse_trace_y[i] = 0;
+                }
             }
-        }
+        });
 
         // Perform all required inversions at once
-        FF::batch_invert(&inverse_trace_x[0], num_vm_entries);
-        FF::batch_invert(&inverse_trace_y[0], num_vm_entries);
-        FF::batch_invert(&transcript_msm_x_inverse_trace[0], num_vm_entries);
-        FF::batch_invert(&add_lambda_denominator[0], num_vm_entries);
-        FF::batch_invert(&msm_count_at_transition_inverse_trace[0], num_vm_entries);
+        FF::parallel_batch_invert(inverse_trace_x);
+        FF::parallel_batch_invert(inverse_trace_y);
+        FF::parallel_batch_invert(transcript_msm_x_inverse_trace);
+        FF::parallel_batch_invert(add_lambda_denominator);
+        FF::parallel_batch_invert(msm_count_at_transition_inverse_trace);
 
         // Populate the fields of the transcript row containing inverted scalars
-        for (size_t i = 0; i < num_vm_entries; ++i) {
-            TranscriptRow& row = transcript_state[i + 1];
-            row.base_x_inverse = inverse_trace_x[i];
-            row.base_y_inverse = inverse_trace_y[i];
-            row.transcript_msm_x_inverse = transcript_msm_x_inverse_trace[i];
-            row.transcript_add_lambda = add_lambda_numerator[i] * add_lambda_denominator[i];
-            row.msm_count_at_transition_inverse = msm_count_at_transition_inverse_trace[i];
-        }
+        parallel_for_range(num_vm_entries, [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                TranscriptRow& row = transcript_state[i + 1];
+                row.base_x_inverse = inverse_trace_x[i];
+                row.base_y_inverse = inverse_trace_y[i];
+                row.transcript_msm_x_inverse = transcript_msm_x_inverse_trace[i];
+                row.transcript_add_lambda = add_lambda_numerator[i] * add_lambda_denominator[i];
+                row.msm_count_at_transition_inverse = msm_count_at_transition_inverse_trace[i];
+            }
+        });
 
         // process the final row containing the result of the sequence of group ops in ECCOpQueue
         finalize_transcript(transcript_state, updated_state);
@@ -339,18 +358,17 @@ class ECCVMTranscriptBuilder {
      * @brief Process scalar multiplication from the ECCOpQueue.
      *
      * @details If the entry indicates a multiplication operation, the
-     * base point from the ECCOpQueue is multiplied by the corresponding full scalar. The result is added to the
+     * base point from the ECCOpQueue multiplied by the corresponding full scalar is added to the
      * 'msm_accumulator' field of the updated state.
      *
-     * @param entry Current ECCOpQueue entry
+     * @param mul_product The base point of the current ECCOpQueue entry multiplied by its full scalar
      * @param updated_state The state of the ECCVM to be updated with the result of the multiplication
      * @param state The current state of the ECCVM
      */
-    static void process_mul(const VMOperation& entry, VMState& updated_state, const VMState& state)
+    static void process_mul(const Element& mul_product, VMState& updated_state, const VMState& state)
     {
-        const auto P = typename CycleGroup::element(entry.base_point);
         const auto R = typename CycleGroup::element(state.msm_accumulator);
-        updated_state.msm_accumulator = R + P * entry.mul_scalar_full;
+        updated_state.msm_accumulator = R + mul_product;
     }
 
     /**
@@ -411,9 +429,11 @@ class ECCVMTranscriptBuilder {
                                        Accumulator& msm_accumulator_trace,
                                        std::vector<Element>& intermediate_accumulator_trace)
     {
-        Element::batch_normalize(&accumulator_trace[0], accumulator_trace.size());
-        Element::batch_normalize(&msm_accumulator_trace[0], msm_accumulator_trace.size());
-        Element::batch_normalize(&intermediate_accumulator_trace[0], intermediate_accumulator_trace.size());
+        for (Accumulator* trace : { &accumulator_trace, &msm_accumulator_trace, &intermediate_accumulator_trace }) {
+            parallel_for_range(trace->size(), [&](size_t start, size_t end) {
+                Element::batch_normalize(&(*trace)[start], end - start);
+            });
+        }
     }
     /**
      * @brief Once the point coordinates are converted from Jacobian to affine coordinates, we populate
@@ -429,21 +449,23 @@ class ECCVMTranscriptBuilder {
                                                      const Accumulator& msm_accumulator_trace,
                                                      const Accumulator& intermediate_accumulator_trace)
     {
-        for (size_t i = 0; i < accumulator_trace.size(); ++i) {
-            TranscriptRow& row = transcript_state[i + 1];
-            if (!accumulator_trace[i].is_point_at_infinity()) {
-                row.accumulator_x = accumulator_trace[i].x;
-                row.accumulator_y = accumulator_trace[i].y;
-            }
-            if (!msm_accumulator_trace[i].is_point_at_infinity()) {
-                row.msm_output_x = msm_accumulator_trace[i].x;
-                row.msm_output_y = msm_accumulator_trace[i].y;
-            }
-            if (!intermediate_accumulator_trace[i].is_point_at_infinity()) {
-                row.transcript_msm_intermediate_x = intermediate_accumulator_trace[i].x;
-                row.transcript_msm_intermediate_y = intermediate_accumulator_trace[i].y;
+        parallel_for_range(accumulator_trace.size(), [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                TranscriptRow& row = transcript_state[i + 1];
+                if (!accumulator_trace[i].is_point_at_infinity()) {
+                    row.accumulator_x = accumulator_trace[i].x;
+                    row.accumulator_y = accumulator_trace[i].y;
+                }
+                if (!msm_accumulator_trace[i].is_point_at_infinity()) {
+                    row.msm_output_x = msm_accumulator_trace[i].x;
+                    row.msm_output_y = msm_accumulator_trace[i].y;
+                }
+                if (!intermediate_accumulator_trace[i].is_point_at_infinity()) {
+                    row.transcript_msm_intermediate_x = intermediate_accumulator_trace[i].x;
+                    row.transcript_msm_intermediate_y = intermediate_accumulator_trace[i].y;
+                }
             }
-        }
+        });
     }
     /**
      * @brief Compute the difference between the x and y coordinates of two points.
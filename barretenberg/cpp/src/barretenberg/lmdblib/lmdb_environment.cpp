@@ -3,8 +3,10 @@
 #include "lmdb.h"
 #include <cstdint>
 #include <filesystem>
+#include <iterator>
 #include <stdexcept>
 #include <sys/stat.h>
+#include <thread>
 
 namespace bb::lmdblib {
 
@@ -47,6 +49,83 @@ void LMDBEnvironment::release_reader()
     _readGuard.release();
 }
 
+MDB_txn* LMDBEnvironment::acquire_read_transaction()
+{
+    MDB_txn* transaction = nullptr;
+    {
+        std::unique_lock lock(_readPool._lock);
+        ++_readPool._acquisitions;
+        auto& idle = _readPool._idle;
+        if (!idle.empty()) {
+            // Take the transaction this thread released most recently, otherwise the most recently released one
+            std::thread::id threadId = std::this_thread::get_id();
+            auto it = std::find_if(idle.rbegin(), idle.rend(), [&](const ReadTransactionPool::Entry& entry) {
+                return entry.lastOwner == threadId;
+            });
+            auto selected = it == idle.rend() ? std::prev(idle.end()) : std::prev(it.base());
+            _readPool._affinityHits += it == idle.rend() ? 0 : 1;
+            ++_readPool._reused;
+            transaction = selected->transaction;
+            *selected = idle.back();
+            idle.pop_back();
+        } else {
+            ++_readPool._numOpen;
+        }
+    }
+    try {
+        if (transaction != nullptr) {
+            call_lmdb_func("mdb_txn_renew", mdb_txn_renew, transaction);
+        } else {
+            MDB_txn* parent = nullptr;
+            call_lmdb_func(
+                "mdb_txn_begin", mdb_txn_begin, _mdbEnv, parent, static_cast<unsigned int>(MDB_RDONLY), &transaction);
+        }
+    } catch (std::runtime_error& error) {
+        if (transaction != nullptr) {
+            call_lmdb_func(mdb_txn_abort, transaction);
+        }
+        std::unique_lock lock(_readPool._lock);
+        --_readPool._numOpen;
+        throw error;
+    }
+    return transaction;
+}
+
+void LMDBEnvironment::release_read_transaction(MDB_txn* transaction)
+{
+    call_lmdb_func(mdb_txn_reset, transaction);
+    std::unique_lock lock(_readPool._lock);
+    _readPool._idle.push_back({ transaction, std::this_thread::get_id() });
+}
+
+void LMDBEnvironment::clear_read_transaction_pool()
+{
+    std::unique_lock lock(_readPool._lock);
+    for (const ReadTransactionPool::Entry& entry : _readPool._idle) {
+        call_lmdb_func(mdb_txn_abort, entry.transaction);
+    }
+    _readPool._numOpen -= _readPool._idle.size();
+    _readPool._idle.clear();
+}
+
+ReaderPoolStats LMDBEnvironment::get_reader_pool_stats() const
+{
+    ReaderPoolStats stats;
+    {
+        std::unique_lock lock(_readGuard._lock);
+        stats.exhausted = _readGuard._numExhausted;
+        stats.totalWaitNs = _readGuard._totalWaitNs;
+        stats.maxWaitNs = _readGuard._maxWaitNs;
+    }
+    std::unique_lock lock(_readPool._lock);
+    stats.acquisitions = _readPool._acquisitions;
+    stats.reused = _readPool._reused;
+    stats.affinityHits = _readPool._affinityHits;
+    stats.numIdle = _readPool._idle.size();
+    stats.numOpen = _readPool._numOpen;
+    return stats;
+}
+
 void LMDBEnvironment::wait_for_writer()
 {
     _writeGuard.wait();
@@ -59,6 +138,7 @@ void LMDBEnvironment::release_writer()
 
 LMDBEnvironment::~LMDBEnvironment()
 {
+    clear_read_transaction_pool();
     call_lmdb_func(mdb_env_close, _mdbEnv);
 }
 
@@ -1,12 +1,17 @@
 #pragma once
 
+#include "barretenberg/lmdblib/types.hpp"
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstdint>
 #include <lmdb.h>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 namespace bb::lmdblib {
 
 /*
@@ -14,6 +19,9 @@ namespace bb::lmdblib {
  * Opens/creates the environemnt and manages read access to the enviroment.
  * The environment has an upper limit on the number of concurrent read transactions
  * and this is managed through the use of mutex/condition variables
+ * Read transactions are pooled. A finished read transaction is reset and kept, the next reader renews it rather than
+ * paying for mdb_txn_begin/mdb_txn_abort. As each pooled transaction holds on to its reader slot, the pool never
+ * grows beyond the maximum number of concurrent readers.
  */
 class LMDBEnvironment {
   public:
@@ -40,6 +48,25 @@ class LMDBEnvironment {
 
     void release_reader();
 
+    /**
+     * @brief Returns a started read transaction, renewing a pooled one where possible.
+     * Preference is given to the transaction the calling thread released last.
+     * The caller must have acquired a reader via wait_for_reader
+     */
+    MDB_txn* acquire_read_transaction();
+
+    /**
+     * @brief Resets the read transaction and returns it to the pool
+     */
+    void release_read_transaction(MDB_txn* transaction);
+
+    /**
+     * @brief Aborts all idle read transactions, freeing their reader slots
+     */
+    void clear_read_transaction_pool();
+
+    ReaderPoolStats get_reader_pool_stats() const;
+
     void wait_for_writer();
 
     void release_writer();
@@ -58,19 +85,34 @@ class LMDBEnvironment {
     struct ResourceGuard {
         uint32_t _maxAllowed;
         uint32_t _current;
-        std::mutex _lock;
+        uint64_t _numExhausted;
+        uint64_t _totalWaitNs;
+        uint64_t _maxWaitNs;
+        mutable std::mutex _lock;
         std::condition_variable _condition;
 
         ResourceGuard(uint32_t maxAllowed)
             : _maxAllowed(maxAllowed)
             , _current(0)
+            , _numExhausted(0)
+            , _totalWaitNs(0)
+            , _maxWaitNs(0)
         {}
 
         void wait()
         {
             std::unique_lock lock(_lock);
             if (_current >= _maxAllowed) {
+                // Counted before waiting, so that the stats show an acquisition as soon as it is blocked
+                ++_numExhausted;
+                // Only time the slow path, an uncontended acquisition doesn't read the clock
+                auto start = std::chrono::steady_clock::now();
                 _condition.wait(lock, [&] { return _current < _maxAllowed; });
+                auto waitNs = static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start)
+                        .count());
+                _totalWaitNs += waitNs;
+                _maxWaitNs = std::max(_maxWaitNs, waitNs);
             }
             ++_current;
         }
@@ -84,5 +126,19 @@ class LMDBEnvironment {
     };
     ResourceGuard _readGuard;
     ResourceGuard _writeGuard;
+
+    struct ReadTransactionPool {
+        struct Entry {
+            MDB_txn* transaction;
+            std::thread::id lastOwner;
+        };
+        mutable std::mutex _lock;
+        std::vector<Entry> _idle;
+        uint64_t _numOpen = 0;
+        uint64_t _acquisitions = 0;
+        uint64_t _reused = 0;
+        uint64_t _affinityHits = 0;
+    };
+    ReadTransactionPool _readPool;
 };
 } // namespace bb::lmdblib
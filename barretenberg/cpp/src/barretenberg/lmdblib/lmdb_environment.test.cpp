@@ -8,6 +8,7 @@
 #include <memory>
 #include <sstream>
 #include <stdexcept>
+#include <thread>
 #include <vector>
 
 #include "barretenberg/common/serialize.hpp"
@@ -210,3 +211,143 @@ TEST_F(LMDBEnvironmentTest, can_read_multiple_threads)
         }
     }
 }
+
+TEST_F(LMDBEnvironmentTest, read_transactions_are_pooled)
+{
+    LMDBEnvironment::SharedPtr environment = std::make_shared<LMDBEnvironment>(
+        LMDBEnvironmentTest::_directory, LMDBEnvironmentTest::_mapSize, 1, LMDBEnvironmentTest::_maxReaders);
+
+    LMDBDatabase::SharedPtr db;
+    {
+        environment->wait_for_writer();
+        LMDBDatabaseCreationTransaction tx(environment);
+        db = std::make_unique<LMDBDatabase>(environment, tx, "DB", false, false);
+        EXPECT_NO_THROW(tx.commit());
+    }
+
+    int64_t numValues = 10;
+    for (int64_t count = 0; count < numValues; count++) {
+        {
+            environment->wait_for_writer();
+            LMDBWriteTransaction::Ptr tx = std::make_unique<LMDBWriteTransaction>(environment);
+            auto key = get_key(count);
+            auto data = get_value(count, 0);
+            EXPECT_NO_THROW(tx->put_value(key, data, *db));
+            EXPECT_NO_THROW(tx->commit());
+        }
+        {
+            // a renewed transaction must see the latest commit
+            environment->wait_for_reader();
+            LMDBReadTransaction::Ptr tx = std::make_unique<LMDBReadTransaction>(environment);
+            auto key = get_key(count);
+            auto expected = get_value(count, 0);
+            std::vector<uint8_t> data;
+            EXPECT_TRUE(tx->get_value(key, data, *db));
+            EXPECT_EQ(data, expected);
+        }
+    }
+
+    ReaderPoolStats stats = environment->get_reader_pool_stats();
+    EXPECT_EQ(stats.acquisitions, numValues);
+    EXPECT_EQ(stats.reused, numValues - 1);
+    EXPECT_EQ(stats.affinityHits, numValues - 1);
+    EXPECT_EQ(stats.exhausted, 0);
+    EXPECT_EQ(stats.numIdle, 1);
+    EXPECT_EQ(stats.numOpen, 1);
+
+    {
+        // explicitly aborted transactions are returned to the pool too
+        environment->wait_for_reader();
+        LMDBReadTransaction::Ptr first = std::make_unique<LMDBReadTransaction>(environment);
+        environment->wait_for_reader();
+        LMDBReadTransaction::Ptr second = std::make_unique<LMDBReadTransaction>(environment);
+        first->abort();
+        stats = environment->get_reader_pool_stats();
+        EXPECT_EQ(stats.numIdle, 1);
+        EXPECT_EQ(stats.numOpen, 2);
+    }
+
+    environment->clear_read_transaction_pool();
+    stats = environment->get_reader_pool_stats();
+    EXPECT_EQ(stats.numIdle, 0);
+    EXPECT_EQ(stats.numOpen, 0);
+}
+
+TEST_F(LMDBEnvironmentTest, reader_pool_reports_exhaustion)
+{
+    LMDBEnvironment::SharedPtr environment =
+        std::make_shared<LMDBEnvironment>(LMDBEnvironmentTest::_directory, LMDBEnvironmentTest::_mapSize, 1, 2);
+
+    environment->wait_for_reader();
+    LMDBReadTransaction::Ptr first = std::make_unique<LMDBReadTransaction>(environment);
+    environment->wait_for_reader();
+    LMDBReadTransaction::Ptr second = std::make_unique<LMDBReadTransaction>(environment);
+
+    std::thread reader([&]() {
+        environment->wait_for_reader();
+        LMDBReadTransaction::Ptr tx = std::make_unique<LMDBReadTransaction>(environment);
+    });
+    // wait until the reader is blocked on the exhausted pool before releasing a transaction
+    while (environment->get_reader_pool_stats().exhausted == 0) {
+        std::this_thread::yield();
+    }
+    first.reset();
+    reader.join();
+
+    ReaderPoolStats stats = environment->get_reader_pool_stats();
+    EXPECT_EQ(stats.acquisitions, 3);
+    EXPECT_EQ(stats.exhausted, 1);
+    EXPECT_GT(stats.totalWaitNs, 0);
+    EXPECT_EQ(stats.maxWaitNs, stats.totalWaitNs);
+    // the waiting reader took over the released transaction, the pool never exceeds the reader limit
+    EXPECT_EQ(stats.reused, 1);
+    EXPECT_EQ(stats.numOpen, 2);
+}
+
+TEST_F(LMDBEnvironmentTest, reader_pool_is_bounded_under_concurrent_reads)
+{
+    uint32_t maxReaders = 4;
+    LMDBEnvironment::SharedPtr environment = std::make_shared<LMDBEnvironment>(
+        LMDBEnvironmentTest::_directory, LMDBEnvironmentTest::_mapSize, 1, maxReaders);
+
+    LMDBDatabase::SharedPtr db;
+    {
+        environment->wait_for_writer();
+        LMDBDatabaseCreationTransaction tx(environment);
+        db = std::make_unique<LMDBDatabase>(environment, tx, "DB", false, false);
+        EXPECT_NO_THROW(tx.commit());
+    }
+    {
+        environment->wait_for_writer();
+        LMDBWriteTransaction::Ptr tx = std::make_unique<LMDBWriteTransaction>(environment);
+        auto key = get_key(0);
+        auto data = get_value(0, 0);
+        EXPECT_NO_THROW(tx->put_value(key, data, *db));
+        EXPECT_NO_THROW(tx->commit());
+    }
+
+    uint32_t numThreads = 16;
+    uint64_t numIterationsPerThread = 1000;
+    auto func = [&]() -> void {
+        for (uint64_t iteration = 0; iteration < numIterationsPerThread; iteration++) {
+            environment->wait_for_reader();
+            LMDBReadTransaction::Ptr tx = std::make_unique<LMDBReadTransaction>(environment);
+            auto key = get_key(0);
+            std::vector<uint8_t> data;
+            EXPECT_TRUE(tx->get_value(key, data, *db));
+        }
+    };
+    std::vector<std::unique_ptr<std::thread>> threads;
+    for (uint64_t count = 0; count < numThreads; count++) {
+        threads.emplace_back(std::make_unique<std::thread>(func));
+    }
+    for (uint64_t count = 0; count < numThreads; count++) {
+        threads[count]->join();
+    }
+
+    ReaderPoolStats stats = environment->get_reader_pool_stats();
+    EXPECT_EQ(stats.acquisitions, numThreads * numIterationsPerThread);
+    EXPECT_LE(stats.numOpen, maxReaders);
+    EXPECT_EQ(stats.numIdle, stats.numOpen);
+    EXPECT_EQ(stats.reused, stats.acquisitions - stats.numOpen);
+}
@@ -5,12 +5,21 @@
 
 namespace bb::lmdblib {
 LMDBReadTransaction::LMDBReadTransaction(LMDBEnvironment::SharedPtr env)
-    : LMDBTransaction(env, true)
+    : LMDBTransaction(env, env->acquire_read_transaction())
 {}
 
 LMDBReadTransaction::~LMDBReadTransaction()
 {
-    LMDBTransaction::abort();
+    LMDBReadTransaction::abort();
     _environment->release_reader();
 }
+
+void LMDBReadTransaction::abort()
+{
+    if (state != TransactionState::OPEN) {
+        return;
+    }
+    _environment->release_read_transaction(_transaction);
+    state = TransactionState::ABORTED;
+}
 } // namespace bb::lmdblib
@@ -17,7 +17,7 @@ namespace bb::lmdblib {
 /**
  * RAII wrapper around a read transaction.
  * Contains various methods for retrieving values by their keys.
- * Aborts the transaction upon object destruction.
+ * The underlying transaction is taken from the environment's pool and returned to it upon abort or destruction.
  */
 class LMDBReadTransaction : public LMDBTransaction {
   public:
@@ -31,5 +31,7 @@ class LMDBReadTransaction : public LMDBTransaction {
     LMDBReadTransaction& operator=(LMDBReadTransaction&& other) = delete;
 
     ~LMDBReadTransaction() override;
+
+    void abort() override;
 };
 } // namespace bb::lmdblib
\ No newline at end of file
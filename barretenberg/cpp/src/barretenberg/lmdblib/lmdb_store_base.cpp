@@ -1,4 +1,5 @@
 #include "barretenberg/lmdblib/lmdb_store_base.hpp"
+#include <stdexcept>
 
 namespace bb::lmdblib {
 LMDBStoreBase::LMDBStoreBase(std::string directory, uint64_t mapSizeKb, uint64_t maxNumReaders, uint64_t maxDbs)
@@ -36,11 +37,26 @@ void LMDBStoreBase::copy_store(const std::string& dstPath, bool compact)
     // "[mdb_copy] can trigger significant file size growth if run in parallel with write transactions,
     //  because pages which they free during copying cannot be reused until the copy is done."
     WriteTransaction::Ptr tx = create_write_transaction();
-    call_lmdb_func("mdb_env_copy2",
-                   mdb_env_copy2,
-                   _environment->underlying(),
-                   dstPath.c_str(),
-                   static_cast<unsigned int>(compact ? MDB_CP_COMPACT : 0));
+    // The copy opens its own read transaction. Hold one reader and drop the idle pooled transactions so it is
+    // guaranteed a free reader slot
+    _environment->wait_for_reader();
+    _environment->clear_read_transaction_pool();
+    try {
+        call_lmdb_func("mdb_env_copy2",
+                       mdb_env_copy2,
+                       _environment->underlying(),
+                       dstPath.c_str(),
+                       static_cast<unsigned int>(compact ? MDB_CP_COMPACT : 0));
+    } catch (std::runtime_error& error) {
+        _environment->release_reader();
+        throw error;
+    }
+    _environment->release_reader();
+}
+
+ReaderPoolStats LMDBStoreBase::get_reader_pool_stats() const
+{
+    return _environment->get_reader_pool_stats();
 }
 
 } // namespace bb::lmdblib
\ No newline at end of file
@@ -22,6 +22,7 @@ class LMDBStoreBase {
     WriteTransaction::Ptr create_write_transaction() const;
     LMDBDatabaseCreationTransaction::Ptr create_db_transaction() const;
     void copy_store(const std::string& dstPath, bool compact);
+    ReaderPoolStats get_reader_pool_stats() const;
 
   protected:
     std::string _dbDirectory;
@@ -15,6 +15,13 @@ LMDBTransaction::LMDBTransaction(std::shared_ptr<LMDBEnvironment> env, bool read
     call_lmdb_func(name, mdb_txn_begin, _environment->underlying(), p, readOnly ? MDB_RDONLY : 0U, &_transaction);
 }
 
+LMDBTransaction::LMDBTransaction(std::shared_ptr<LMDBEnvironment> env, MDB_txn* transaction)
+    : _environment(std::move(env))
+    , _id(_environment->getNextId())
+    , _transaction(transaction)
+    , state(TransactionState::OPEN)
+{}
+
 LMDBTransaction::~LMDBTransaction() = default;
 
 MDB_txn* LMDBTransaction::underlying() const
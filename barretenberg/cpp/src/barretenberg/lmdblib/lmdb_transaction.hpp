@@ -71,6 +71,9 @@ class LMDBTransaction {
     bool get_value(std::vector<uint8_t>& key, uint64_t& data, const LMDBDatabase& db) const;
 
   protected:
+    // Wraps a transaction that has already been started
+    LMDBTransaction(LMDBEnvironment::SharedPtr env, MDB_txn* transaction);
+
     std::shared_ptr<LMDBEnvironment> _environment;
     uint64_t _id;
     MDB_txn* _transaction;
@@ -66,4 +66,34 @@ struct DBStats {
     }
 };
 
+struct ReaderPoolStats {
+    // Read transactions handed out by the pool
+    uint64_t acquisitions = 0;
+    // Acquisitions served by renewing a pooled transaction rather than beginning a new one
+    uint64_t reused = 0;
+    // Reused transactions that were last released by the acquiring thread
+    uint64_t affinityHits = 0;
+    // Acquisitions that found every reader in use and had to wait
+    uint64_t exhausted = 0;
+    uint64_t totalWaitNs = 0;
+    uint64_t maxWaitNs = 0;
+    // Idle, reset transactions currently held by the pool
+    uint64_t numIdle = 0;
+    // Transactions owned by the pool, in use or idle. Never exceeds the environment's maximum number of readers
+    uint64_t numOpen = 0;
+
+    MSGPACK_FIELDS(acquisitions, reused, affinityHits, exhausted, totalWaitNs, maxWaitNs, numIdle, numOpen)
+
+    bool operator==(const ReaderPoolStats& other) const = default;
+
+    friend std::ostream& operator<<(std::ostream& os, const ReaderPoolStats& stats)
+    {
+        os << "Acquisitions: " << stats.acquisitions << ", reused: " << stats.reused
+           << ", affinity hits: " << stats.affinityHits << ", exhausted: " << stats.exhausted
+           << ", total wait ns: " << stats.totalWaitNs << ", max wait ns: " << stats.maxWaitNs
+           << ", idle: " << stats.numIdle << ", open: " << stats.numOpen;
+        return os;
+    }
+};
+
 } // namespace bb::lmdblib
\ No newline at end of file
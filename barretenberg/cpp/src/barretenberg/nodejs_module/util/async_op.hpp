@@ -1,6 +1,7 @@
 #pragma once
 
 #include "barretenberg/serialize/msgpack_impl.hpp"
+#include <cstdlib>
 #include <memory>
 #include <napi.h>
 #include <utility>
@@ -15,7 +16,7 @@ using async_fn = std::function<void(msgpack::sbuffer&)>;
  * This class takes a Deferred instance (i.e. a Promise to JS), execute some work in a separate thread, and then report
  * back on the result. The async execution _must not_ touch the JS environment. Everything that's needed to complete the
  * work must be copied into memory owned by the C++ code. The same has to be done when reporting back the result: keep
- * the result in memory owned by the C++ code and copy it back to the JS environment in the OnOK/OnError methods.
+ * the result in memory owned by the C++ code and hand it back to the JS environment in the OnOK/OnError methods.
  *
  * OnOK/OnError will be called on the main JS thread, so it's safe to interact with the JS environment there.
  *
@@ -50,7 +51,11 @@ class AsyncOperation : public Napi::AsyncWorker {
 
     void OnOK() override
     {
-        auto buf = Napi::Buffer<char>::Copy(Env(), _result.data(), _result.size());
+        // Hand the result's memory over to JS rather than copying it, it is freed once the Buffer is garbage collected.
+        // NewOrCopy falls back to a copy (and frees the original straight away) where external buffers are disallowed
+        size_t size = _result.size();
+        char* data = _result.release();
+        auto buf = Napi::Buffer<char>::NewOrCopy(Env(), data, size, [](Napi::Env, char* ptr) { std::free(ptr); });
         _deferred->Resolve(buf);
     }
     void OnError(const Napi::Error& e) override { _deferred->Reject(e.Value()); }
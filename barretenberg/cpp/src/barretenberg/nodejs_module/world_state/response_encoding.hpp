@@ -0,0 +1,133 @@
+#pragma once
+#include "barretenberg/common/net.hpp"
+#include "barretenberg/crypto/merkle_tree/types.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/messaging/header.hpp"
+#include "barretenberg/nodejs_module/world_state/world_state_message.hpp"
+#include "barretenberg/serialize/msgpack.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <vector>
+
+namespace bb::nodejs {
+
+/**
+ * Encoders for the responses that carry the most data back to JS (sibling paths and batches of leaf lookups).
+ * Rather than copying the result into a TypedMessage and letting the buffer grow as it is packed, the exact (or an
+ * upper bound of the) encoded size is computed up front and the message is written straight into the buffer.
+ * The bytes produced are identical to packing the equivalent TypedMessage.
+ */
+
+// bin 8 marker, length byte and the 32 big endian bytes of the field
+constexpr size_t PACKED_FR_SIZE = 2 + 32;
+// An upper bound on the encoded optional<uint64_t>: a uint 64 marker and 8 bytes, or a nil
+constexpr size_t MAX_PACKED_OPTIONAL_UINT64_SIZE = 1 + 8;
+// An upper bound on an encoded array or map header
+constexpr size_t MAX_PACKED_CONTAINER_HEADER_SIZE = 1 + 4;
+// An upper bound on the encoded { msgType, header, value } map surrounding every response value
+constexpr size_t MAX_PACKED_ENVELOPE_SIZE = 64;
+// An upper bound on a batch entry's { success, error, durationUs, response } map, excluding the error and response
+constexpr size_t MAX_PACKED_BATCH_ENTRY_SIZE = 64;
+
+/**
+ * @brief Replaces an empty buffer with one that can hold size bytes without reallocating
+ */
+inline void reserve_response(msgpack::sbuffer& buffer, size_t size)
+{
+    if (buffer.size() == 0) {
+        buffer = msgpack::sbuffer(size);
+    }
+}
+
+/**
+ * @brief Packs the msgType and header of a response and opens its value, which the caller must pack next
+ */
+inline void pack_response_envelope(msgpack::sbuffer& buffer, uint32_t msgType, const MsgHeader& header)
+{
+    msgpack::packer<msgpack::sbuffer> packer(buffer);
+    packer.pack_map(3);
+    packer.pack("msgType");
+    packer.pack(msgType);
+    packer.pack("header");
+    packer.pack(header);
+    packer.pack("value");
+}
+
+/**
+ * @brief Writes a field element in the same form as fr::msgpack_pack with a single write to the buffer
+ */
+inline void pack_fr(msgpack::sbuffer& buffer, const bb::fr& value)
+{
+    auto adjusted = value.from_montgomery_form();
+    std::array<char, PACKED_FR_SIZE> bytes;
+    bytes[0] = static_cast<char>(0xc4);
+    bytes[1] = static_cast<char>(32);
+    for (size_t i = 0; i < 4; i++) {
+        uint64_t limb = htonll(adjusted.data[3 - i]);
+        std::memcpy(&bytes[2 + (i * sizeof(uint64_t))], &limb, sizeof(uint64_t));
+    }
+    buffer.write(bytes.data(), bytes.size());
+}
+
+inline void pack_sibling_path_response(msgpack::sbuffer& buffer,
+                                       uint32_t msgType,
+                                       const MsgHeader& header,
+                                       const crypto::merkle_tree::fr_sibling_path& path)
+{
+    reserve_response(buffer,
+                     MAX_PACKED_ENVELOPE_SIZE + MAX_PACKED_CONTAINER_HEADER_SIZE + (path.size() * PACKED_FR_SIZE));
+    pack_response_envelope(buffer, msgType, header);
+    msgpack::packer<msgpack::sbuffer> packer(buffer);
+    packer.pack_array(static_cast<uint32_t>(path.size()));
+    for (const bb::fr& node : path) {
+        pack_fr(buffer, node);
+    }
+}
+
+/**
+ * @brief Packs a single field map of { key: [optional<uint64_t>] }, the layout of both leaf index batch responses
+ */
+template <typename T>
+void pack_optional_uint64_batch_response(msgpack::sbuffer& buffer,
+                                         uint32_t msgType,
+                                         const MsgHeader& header,
+                                         const char* key,
+                                         const std::vector<std::optional<T>>& values)
+{
+    reserve_response(buffer,
+                     MAX_PACKED_ENVELOPE_SIZE + (2 * MAX_PACKED_CONTAINER_HEADER_SIZE) + std::strlen(key) + 1 +
+                         (values.size() * MAX_PACKED_OPTIONAL_UINT64_SIZE));
+    pack_response_envelope(buffer, msgType, header);
+    msgpack::packer<msgpack::sbuffer> packer(buffer);
+    packer.pack_map(1);
+    packer.pack(key);
+    packer.pack_array(static_cast<uint32_t>(values.size()));
+    for (const std::optional<T>& value : values) {
+        if (value.has_value()) {
+            packer.pack(static_cast<uint64_t>(value.value()));
+        } else {
+            packer.pack_nil();
+        }
+    }
+}
+
+inline void pack_find_leaf_indices_response(msgpack::sbuffer& buffer,
+                                            uint32_t msgType,
+                                            const MsgHeader& header,
+                                            const FindLeafIndicesResponse& response)
+{
+    pack_optional_uint64_batch_response(buffer, msgType, header, "indices", response.indices);
+}
+
+inline void pack_block_numbers_for_leaf_indices_response(msgpack::sbuffer& buffer,
+                                                         uint32_t msgType,
+                                                         const MsgHeader& header,
+                                                         const GetBlockNumbersForLeafIndicesResponse& response)
+{
+    pack_optional_uint64_batch_response(buffer, msgType, header, "blockNumbers", response.blockNumbers);
+}
+
+} // namespace bb::nodejs
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <any>
 #include <array>
+#include <chrono>
 #include <cstdint>
 #include <iostream>
 #include <memory>
@@ -15,10 +16,12 @@
 #include "barretenberg/crypto/merkle_tree/hash_path.hpp"
 #include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
 #include "barretenberg/crypto/merkle_tree/response.hpp"
+#include "barretenberg/crypto/merkle_tree/signal.hpp"
 #include "barretenberg/crypto/merkle_tree/types.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/messaging/header.hpp"
 #include "barretenberg/nodejs_module/util/async_op.hpp"
+#include "barretenberg/nodejs_module/world_state/response_encoding.hpp"
 #include "barretenberg/nodejs_module/world_state/world_state.hpp"
 #include "barretenberg/nodejs_module/world_state/world_state_message.hpp"
 #include "barretenberg/serialize/msgpack.hpp"
@@ -33,6 +36,28 @@ using namespace bb::messaging;
 
 const uint64_t DEFAULT_MAP_SIZE = 1024UL * 1024;
 
+namespace {
+// Requests that don't modify the world state, consecutive ones within a batch are executed concurrently
+bool is_read_only_message(uint32_t msgType)
+{
+    switch (msgType) {
+    case WorldStateMessageType::GET_TREE_INFO:
+    case WorldStateMessageType::GET_STATE_REFERENCE:
+    case WorldStateMessageType::GET_INITIAL_STATE_REFERENCE:
+    case WorldStateMessageType::GET_LEAF_VALUE:
+    case WorldStateMessageType::GET_LEAF_PREIMAGE:
+    case WorldStateMessageType::GET_SIBLING_PATH:
+    case WorldStateMessageType::GET_BLOCK_NUMBERS_FOR_LEAF_INDICES:
+    case WorldStateMessageType::FIND_LEAF_INDICES:
+    case WorldStateMessageType::FIND_LOW_LEAF:
+    case WorldStateMessageType::GET_STATUS:
+        return true;
+    default:
+        return false;
+    }
+}
+} // namespace
+
 WorldStateWrapper::WorldStateWrapper(const Napi::CallbackInfo& info)
     : ObjectWrap(info)
 {
@@ -156,6 +181,7 @@ WorldStateWrapper::WorldStateWrapper(const Napi::CallbackInfo& info)
                                        tree_prefill,
                                        prefilled_public_data,
                                        initial_header_generator_point);
+    _batchWorkers = std::make_unique<bb::ThreadPool>(thread_pool_size);
 
     _dispatcher.register_target(
         WorldStateMessageType::GET_TREE_INFO,
@@ -262,6 +288,17 @@ WorldStateWrapper::WorldStateWrapper(const Napi::CallbackInfo& info)
     _dispatcher.register_target(
         WorldStateMessageType::COPY_STORES,
         [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return copy_stores(obj, buffer); });
+
+    _dispatcher.register_target(
+        WorldStateMessageType::EXPORT_SNAPSHOT,
+        [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return export_snapshot(obj, buffer); });
+
+    _dispatcher.register_target(
+        WorldStateMessageType::IMPORT_SNAPSHOT,
+        [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return import_snapshot(obj, buffer); });
+
+    _dispatcher.register_target(WorldStateMessageType::BATCH,
+                                [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return batch(obj, buffer); });
 }
 
 Napi::Value WorldStateWrapper::call(const Napi::CallbackInfo& info)
@@ -432,9 +469,7 @@ bool WorldStateWrapper::get_sibling_path(msgpack::object& obj, msgpack::sbuffer&
     fr_sibling_path path = _ws->get_sibling_path(request.value.revision, request.value.treeId, request.value.leafIndex);
 
     MsgHeader header(request.header.messageId);
-    messaging::TypedMessage<fr_sibling_path> resp_msg(WorldStateMessageType::GET_SIBLING_PATH, header, path);
-
-    msgpack::pack(buffer, resp_msg);
+    pack_sibling_path_response(buffer, WorldStateMessageType::GET_SIBLING_PATH, header, path);
 
     return true;
 }
@@ -449,10 +484,8 @@ bool WorldStateWrapper::get_block_numbers_for_leaf_indices(msgpack::object& obj,
         request.value.revision, request.value.treeId, request.value.leafIndices, response.blockNumbers);
 
     MsgHeader header(request.header.messageId);
-    messaging::TypedMessage<GetBlockNumbersForLeafIndicesResponse> resp_msg(
-        WorldStateMessageType::GET_BLOCK_NUMBERS_FOR_LEAF_INDICES, header, response);
-
-    msgpack::pack(buffer, resp_msg);
+    pack_block_numbers_for_leaf_indices_response(
+        buffer, WorldStateMessageType::GET_BLOCK_NUMBERS_FOR_LEAF_INDICES, header, response);
 
     return true;
 }
@@ -492,9 +525,7 @@ bool WorldStateWrapper::find_leaf_indices(msgpack::object& obj, msgpack::sbuffer
     }
 
     MsgHeader header(request.header.messageId);
-    messaging::TypedMessage<FindLeafIndicesResponse> resp_msg(
-        WorldStateMessageType::FIND_LEAF_INDICES, header, response);
-    msgpack::pack(buffer, resp_msg);
+    pack_find_leaf_indices_response(buffer, WorldStateMessageType::FIND_LEAF_INDICES, header, response);
 
     return true;
 }
@@ -843,6 +874,124 @@ bool WorldStateWrapper::copy_stores(msgpack::object& obj, msgpack::sbuffer& buff
     return true;
 }
 
+bool WorldStateWrapper::export_snapshot(msgpack::object& obj, msgpack::sbuffer& buffer)
+{
+    TypedMessage<ExportSnapshotRequest> request;
+    obj.convert(request);
+
+    _ws->export_snapshot(request.value.dstPath);
+
+    MsgHeader header(request.header.messageId);
+    messaging::TypedMessage<EmptyResponse> resp_msg(WorldStateMessageType::EXPORT_SNAPSHOT, header, {});
+    msgpack::pack(buffer, resp_msg);
+
+    return true;
+}
+
+bool WorldStateWrapper::import_snapshot(msgpack::object& obj, msgpack::sbuffer& buffer)
+{
+    TypedMessage<ImportSnapshotRequest> request;
+    obj.convert(request);
+
+    WorldStateStatusSummary status = _ws->import_snapshot(request.value.srcPath);
+
+    MsgHeader header(request.header.messageId);
+    messaging::TypedMessage<WorldStateStatusSummary> resp_msg(
+        WorldStateMessageType::IMPORT_SNAPSHOT, header, { status });
+    msgpack::pack(buffer, resp_msg);
+
+    return true;
+}
+
+void WorldStateWrapper::execute_batch_request(msgpack::object& obj, BatchResponseEntry& entry)
+{
+    auto start = std::chrono::steady_clock::now();
+    try {
+        _dispatcher.on_new_data(obj, entry.response);
+        entry.success = true;
+    } catch (const std::exception& e) {
+        entry.error = e.what();
+    }
+    entry.durationUs = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+}
+
+bool WorldStateWrapper::batch(msgpack::object& obj, msgpack::sbuffer& buffer)
+{
+    TypedMessage<BatchRequest> request;
+    obj.convert(request);
+
+    std::vector<msgpack::object>& requests = request.value.requests;
+    std::vector<BatchResponseEntry> entries(requests.size());
+    std::vector<bool> readOnly(requests.size(), false);
+    for (size_t i = 0; i < requests.size(); i++) {
+        HeaderOnlyMessage subHeader;
+        requests[i].convert(subHeader);
+        if (subHeader.msgType == WorldStateMessageType::BATCH || subHeader.msgType == WorldStateMessageType::CLOSE) {
+            throw std::runtime_error("Message type " + std::to_string(subHeader.msgType) + " can not be batched");
+        }
+        readOnly[i] = is_read_only_message(subHeader.msgType);
+    }
+
+    // Runs of read only requests execute concurrently, every other request executes on its own and in order
+    size_t next = 0;
+    while (next < requests.size()) {
+        size_t end = next + 1;
+        while (readOnly[next] && end < requests.size() && readOnly[end]) {
+            end++;
+        }
+        if (end - next == 1) {
+            execute_batch_request(requests[next], entries[next]);
+        } else {
+            Signal signal(static_cast<uint32_t>(end - next));
+            for (size_t i = next; i < end; i++) {
+                _batchWorkers->enqueue([&, i]() {
+                    execute_batch_request(requests[i], entries[i]);
+                    signal.signal_decrement();
+                });
+            }
+            signal.wait_for_level(0);
+        }
+        next = end;
+    }
+
+    // Pack the response message by hand so that the already packed responses can be copied in as they are
+    size_t responseSize = MAX_PACKED_ENVELOPE_SIZE + (2 * MAX_PACKED_CONTAINER_HEADER_SIZE) + sizeof("responses");
+    for (const BatchResponseEntry& entry : entries) {
+        responseSize += MAX_PACKED_BATCH_ENTRY_SIZE + entry.error.size() + entry.response.size();
+    }
+    reserve_response(buffer, responseSize);
+
+    MsgHeader header(request.header.messageId);
+    msgpack::packer<msgpack::sbuffer> packer(buffer);
+    packer.pack_map(3);
+    packer.pack("msgType");
+    packer.pack(static_cast<uint32_t>(WorldStateMessageType::BATCH));
+    packer.pack("header");
+    packer.pack(header);
+    packer.pack("value");
+    packer.pack_map(1);
+    packer.pack("responses");
+    packer.pack_array(static_cast<uint32_t>(entries.size()));
+    for (const BatchResponseEntry& entry : entries) {
+        packer.pack_map(4);
+        packer.pack("success");
+        packer.pack(entry.success);
+        packer.pack("error");
+        packer.pack(entry.error);
+        packer.pack("durationUs");
+        packer.pack(entry.durationUs);
+        packer.pack("response");
+        if (entry.success) {
+            buffer.write(entry.response.data(), entry.response.size());
+        } else {
+            packer.pack_nil();
+        }
+    }
+
+    return true;
+}
+
 Napi::Function WorldStateWrapper::get_class(Napi::Env env)
 {
     return DefineClass(env,
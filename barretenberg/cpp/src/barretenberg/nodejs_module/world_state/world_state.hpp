@@ -1,5 +1,6 @@
 #pragma once
 
+#include "barretenberg/common/thread_pool.hpp"
 #include "barretenberg/messaging/dispatcher.hpp"
 #include "barretenberg/nodejs_module/world_state/world_state_message.hpp"
 #include "barretenberg/world_state/types.hpp"
@@ -30,6 +31,8 @@ class WorldStateWrapper : public Napi::ObjectWrap<WorldStateWrapper> {
   private:
     std::unique_ptr<bb::world_state::WorldState> _ws;
     bb::messaging::MessageDispatcher _dispatcher;
+    // Executes the read only requests of a batch concurrently
+    std::unique_ptr<bb::ThreadPool> _batchWorkers;
 
     bool get_tree_info(msgpack::object& obj, msgpack::sbuffer& buffer) const;
     bool get_state_reference(msgpack::object& obj, msgpack::sbuffer& buffer) const;
@@ -70,6 +73,11 @@ class WorldStateWrapper : public Napi::ObjectWrap<WorldStateWrapper> {
     bool revert_checkpoint(msgpack::object& obj, msgpack::sbuffer& buffer);
 
     bool copy_stores(msgpack::object& obj, msgpack::sbuffer& buffer);
+    bool export_snapshot(msgpack::object& obj, msgpack::sbuffer& buffer);
+    bool import_snapshot(msgpack::object& obj, msgpack::sbuffer& buffer);
+
+    bool batch(msgpack::object& obj, msgpack::sbuffer& buffer);
+    void execute_batch_request(msgpack::object& obj, BatchResponseEntry& entry);
 };
 
 } // namespace bb::nodejs
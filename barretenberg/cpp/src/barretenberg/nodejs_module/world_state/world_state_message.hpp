@@ -9,6 +9,7 @@
 #include <cstdint>
 #include <optional>
 #include <string>
+#include <vector>
 
 namespace bb::nodejs {
 
@@ -53,6 +54,10 @@ enum WorldStateMessageType {
     REVERT_CHECKPOINT,
 
     COPY_STORES,
+    EXPORT_SNAPSHOT,
+    IMPORT_SNAPSHOT,
+
+    BATCH,
 
     CLOSE = 999,
 };
@@ -239,6 +244,34 @@ struct CopyStoresRequest {
     MSGPACK_FIELDS(dstPath, compact);
 };
 
+struct ExportSnapshotRequest {
+    std::string dstPath;
+    MSGPACK_FIELDS(dstPath);
+};
+
+struct ImportSnapshotRequest {
+    std::string srcPath;
+    MSGPACK_FIELDS(srcPath);
+};
+
+/**
+ * @brief A set of complete request messages executed by a single call. Each request is answered individually
+ */
+struct BatchRequest {
+    std::vector<msgpack::object> requests;
+    MSGPACK_FIELDS(requests);
+};
+
+/**
+ * @brief The outcome of one request of a batch. On success the response holds the packed response message
+ */
+struct BatchResponseEntry {
+    bool success = false;
+    std::string error;
+    uint64_t durationUs = 0;
+    msgpack::sbuffer response;
+};
+
 } // namespace bb::nodejs
 
 MSGPACK_ADD_ENUM(bb::nodejs::WorldStateMessageType)
@@ -36,14 +36,6 @@ class ECCOpQueue {
     EccvmOpsTable eccvm_ops_table;    // table of ops in the ECCVM format
     UltraEccOpsTable ultra_ops_table; // table of ops in the Ultra-arithmetization format
 
-    // Storage for the reconstructed eccvm ops table in contiguous memory. (Intended to be constructed once and for all
-    // prior to ECCVM construction to avoid repeated prepending of subtables in physical memory).
-    std::vector<ECCVMOperation> eccvm_ops_reconstructed;
-
-    // Storage for the reconstructed ultra ops table in contiguous memory. (Intended to be constructed once and for all
-    // prior to Translator circuit construction to avoid repeated prepending of subtables in physical memory).
-    std::vector<UltraOp> ultra_ops_reconstructed;
-
     // Tracks number of muls and size of eccvm in real time as the op queue is updated
     EccvmRowTracker eccvm_row_tracker;
 
@@ -76,34 +68,16 @@ class ECCOpQueue {
         return ultra_ops_table.construct_current_ultra_ops_subtable_columns();
     }
 
-    // Reconstruct the full table of eccvm ops in contiguous memory from the independent subtables
-    void construct_full_eccvm_ops_table() { eccvm_ops_reconstructed = eccvm_ops_table.get_reconstructed(); }
-
-    // Reconstruct the full table of ultra ops in contiguous memory from the independent subtables
-    void construct_full_ultra_ops_table() { ultra_ops_reconstructed = ultra_ops_table.get_reconstructed(); }
-
     size_t get_ultra_ops_table_num_rows() const { return ultra_ops_table.ultra_table_size(); }
     size_t get_current_ultra_ops_subtable_num_rows() const { return ultra_ops_table.current_ultra_subtable_size(); }
 
-    // TODO(https://github.com/AztecProtocol/barretenberg/issues/1339): Consider making the ultra and eccvm ops getters
-    // more memory efficient
-
-    // Get the full table of ECCVM ops in contiguous memory; construct it if it has not been constructed already
-    std::vector<ECCVMOperation>& get_eccvm_ops()
-    {
-        if (eccvm_ops_reconstructed.empty()) {
-            construct_full_eccvm_ops_table();
-        }
-        return eccvm_ops_reconstructed;
-    }
+    // Get a view of the full table of ECCVM ops that reads the subtables in place. The view is invalidated by adding
+    // further ops to the queue
+    EccvmOpsView get_eccvm_ops() const { return eccvm_ops_table.get_view(); }
 
-    std::vector<UltraOp>& get_ultra_ops()
-    {
-        if (ultra_ops_reconstructed.empty()) {
-            construct_full_ultra_ops_table();
-        }
-        return ultra_ops_reconstructed;
-    }
+    // Get a view of the full table of ultra ops that reads the subtables in place. The view is invalidated by adding
+    // further ops to the queue
+    UltraOpsView get_ultra_ops() const { return ultra_ops_table.get_view(); }
 
     /**
      * @brief Get the number of rows in the 'msm' column section, for all msms in the circuit
@@ -139,7 +113,11 @@ class ECCOpQueue {
      */
     void set_eccvm_ops_for_fuzzing(std::vector<ECCVMOperation>& eccvm_ops_in)
     {
-        eccvm_ops_reconstructed = eccvm_ops_in;
+        eccvm_ops_table = EccvmOpsTable{};
+        eccvm_ops_table.create_new_subtable(eccvm_ops_in.size());
+        for (const auto& op : eccvm_ops_in) {
+            eccvm_ops_table.push(op);
+        }
     }
 
     /**
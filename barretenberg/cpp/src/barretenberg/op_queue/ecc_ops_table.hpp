@@ -6,11 +6,17 @@
 
 #pragma once
 
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/eccvm/eccvm_builder_types.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/stdlib/primitives/bigfield/constants.hpp"
+#include <algorithm>
+#include <cstddef>
 #include <deque>
+#include <iterator>
+#include <span>
+#include <vector>
 namespace bb {
 
 /**
@@ -79,6 +85,104 @@ template <typename CycleGroup> struct VMOperation {
 };
 using ECCVMOperation = VMOperation<curve::BN254::Group>;
 
+/**
+ * @brief A read-only view of a range of the subtables of an EccOpsTable, in the order they appear in the aggregate
+ * table
+ * @details Gives access to the aggregate table without reconstructing it in contiguous memory. Indexing finds the
+ * subtable holding an op by a binary search over the prefix sums of the subtable sizes, iteration walks the subtables
+ * in turn. The view refers to the storage of the table and is invalidated by any subsequent modification of the table.
+ *
+ * @tparam OpFormat Format of the ECC operations stored in the table
+ */
+template <typename OpFormat> class EccOpsTableView {
+  public:
+    using Segment = std::span<const OpFormat>;
+
+    class Iterator {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = OpFormat;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const OpFormat*;
+        using reference = const OpFormat&;
+
+        Iterator() = default;
+        Iterator(const std::vector<Segment>* segments, size_t segment_idx)
+            : segments(segments)
+            , segment_idx(segment_idx)
+        {
+            skip_exhausted_segments();
+        }
+
+        reference operator*() const { return (*segments)[segment_idx][op_idx]; }
+        pointer operator->() const { return &(*segments)[segment_idx][op_idx]; }
+        Iterator& operator++()
+        {
+            op_idx++;
+            skip_exhausted_segments();
+            return *this;
+        }
+        Iterator operator++(int)
+        {
+            Iterator result = *this;
+            ++(*this);
+            return result;
+        }
+        bool operator==(const Iterator& other) const
+        {
+            return segment_idx == other.segment_idx && op_idx == other.op_idx;
+        }
+
+      private:
+        void skip_exhausted_segments()
+        {
+            while (segment_idx < segments->size() && op_idx == (*segments)[segment_idx].size()) {
+                segment_idx++;
+                op_idx = 0;
+            }
+        }
+
+        const std::vector<Segment>* segments = nullptr;
+        size_t segment_idx = 0;
+        size_t op_idx = 0;
+    };
+
+    EccOpsTableView() = default;
+    explicit EccOpsTableView(std::vector<Segment> segments_in)
+        : segments(std::move(segments_in))
+        , offsets(segments.size() + 1, 0)
+    {
+        for (size_t i = 0; i < segments.size(); ++i) {
+            offsets[i + 1] = offsets[i] + segments[i].size();
+        }
+    }
+
+    size_t size() const { return offsets.back(); }
+    bool empty() const { return size() == 0; }
+
+    // The subtables in the view in their logical order, and the index of the first op of each of them
+    const std::vector<Segment>& get_segments() const { return segments; }
+    size_t segment_offset(size_t segment_idx) const { return offsets[segment_idx]; }
+
+    const OpFormat& operator[](size_t index) const
+    {
+        ASSERT(index < size());
+        // the segment holding the op is the last one starting at or before index (skipping any empty segments)
+        const auto it = std::upper_bound(offsets.begin(), offsets.end(), index);
+        const auto segment_idx = static_cast<size_t>(std::distance(offsets.begin(), it)) - 1;
+        return segments[segment_idx][index - offsets[segment_idx]];
+    }
+
+    const OpFormat& back() const { return (*this)[size() - 1]; }
+
+    Iterator begin() const { return Iterator(&segments, 0); }
+    Iterator end() const { return Iterator(&segments, segments.size()); }
+
+  private:
+    std::vector<Segment> segments;
+    std::vector<size_t> offsets = { 0 };
+};
+
 /**
  * @brief A table of ECC operations
  * @details The table is constructed via concatenation of subtables of ECC operations. The table concatentation protocol
@@ -93,6 +197,8 @@ template <typename OpFormat> class EccOpsTable {
     std::vector<Subtable> table;
 
   public:
+    using View = EccOpsTableView<OpFormat>;
+
     size_t size() const
     {
         size_t total = 0;
@@ -133,7 +239,24 @@ template <typename OpFormat> class EccOpsTable {
         return table.front().front(); // should never reach here
     }
 
-    // highly inefficient copy-based reconstruction of the table for use in ECCVM/Translator
+    /**
+     * @brief Get a view of the aggregate table formed by the subtables in [subtable_start_idx, subtable_end_idx),
+     * without copying them
+     */
+    View get_view(size_t subtable_start_idx, size_t subtable_end_idx) const
+    {
+        ASSERT(subtable_start_idx <= subtable_end_idx && subtable_end_idx <= table.size());
+        std::vector<typename View::Segment> segments;
+        segments.reserve(subtable_end_idx - subtable_start_idx);
+        for (size_t i = subtable_start_idx; i < subtable_end_idx; ++i) {
+            segments.emplace_back(table[i]);
+        }
+        return View(std::move(segments));
+    }
+
+    View get_view() const { return get_view(0, table.size()); }
+
+    // highly inefficient copy-based reconstruction of the table, prefer get_view()
     std::vector<OpFormat> get_reconstructed() const
     {
         std::vector<OpFormat> reconstructed_table;
@@ -152,6 +275,8 @@ template <typename OpFormat> class EccOpsTable {
  * | OP | X | Y | z_1 | z_2 | mul_scalar_full |
  */
 using EccvmOpsTable = EccOpsTable<ECCVMOperation>;
+using EccvmOpsView = EccvmOpsTable::View;
+using UltraOpsView = EccOpsTableView<UltraOp>;
 
 /**
  * @brief Stores a table of elliptic curve operations represented in the Ultra format
@@ -188,6 +313,7 @@ class UltraEccOpsTable {
     void create_new_subtable(size_t size_hint = 0) { table.create_new_subtable(size_hint); }
     void push(const UltraOp& op) { table.push(op); }
     std::vector<UltraOp> get_reconstructed() const { return table.get_reconstructed(); }
+    UltraOpsView get_view() const { return table.get_view(); }
 
     // Construct the columns of the full ultra ecc ops table
     ColumnPolynomials construct_table_columns() const
@@ -221,9 +347,8 @@ class UltraEccOpsTable {
 
   private:
     /**
-     * @brief Construct polynomials corresponding to the columns of the reconstructed ultra ops table for the given
-     * range of subtables
-     * TODO(https://github.com/AztecProtocol/barretenberg/issues/1267): multithread this functionality
+     * @brief Construct polynomials corresponding to the columns of the ultra ops table for the given range of
+     * subtables, reading the ops straight from a view of the subtables
      * @param target_columns
      */
     ColumnPolynomials construct_column_polynomials_from_subtables(const size_t poly_size,
@@ -235,22 +360,22 @@ class UltraEccOpsTable {
             poly = Polynomial<Fr>(poly_size);
         }
 
-        size_t i = 0;
-        for (size_t subtable_idx = subtable_start_idx; subtable_idx < subtable_end_idx; ++subtable_idx) {
-            const auto& subtable = table.get()[subtable_idx];
-            for (const auto& op : subtable) {
+        // The rows of each op are determined by its index in the view, so the ops can be written in parallel
+        const UltraOpsView ops = table.get_view(subtable_start_idx, subtable_end_idx);
+        parallel_for_range(ops.size(), [&](size_t start, size_t end) {
+            for (size_t op_idx = start; op_idx < end; ++op_idx) {
+                const UltraOp& op = ops[op_idx];
+                const size_t i = op_idx * NUM_ROWS_PER_OP;
                 column_polynomials[0].at(i) = op.op_code.value();
                 column_polynomials[1].at(i) = op.x_lo;
                 column_polynomials[2].at(i) = op.x_hi;
                 column_polynomials[3].at(i) = op.y_lo;
-                i++;
-                column_polynomials[0].at(i) = 0; // only the first 'op' field is utilized
-                column_polynomials[1].at(i) = op.y_hi;
-                column_polynomials[2].at(i) = op.z_1;
-                column_polynomials[3].at(i) = op.z_2;
-                i++;
+                column_polynomials[0].at(i + 1) = 0; // only the first 'op' field is utilized
+                column_polynomials[1].at(i + 1) = op.y_hi;
+                column_polynomials[2].at(i + 1) = op.z_1;
+                column_polynomials[3].at(i + 1) = op.z_2;
             }
-        }
+        });
         return column_polynomials;
     }
 };
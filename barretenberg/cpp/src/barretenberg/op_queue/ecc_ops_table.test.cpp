@@ -160,3 +160,52 @@ TEST(EccOpsTableTest, EccvmOpsTable)
     // Check that the copy-based reconstruction of the eccvm ops table matches the expected table
     EXPECT_EQ(expected_eccvm_ops_table.eccvm_ops, eccvm_ops_table.get_reconstructed());
 }
+
+// Ensure a view of the EccvmOpsTable matches the concatenated table without reconstructing it
+TEST(EccOpsTableTest, EccvmOpsTableView)
+{
+    // Construct sets of eccvm ops, including an empty subtable which the view must skip over
+    const size_t NUM_SUBTABLES = 4;
+    std::array<std::vector<ECCVMOperation>, NUM_SUBTABLES> subtable_eccvm_ops;
+    std::array<size_t, NUM_SUBTABLES> subtable_op_counts = { 4, 0, 3, 5 };
+    for (auto [subtable_ops, op_count] : zip_view(subtable_eccvm_ops, subtable_op_counts)) {
+        for (size_t i = 0; i < op_count; ++i) {
+            subtable_ops.push_back(EccOpsTableTest::random_eccvm_op());
+        }
+    }
+
+    EccOpsTableTest::MockEccvmOpsTable expected_eccvm_ops_table(subtable_eccvm_ops);
+
+    EccvmOpsTable eccvm_ops_table;
+    for (const auto& subtable_ops : subtable_eccvm_ops) {
+        eccvm_ops_table.create_new_subtable();
+        for (const auto& op : subtable_ops) {
+            eccvm_ops_table.push(op);
+        }
+    }
+
+    // Check that both indexing into and iterating over the view of the full table match the mock table
+    const auto& expected_ops = expected_eccvm_ops_table.eccvm_ops;
+    EccvmOpsView view = eccvm_ops_table.get_view();
+    EXPECT_EQ(view.size(), expected_ops.size());
+    EXPECT_EQ(view.back(), expected_ops.back());
+    size_t idx = 0;
+    for (const auto& op : view) {
+        EXPECT_EQ(op, expected_ops[idx]);
+        EXPECT_EQ(view[idx], expected_ops[idx]);
+        idx++;
+    }
+    EXPECT_EQ(idx, expected_ops.size());
+
+    // Check a view of all but the most recently prepended subtable, which holds the ops of the first subtable
+    const size_t num_skipped_ops = subtable_op_counts.back();
+    EccvmOpsView partial_view = eccvm_ops_table.get_view(1, eccvm_ops_table.num_subtables());
+    EXPECT_EQ(partial_view.size(), expected_ops.size() - num_skipped_ops);
+    idx = num_skipped_ops;
+    for (const auto& op : partial_view) {
+        EXPECT_EQ(op, expected_ops[idx]);
+        EXPECT_EQ(partial_view[idx - num_skipped_ops], expected_ops[idx]);
+        idx++;
+    }
+    EXPECT_EQ(idx, expected_ops.size());
+}
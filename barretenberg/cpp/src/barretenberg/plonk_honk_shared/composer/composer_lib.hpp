@@ -6,14 +6,44 @@
 
 #pragma once
 #include "barretenberg/common/ref_array.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/flavor/flavor.hpp"
 #include "barretenberg/polynomials/polynomial_store.hpp"
 #include "barretenberg/stdlib_circuit_builders/plookup_tables/types.hpp"
 
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 namespace bb {
 
+/**
+ * @brief Compute the exclusive prefix sums of the sizes of a sequence of containers, with the total as the last entry
+ * @details Used to locate each lookup table (or the lookup gates of each table) within the concatenation of all of
+ * them, so that the concatenation can be split evenly between threads irrespective of the table boundaries.
+ */
+template <typename Range, typename SizeFn> std::vector<size_t> compute_concatenated_offsets(Range& range, SizeFn size)
+{
+    std::vector<size_t> offsets;
+    offsets.reserve(range.size() + 1);
+    size_t offset = 0;
+    for (auto& element : range) {
+        offsets.emplace_back(offset);
+        offset += size(element);
+    }
+    offsets.emplace_back(offset);
+    return offsets;
+}
+
+/**
+ * @brief Given the offsets computed by compute_concatenated_offsets, find the (last non-empty) element containing the
+ * entry at a given index of the concatenation
+ */
+inline size_t find_concatenated_element(const std::vector<size_t>& offsets, size_t idx)
+{
+    return static_cast<size_t>(std::upper_bound(offsets.begin(), offsets.end(), idx) - offsets.begin() - 1);
+}
+
 template <typename Flavor>
 void construct_lookup_table_polynomials(const RefArray<typename Flavor::Polynomial, 4>& table_polynomials,
                                         const typename Flavor::CircuitBuilder& circuit,
@@ -35,17 +65,26 @@ void construct_lookup_table_polynomials(const RefArray<typename Flavor::Polynomi
         offset = circuit.blocks.lookup.trace_offset + additional_offset;
     }
 
-    for (const auto& table : circuit.lookup_tables) {
-        const fr table_index(table.table_index);
-
-        for (size_t i = 0; i < table.size(); ++i) {
-            table_polynomials[0].at(offset) = table.column_1[i];
-            table_polynomials[1].at(offset) = table.column_2[i];
-            table_polynomials[2].at(offset) = table.column_3[i];
-            table_polynomials[3].at(offset) = table_index;
-            ++offset;
-        }
-    }
+    // Split the rows of the concatenated tables evenly between threads
+    const auto& tables = circuit.lookup_tables;
+    const auto table_offsets = compute_concatenated_offsets(tables, [](const auto& table) { return table.size(); });
+    parallel_for_range(
+        table_offsets.back(),
+        [&](size_t start, size_t end) {
+            size_t table_idx = find_concatenated_element(table_offsets, start);
+            for (size_t row_idx = start; row_idx < end; ++row_idx) {
+                while (table_offsets[table_idx + 1] <= row_idx) {
+                    ++table_idx;
+                }
+                const auto& table = tables[table_idx];
+                const size_t i = row_idx - table_offsets[table_idx];
+                table_polynomials[0].at(offset + row_idx) = table.column_1[i];
+                table_polynomials[1].at(offset + row_idx) = table.column_2[i];
+                table_polynomials[2].at(offset + row_idx) = table.column_3[i];
+                table_polynomials[3].at(offset + row_idx) = fr(table.table_index);
+            }
+        },
+        /*no_multhreading_if_less_or_equal=*/1 << 10);
 }
 
 /**
@@ -54,6 +93,10 @@ void construct_lookup_table_polynomials(const RefArray<typename Flavor::Polynomi
  * @details Read counts are needed for the log derivative lookup argument. The table polynomials are constructed as a
  * concatenation of basic 3-column tables. Similarly, the read counts polynomial is constructed as the concatenation of
  * read counts for the individual tables.
+ *
+ * The lookup gates of all tables are split evenly between threads. Each thread finds the table index of its lookups and
+ * counts them in its own histogram over the concatenated tables; the histograms are then summed row by row, so no
+ * atomics are needed and the result does not depend on the number of threads.
  */
 template <typename Flavor>
 void construct_lookup_read_counts(typename Flavor::Polynomial& read_counts,
@@ -61,27 +104,68 @@ void construct_lookup_read_counts(typename Flavor::Polynomial& read_counts,
                                   typename Flavor::CircuitBuilder& circuit,
                                   [[maybe_unused]] const size_t dyadic_circuit_size)
 {
+    using FF = typename Flavor::FF;
+    // Minimum number of lookup gates per thread, amortizing the zeroing and merging of a histogram
+    constexpr size_t MIN_LOOKUPS_PER_THREAD = 1 << 12;
+
     // TODO(https://github.com/AztecProtocol/barretenberg/issues/1033): construct tables and counts at top of trace
-    size_t table_offset = circuit.blocks.lookup.trace_offset;
+    const size_t table_offset = circuit.blocks.lookup.trace_offset;
 
-    // loop over all tables used in the circuit; each table contains data about the lookups made on it
-    for (auto& table : circuit.lookup_tables) {
-        table.initialize_index_map();
+    // Offsets of each table in the polynomials (relative to the first) and of its lookup gates among all lookup gates
+    auto& tables = circuit.lookup_tables;
+    const auto table_offsets = compute_concatenated_offsets(tables, [](const auto& table) { return table.size(); });
+    const auto gate_offsets =
+        compute_concatenated_offsets(tables, [](const auto& table) { return table.lookup_gates.size(); });
+    const size_t tables_size = table_offsets.back();
+    const size_t num_lookups = gate_offsets.back();
 
-        for (auto& gate_data : table.lookup_gates) {
+    // The entry-index maps of the tables are independent of one another
+    parallel_for(tables.size(), [&](size_t table_idx) {
+        if (!tables[table_idx].lookup_gates.empty()) {
+            tables[table_idx].initialize_index_map();
+        }
+    });
+
+    // Count the reads of each entry of the concatenated tables, one histogram per thread
+    const MultithreadData thread_data = calculate_thread_data(num_lookups, MIN_LOOKUPS_PER_THREAD);
+    std::vector<std::vector<uint32_t>> thread_read_counts(thread_data.num_threads);
+    parallel_for(thread_data.num_threads, [&](size_t thread_idx) {
+        auto& counts = thread_read_counts[thread_idx];
+        counts.assign(tables_size, 0);
+        const size_t start = thread_data.start[thread_idx];
+        const size_t end = thread_data.end[thread_idx];
+        size_t table_idx = find_concatenated_element(gate_offsets, start);
+        for (size_t gate_idx = start; gate_idx < end; ++gate_idx) {
+            while (gate_offsets[table_idx + 1] <= gate_idx) {
+                ++table_idx;
+            }
+            const auto& table = tables[table_idx];
+            const auto& gate_data = table.lookup_gates[gate_idx - gate_offsets[table_idx]];
             // convert lookup gate data to an array of three field elements, one for each of the 3 columns
             auto table_entry = gate_data.to_table_components(table.use_twin_keys);
 
-            // find the index of the entry in the table
-            auto index_in_table = table.index_map[table_entry];
-
-            // increment the read count at the corresponding index in the full polynomial
-            size_t index_in_poly = table_offset + index_in_table;
-            read_counts.at(index_in_poly)++;
-            read_tags.at(index_in_poly) = 1; // tag is 1 if entry has been read 1 or more times
+            // find the index of the entry in the table and count the read
+            counts[table_offsets[table_idx] + table.index_map[table_entry]]++;
         }
-        table_offset += table.size(); // set the offset of the next table within the polynomials
-    }
+    });
+
+    // Merge the histograms into the polynomials
+    parallel_for_range(
+        tables_size,
+        [&](size_t start, size_t end) {
+            for (size_t row_idx = start; row_idx < end; ++row_idx) {
+                uint32_t count = 0;
+                for (const auto& counts : thread_read_counts) {
+                    count += counts[row_idx];
+                }
+                if (count > 0) {
+                    // increment the read count at the corresponding index in the full polynomial
+                    read_counts.at(table_offset + row_idx) += FF(count);
+                    read_tags.at(table_offset + row_idx) = 1; // tag is 1 if entry has been read 1 or more times
+                }
+            }
+        },
+        /*no_multhreading_if_less_or_equal=*/1 << 10);
 }
 
 } // namespace bb
@@ -79,4 +79,58 @@ TEST_F(ComposerLibTests, LookupReadCounts)
         }
         idx++;
     }
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Check the table polynomials and read counts/tags of a circuit with enough lookups, into several tables, for
+ * them to be split between threads against a direct serial computation
+ *
+ */
+TEST_F(ComposerLibTests, LookupTablesAndReadCountsManyLookups)
+{
+    using Builder = UltraCircuitBuilder;
+    using Polynomial = typename Flavor::Polynomial;
+    auto& engine = numeric::get_debug_randomness();
+
+    Builder builder;
+    for (size_t i = 0; i < 4000; ++i) {
+        FF left{ engine.get_random_uint32() };
+        FF right{ engine.get_random_uint32() };
+        auto left_idx = builder.add_variable(left);
+        auto right_idx = builder.add_variable(right);
+        auto table_id = (i % 3 == 0) ? plookup::MultiTableId::UINT32_AND : plookup::MultiTableId::UINT32_XOR;
+        auto accumulators = plookup::get_lookup_accumulators(table_id, left, right, /*is_2_to_1_lookup*/ true);
+        builder.create_gates_from_plookup_accumulators(table_id, accumulators, left_idx, right_idx);
+    }
+
+    const size_t circuit_size = numeric::round_up_power_2(builder.get_tables_size() + 1);
+    std::array<Polynomial, 4> tables{ Polynomial(circuit_size),
+                                      Polynomial(circuit_size),
+                                      Polynomial(circuit_size),
+                                      Polynomial(circuit_size) };
+    Polynomial read_counts{ circuit_size };
+    Polynomial read_tags{ circuit_size };
+    construct_lookup_table_polynomials<Flavor>(RefArray{ tables[0], tables[1], tables[2], tables[3] },
+                                               builder,
+                                               circuit_size);
+    construct_lookup_read_counts<Flavor>(read_counts, read_tags, builder, circuit_size);
+
+    size_t offset = builder.blocks.lookup.trace_offset;
+    for (auto& table : builder.lookup_tables) {
+        plookup::LookupHashTable index_map;
+        index_map.initialize(table.column_1, table.column_2, table.column_3);
+        std::vector<size_t> expected_counts(table.size(), 0);
+        for (auto& gate_data : table.lookup_gates) {
+            expected_counts[index_map[gate_data.to_table_components(table.use_twin_keys)]]++;
+        }
+        for (size_t i = 0; i < table.size(); ++i) {
+            EXPECT_EQ(tables[0][offset + i], table.column_1[i]);
+            EXPECT_EQ(tables[1][offset + i], table.column_2[i]);
+            EXPECT_EQ(tables[2][offset + i], table.column_3[i]);
+            EXPECT_EQ(tables[3][offset + i], FF(table.table_index));
+            EXPECT_EQ(read_counts[offset + i], FF(expected_counts[i]));
+            EXPECT_EQ(read_tags[offset + i], FF(expected_counts[i] > 0 ? 1 : 0));
+        }
+        offset += table.size();
+    }
+}
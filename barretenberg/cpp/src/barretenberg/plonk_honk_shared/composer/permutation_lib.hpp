@@ -15,8 +15,10 @@
 
 #include "barretenberg/common/ref_span.hpp"
 #include "barretenberg/common/ref_vector.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/flavor/flavor.hpp"
+#include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/plonk/proof_system/proving_key/proving_key.hpp"
 #include "barretenberg/polynomials/iterate_over_domain.hpp"
 
@@ -24,6 +26,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <initializer_list>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
@@ -125,7 +128,151 @@ template <size_t NUM_WIRES, bool generalized> struct PermutationMapping {
     }
 };
 
-using CyclicPermutation = std::vector<cycle_node>;
+/**
+ * @brief The copy cycles of a circuit in compressed sparse row form
+ * @details The cycle of the i-th variable consists of nodes[offsets[i]], ..., nodes[offsets[i + 1] - 1], listed in
+ * trace order (by row, then by column). Every wire entry of the trace lies in exactly one cycle, so the number of nodes
+ * is at most NUM_WIRES * circuit_size and fits in a uint32_t.
+ */
+struct CopyCycles {
+    std::vector<uint32_t> offsets{ 0 };
+    std::vector<cycle_node> nodes;
+
+    // The number of cycles, i.e. the number of variables in the circuit
+    size_t size() const { return offsets.size() - 1; }
+
+    std::span<const cycle_node> operator[](size_t idx) const
+    {
+        return { nodes.data() + offsets[idx], nodes.data() + offsets[idx + 1] };
+    }
+};
+
+/**
+ * @brief Construct the copy cycles of a circuit whose blocks have been placed in the trace at the given offsets
+ *
+ * @details A parallel counting sort of the wire entries of the trace by real variable index. Each thread takes a
+ * contiguous range of rows and first counts, then scatters, its entries into buckets of consecutive variable indices;
+ * each bucket is then counting-sorted by variable on a single thread. Both passes are stable, so every cycle lists its
+ * nodes in trace order exactly as a serial traversal of the trace would.
+ *
+ * @param builder Circuit whose wires index into its variables
+ * @param block_offsets The offset of each block of builder.blocks in the trace
+ */
+template <typename Builder> CopyCycles construct_copy_cycles(Builder& builder, std::span<const uint32_t> block_offsets)
+{
+    PROFILE_THIS_NAME("construct_copy_cycles");
+
+    constexpr size_t NUM_WIRES = Builder::NUM_WIRES;
+    constexpr size_t MAX_LOG_NUM_BUCKETS = 12;
+    constexpr size_t MIN_ROWS_PER_RANGE = 1 << 10;
+
+    struct Entry {
+        uint32_t real_var_idx;
+        cycle_node node;
+    };
+    struct RowRange {
+        size_t block_idx;
+        uint32_t start;
+        uint32_t end;
+    };
+
+    const auto& real_variable_index = builder.real_variable_index;
+    const size_t num_variables = builder.variables.size();
+    if (num_variables == 0) {
+        return {};
+    }
+    // Bucket of a variable; the variables are split into at most 2^MAX_LOG_NUM_BUCKETS buckets of 2^shift each
+    const size_t log_num_variables = num_variables == 1 ? 0 : numeric::get_msb(num_variables - 1) + 1;
+    const size_t shift = log_num_variables > MAX_LOG_NUM_BUCKETS ? log_num_variables - MAX_LOG_NUM_BUCKETS : 0;
+    const size_t num_buckets = ((num_variables - 1) >> shift) + 1;
+
+    // Split the rows of the blocks into roughly one contiguous range per thread
+    auto blocks = builder.blocks.get();
+    size_t num_rows = 0;
+    for (auto& block : blocks) {
+        num_rows += block.size();
+    }
+    const size_t rows_per_range = std::max(MIN_ROWS_PER_RANGE, (num_rows + get_num_cpus() - 1) / get_num_cpus());
+    std::vector<RowRange> ranges;
+    for (size_t block_idx = 0; block_idx < blocks.size(); ++block_idx) {
+        const size_t block_size = blocks[block_idx].size();
+        for (size_t start = 0; start < block_size; start += rows_per_range) {
+            const size_t end = std::min(start + rows_per_range, block_size);
+            ranges.push_back({ block_idx, static_cast<uint32_t>(start), static_cast<uint32_t>(end) });
+        }
+    }
+
+    // Count the entries of each range falling in each bucket
+    std::vector<uint32_t> range_bucket_positions(ranges.size() * num_buckets, 0);
+    parallel_for(ranges.size(), [&](size_t range_idx) {
+        const auto& range = ranges[range_idx];
+        const auto& block = blocks[range.block_idx];
+        uint32_t* bucket_counts = &range_bucket_positions[range_idx * num_buckets];
+        for (uint32_t row_idx = range.start; row_idx < range.end; ++row_idx) {
+            for (size_t wire_idx = 0; wire_idx < NUM_WIRES; ++wire_idx) {
+                bucket_counts[real_variable_index[block.wires[wire_idx][row_idx]] >> shift]++;
+            }
+        }
+    });
+
+    // Turn the counts into the positions at which each range writes into each bucket; the entries of a bucket are
+    // ordered by range, i.e. in trace order
+    std::vector<uint32_t> bucket_starts(num_buckets + 1);
+    uint32_t num_entries = 0;
+    for (size_t bucket_idx = 0; bucket_idx < num_buckets; ++bucket_idx) {
+        bucket_starts[bucket_idx] = num_entries;
+        for (size_t range_idx = 0; range_idx < ranges.size(); ++range_idx) {
+            uint32_t& position = range_bucket_positions[range_idx * num_buckets + bucket_idx];
+            const uint32_t count = position;
+            position = num_entries;
+            num_entries += count;
+        }
+    }
+    bucket_starts[num_buckets] = num_entries;
+
+    // Scatter the entries into their buckets
+    std::vector<Entry> entries(num_entries);
+    parallel_for(ranges.size(), [&](size_t range_idx) {
+        const auto& range = ranges[range_idx];
+        const auto& block = blocks[range.block_idx];
+        const uint32_t offset = block_offsets[range.block_idx];
+        uint32_t* bucket_positions = &range_bucket_positions[range_idx * num_buckets];
+        for (uint32_t row_idx = range.start; row_idx < range.end; ++row_idx) {
+            for (uint32_t wire_idx = 0; wire_idx < NUM_WIRES; ++wire_idx) {
+                const uint32_t real_var_idx = real_variable_index[block.wires[wire_idx][row_idx]];
+                Entry& entry = entries[bucket_positions[real_var_idx >> shift]++];
+                entry = { real_var_idx, cycle_node{ wire_idx, row_idx + offset } };
+            }
+        }
+    });
+
+    // Sort each bucket by variable. A bucket starts where the cycle of its first variable does.
+    CopyCycles copy_cycles;
+    copy_cycles.offsets.resize(num_variables + 1);
+    copy_cycles.nodes.resize(num_entries);
+    parallel_for(num_buckets, [&](size_t bucket_idx) {
+        const size_t first_variable = bucket_idx << shift;
+        const size_t bucket_num_variables = std::min(num_variables, (bucket_idx + 1) << shift) - first_variable;
+        std::vector<uint32_t> positions(bucket_num_variables, 0);
+        for (uint32_t entry_idx = bucket_starts[bucket_idx]; entry_idx < bucket_starts[bucket_idx + 1]; ++entry_idx) {
+            positions[entries[entry_idx].real_var_idx - first_variable]++;
+        }
+        uint32_t position = bucket_starts[bucket_idx];
+        for (size_t idx = 0; idx < bucket_num_variables; ++idx) {
+            copy_cycles.offsets[first_variable + idx] = position;
+            const uint32_t count = positions[idx];
+            positions[idx] = position;
+            position += count;
+        }
+        for (uint32_t entry_idx = bucket_starts[bucket_idx]; entry_idx < bucket_starts[bucket_idx + 1]; ++entry_idx) {
+            const Entry& entry = entries[entry_idx];
+            copy_cycles.nodes[positions[entry.real_var_idx - first_variable]++] = entry.node;
+        }
+    });
+    copy_cycles.offsets[num_variables] = num_entries;
+
+    return copy_cycles;
+}
 
 namespace {
 /**
@@ -144,7 +291,7 @@ template <typename Flavor, bool generalized>
 PermutationMapping<Flavor::NUM_WIRES, generalized> compute_permutation_mapping(
     const typename Flavor::CircuitBuilder& circuit_constructor,
     typename Flavor::ProvingKey* proving_key,
-    const std::vector<CyclicPermutation>& wire_copy_cycles)
+    const CopyCycles& wire_copy_cycles)
 {
 
     // Initialize the table of permutations so that every element points to itself
@@ -153,18 +300,30 @@ PermutationMapping<Flavor::NUM_WIRES, generalized> compute_permutation_mapping(
     // Represents the idx of a variable in circuit_constructor.variables (needed only for generalized)
     std::span<const uint32_t> real_variable_tags = circuit_constructor.real_variable_tags;
 
-    // Go through each cycle
-    for (size_t cycle_idx = 0; cycle_idx < wire_copy_cycles.size(); ++cycle_idx) {
-        const CyclicPermutation& cycle = wire_copy_cycles[cycle_idx];
-        for (size_t node_idx = 0; node_idx < cycle.size(); ++node_idx) {
+    // Go through the nodes of all cycles. Every node sets only its own entry of the mapping, so the nodes are split
+    // evenly between threads regardless of the cycle lengths.
+    std::span<const uint32_t> cycle_offsets = wire_copy_cycles.offsets;
+    std::span<const cycle_node> nodes = wire_copy_cycles.nodes;
+    parallel_for_range(nodes.size(), [&](size_t start, size_t end) {
+        // Find the cycle containing the first node of the range (the last cycle starting at or before it)
+        auto cycle_idx = static_cast<size_t>(
+            std::upper_bound(cycle_offsets.begin(), cycle_offsets.end(), static_cast<uint32_t>(start)) -
+            cycle_offsets.begin() - 1);
+        for (size_t node_idx = start; node_idx < end; ++node_idx) {
+            while (cycle_offsets[cycle_idx + 1] <= node_idx) {
+                ++cycle_idx;
+            }
+            const size_t cycle_start = cycle_offsets[cycle_idx];
+            const size_t cycle_end = cycle_offsets[cycle_idx + 1];
+
             // Get the indices (column, row) of the current node in the cycle
-            const cycle_node& current_node = cycle[node_idx];
+            const cycle_node& current_node = nodes[node_idx];
             const auto current_row = static_cast<ptrdiff_t>(current_node.gate_idx);
             const auto current_column = current_node.wire_idx;
 
             // Get indices of next node; If the current node is last in the cycle, then the next is the first one
-            size_t next_node_idx = (node_idx == cycle.size() - 1 ? 0 : node_idx + 1);
-            const cycle_node& next_node = cycle[next_node_idx];
+            const size_t next_node_idx = (node_idx == cycle_end - 1 ? cycle_start : node_idx + 1);
+            const cycle_node& next_node = nodes[next_node_idx];
             const auto next_row = next_node.gate_idx;
             const auto next_column = static_cast<uint8_t>(next_node.wire_idx);
 
@@ -173,8 +332,8 @@ PermutationMapping<Flavor::NUM_WIRES, generalized> compute_permutation_mapping(
             mapping.sigmas[current_column].col_idx[current_row] = next_column;
 
             if constexpr (generalized) {
-                const bool first_node = (node_idx == 0);
-                const bool last_node = (next_node_idx == 0);
+                const bool first_node = (node_idx == cycle_start);
+                const bool last_node = (next_node_idx == cycle_start);
 
                 if (first_node) {
                     mapping.ids[current_column].is_tag[current_row] = true;
@@ -189,7 +348,7 @@ PermutationMapping<Flavor::NUM_WIRES, generalized> compute_permutation_mapping(
                 }
             }
         }
-    }
+    });
 
     // Add information about public inputs so that the cycles can be altered later; See the construction of the
     // permutation polynomials for details.
@@ -234,11 +393,12 @@ void compute_honk_style_permutation_lagrange_polynomials_from_mapping(
 
     const MultithreadData thread_data = calculate_thread_data(domain_size);
 
-    size_t wire_idx = 0;
-    for (auto& current_permutation_poly : permutation_polynomials) {
-        parallel_for(thread_data.num_threads, [&](size_t j) {
-            const size_t start = thread_data.start[j];
-            const size_t end = thread_data.end[j];
+    // Fill all of the polynomials in a single parallel pass over the active rows
+    parallel_for(thread_data.num_threads, [&](size_t j) {
+        const size_t start = thread_data.start[j];
+        const size_t end = thread_data.end[j];
+        size_t wire_idx = 0;
+        for (auto& current_permutation_poly : permutation_polynomials) {
             for (size_t i = start; i < end; ++i) {
                 const size_t poly_idx = proving_key->active_region_data.get_idx(i);
                 const auto idx = static_cast<ptrdiff_t>(poly_idx);
@@ -266,9 +426,9 @@ void compute_honk_style_permutation_lagrange_polynomials_from_mapping(
                     current_permutation_poly.at(poly_idx) = FF(current_row_idx + num_gates * current_col_idx);
                 }
             }
-        });
-        wire_idx++;
-    }
+            wire_idx++;
+        }
+    });
 }
 } // namespace
 
@@ -426,7 +586,7 @@ inline std::tuple<LegacyPolynomial<FF>, LegacyPolynomial<FF>> compute_first_and_
 template <typename Flavor>
 void compute_permutation_argument_polynomials(const typename Flavor::CircuitBuilder& circuit,
                                               typename Flavor::ProvingKey* key,
-                                              const std::vector<CyclicPermutation>& copy_cycles)
+                                              const CopyCycles& copy_cycles)
 {
     constexpr bool generalized = IsUltraPlonkOrHonk<Flavor>;
     auto mapping = compute_permutation_mapping<Flavor, generalized>(circuit, key, copy_cycles);
@@ -83,6 +83,10 @@ struct TraceSettings {
     // The size of the overflow block. Specified separately because it is allowed to be determined at runtime in the
     // context of VK computation
     uint32_t overflow_capacity = 0;
+    // Free the selectors of each builder block as soon as they are copied into the proving key polynomials, so that the
+    // builder and polynomial copies are not resident at the same time. The builder keeps its wires (and so its block
+    // sizes) but can no longer be used to construct a proving key.
+    bool release_builder_selectors = false;
 
     size_t size() const { return structure->size() + static_cast<size_t>(overflow_capacity); }
 
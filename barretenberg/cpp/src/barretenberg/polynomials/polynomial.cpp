@@ -8,6 +8,7 @@
 #include "barretenberg/common/assert.hpp"
 #include "barretenberg/common/slab_allocator.hpp"
 #include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/fields/field_vec.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/numeric/bitop/pow.hpp"
 #include "barretenberg/polynomials/shared_shifted_virtual_zeroes_array.hpp"
@@ -181,9 +182,8 @@ template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator+=(PolynomialSpan
     parallel_for(num_threads, [&](size_t j) {
         size_t offset = j * range_per_thread + other.start_index;
         size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            at(i) += other[i];
-        }
+        auto chunk = coeffs().subspan(offset - start_index(), end - offset);
+        field_vec::add_vec<Fr>(chunk, chunk, other.span.subspan(offset - other.start_index, end - offset));
     });
     return *this;
 }
@@ -224,17 +224,20 @@ template <typename Fr> Polynomial<Fr> Polynomial<Fr>::partial_evaluate_mle(std::
     // Evaluate variable X_{n-1} at u_{m-1}
     Fr u_l = evaluation_points[m - 1];
 
-    for (size_t i = 0; i < n_l; i++) {
+    if (start_index() == 0) {
         // Initiate our intermediate results using this Polynomial.
-        intermediate.at(i) = get(i) + u_l * (get(i + n_l) - get(i));
+        field_vec::fold_vec<Fr>(intermediate.coeffs(), coeffs().subspan(0, n_l), coeffs().subspan(n_l, n_l), u_l);
+    } else {
+        for (size_t i = 0; i < n_l; i++) {
+            intermediate.at(i) = get(i) + u_l * (get(i + n_l) - get(i));
+        }
     }
     // Evaluate m-1 variables X_{n-l-1}, ..., X_{n-2} at m-1 remaining values u_0,...,u_{m-2})
     for (size_t l = 1; l < m; ++l) {
         n_l = 1 << (n - l - 1);
         u_l = evaluation_points[m - l - 1];
-        for (size_t i = 0; i < n_l; ++i) {
-            intermediate.at(i) = intermediate[i] + u_l * (intermediate[i + n_l] - intermediate[i]);
-        }
+        auto lows = intermediate.coeffs().subspan(0, n_l);
+        field_vec::fold_vec<Fr>(lows, lows, intermediate.coeffs().subspan(n_l, n_l), u_l);
     }
 
     // Construct resulting Polynomial g(X_0,…,X_{n-m-1})) = p(X_0,…,X_{n-m-1},u_0,...u_{m-1}) from buffer
@@ -270,9 +273,8 @@ template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator-=(PolynomialSpan
     parallel_for(num_threads, [&](size_t j) {
         const size_t offset = j * range_per_thread + other.start_index;
         const size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            at(i) -= other[i];
-        }
+        auto chunk = coeffs().subspan(offset - start_index(), end - offset);
+        field_vec::sub_vec<Fr>(chunk, chunk, other.span.subspan(offset - other.start_index, end - offset));
     });
     return *this;
 }
@@ -285,9 +287,8 @@ template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator*=(const Fr scali
     parallel_for(num_threads, [&](size_t j) {
         const size_t offset = j * range_per_thread;
         const size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            data()[i] *= scaling_factor;
-        }
+        auto chunk = coeffs().subspan(offset, end - offset);
+        field_vec::scale_vec<Fr>(chunk, chunk, scaling_factor);
     });
 
     return *this;
@@ -323,6 +324,14 @@ template <typename Fr> void Polynomial<Fr>::shrink_end_index(const size_t new_en
     coefficients_.end_ = new_end_index;
 }
 
+template <typename Fr> void Polynomial<Fr>::reindex(const size_t new_start_index, const size_t new_end_index)
+{
+    BB_ASSERT_LTE(new_start_index, new_end_index);
+    BB_ASSERT_LTE(new_end_index - new_start_index, size());
+    coefficients_.start_ = new_start_index;
+    coefficients_.end_ = new_end_index;
+}
+
 template <typename Fr> Polynomial<Fr> Polynomial<Fr>::full() const
 {
     Polynomial result = *this;
@@ -341,9 +350,9 @@ template <typename Fr> void Polynomial<Fr>::add_scaled(PolynomialSpan<const Fr>
     parallel_for(num_threads, [&](size_t j) {
         const size_t offset = j * range_per_thread + other.start_index;
         const size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            at(i) += scaling_factor * other[i];
-        }
+        auto chunk = coeffs().subspan(offset - start_index(), end - offset);
+        field_vec::add_scaled_vec<Fr>(
+            chunk, chunk, scaling_factor, other.span.subspan(offset - other.start_index, end - offset));
     });
 }
 
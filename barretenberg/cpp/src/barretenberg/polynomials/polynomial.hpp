@@ -54,6 +54,8 @@ template <typename Fr> struct PolynomialSpan {
         return { start_index + offset, span.subspan(offset, new_length) };
     }
     operator PolynomialSpan<const Fr>() const { return PolynomialSpan<const Fr>(start_index, span); }
+    // Inverts the nonzero values of the span in place, see Fr::parallel_batch_invert.
+    void batch_invert() { Fr::parallel_batch_invert(span); }
 };
 
 /**
@@ -264,6 +266,12 @@ template <typename Fr> class Polynomial {
      */
     Polynomial& operator*=(Fr scaling_factor);
 
+    /**
+     * @brief Replaces every nonzero coefficient by its inverse, zero coefficients are left as is.
+     * @details Multithreaded, see Fr::parallel_batch_invert.
+     */
+    void batch_invert() { Fr::parallel_batch_invert(coeffs()); }
+
     /**
      * @brief Add random values to the coefficients of a polynomial. In practice, this is used for ensuring the
      * commitment and evaluation of a polynomial don't leak information about the coefficients in the context of zero
@@ -326,6 +334,25 @@ template <typename Fr> class Polynomial {
      */
     static Polynomial create_non_parallel_zero_init(size_t size, size_t virtual_size);
 
+    /**
+     * @brief A factory to construct a polynomial over externally provided memory (e.g. a memory-mapped file).
+     * @details No copy is made. The memory must hold at least `size` elements, and its lifetime is managed by the
+     * deleter of `backing_memory`, which runs once the last share of the polynomial is gone.
+     */
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+    static Polynomial from_backing_memory(std::shared_ptr<Fr[]> backing_memory,
+                                          size_t size,
+                                          size_t virtual_size,
+                                          size_t start_index = 0)
+    {
+        BB_ASSERT_LTE(start_index + size, virtual_size);
+        Polynomial p;
+        p.coefficients_ = SharedShiftedVirtualZeroesArray<Fr>{
+            start_index, start_index + size, virtual_size, std::move(backing_memory)
+        };
+        return p;
+    }
+
     /**
      * @brief Expands the polynomial with new start_index and end_index
      * The value of the polynomial remains the same, but defined memory region differs.
@@ -341,6 +368,14 @@ template <typename Fr> class Polynomial {
      */
     void shrink_end_index(const size_t new_end_index);
 
+    /**
+     * @brief Relabels the memory-backed region as [new_start_index, new_end_index) without touching the memory, i.e.
+     * the coefficient stored first is now that of index new_start_index.
+     * @details For in-place algorithms that move the nonzero region towards lower indices, such as a sumcheck fold.
+     * The new region must fit in the memory backing the old one.
+     */
+    void reindex(const size_t new_start_index, const size_t new_end_index);
+
     /**
      * @brief Copys the polynomial, but with the whole address space usable.
      * The value of the polynomial remains the same, but defined memory region differs.
@@ -923,6 +923,79 @@ TYPED_TEST(ScalarMultiplicationTests, PippengerUnsafe)
     EXPECT_EQ(result == expected, true);
 }
 
+TYPED_TEST(ScalarMultiplicationTests, PippengerUnsafeBatchedAffine)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    // Large enough for the batched affine passes to run before falling back to the Jacobian tail.
+    constexpr size_t num_points = 16384;
+
+    std::vector<Fr> scalars(num_points);
+    auto points = scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        scalars[i] = Fr::random_element();
+        points.get()[i] = AffineElement(Element::random_element());
+    }
+    // Repeated scalars put several points in the same buckets.
+    for (size_t i = 0; i < 64; ++i) {
+        scalars[num_points - 1 - i] = scalars[i];
+    }
+    scalar_multiplication::generate_pippenger_point_table<Curve>(points.get(), points.get(), num_points);
+
+    PolynomialSpan<const Fr> scalar_span{ 0, scalars };
+    std::span<const AffineElement> point_span{ points.get(), num_points * 2 };
+
+    scalar_multiplication::pippenger_runtime_state<Curve> state(num_points);
+    state.bucket_accumulation = scalar_multiplication::BucketAccumulation::AdditionChains;
+    Element expected = scalar_multiplication::pippenger_unsafe<Curve>(scalar_span, point_span, state);
+    state.bucket_accumulation = scalar_multiplication::BucketAccumulation::BatchedAffine;
+    Element result = scalar_multiplication::pippenger_unsafe<Curve>(scalar_span, point_span, state);
+
+    EXPECT_EQ(result.normalize(), expected.normalize());
+}
+
+TYPED_TEST(ScalarMultiplicationTests, PippengerSingleThreaded)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    constexpr size_t num_points = 1000;
+
+    std::vector<AffineElement> points(num_points);
+    for (auto& point : points) {
+        point = AffineElement(Element::random_element());
+    }
+    // Repeated points exercise the doubling case of the bucket additions.
+    for (size_t i = 0; i < 8; ++i) {
+        points[num_points - 1 - i] = points[i];
+    }
+    auto point_table = scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+    scalar_multiplication::generate_pippenger_point_table<Curve>(points.data(), point_table.get(), num_points);
+    std::span<const AffineElement> point_span{ point_table.get(), num_points * 2 };
+
+    for (size_t size : { 0UL, 1UL, 7UL, 100UL, 990UL }) {
+        const size_t start_index = 5;
+        std::vector<Fr> scalars(size);
+        for (size_t i = 0; i < size; ++i) {
+            scalars[i] = i % 5 == 1 ? Fr::zero() : Fr::random_element();
+        }
+
+        Element expected;
+        expected.self_set_infinity();
+        for (size_t i = 0; i < size; ++i) {
+            expected += points[start_index + i] * scalars[i];
+        }
+
+        Element result = scalar_multiplication::pippenger_single_threaded<Curve>({ start_index, scalars }, point_span);
+        EXPECT_EQ(result.normalize(), expected.normalize()) << size;
+    }
+}
+
 TYPED_TEST(ScalarMultiplicationTests, PippengerUnsafeShortInputs)
 {
     using Curve = TypeParam;
@@ -222,6 +222,56 @@ TEST(stdlib_plookup, uint32_xor)
     EXPECT_EQ(result, true);
 }
 
+TEST(stdlib_plookup, compute_lookup_accumulators)
+{
+    // The same caller-provided buffers are reused for every lookup
+    const size_t num_lookups = get_multitable(MultiTableId::UINT32_XOR).basic_table_ids.size();
+    std::vector<fr> column_1(num_lookups);
+    std::vector<fr> column_2(num_lookups);
+    std::vector<fr> column_3(num_lookups);
+    std::vector<BasicTable::LookupEntry> lookup_entries(num_lookups);
+
+    for (size_t j = 0; j < 8; ++j) {
+        uint256_t left_value = (engine.get_random_uint256() & 0xffffffffULL);
+        uint256_t right_value = (engine.get_random_uint256() & 0xffffffffULL);
+
+        compute_lookup_accumulators(MultiTableId::UINT32_XOR,
+                                    fr(left_value),
+                                    fr(right_value),
+                                    /*is_2_to_1_lookup=*/true,
+                                    column_1,
+                                    column_2,
+                                    column_3,
+                                    lookup_entries);
+
+        // The first row holds the full values, and each row is its slice plus the next row scaled by the slice base
+        EXPECT_EQ(column_1[0], fr(left_value));
+        EXPECT_EQ(column_2[0], fr(right_value));
+        EXPECT_EQ(column_3[0], fr(left_value ^ right_value));
+        const auto left_slices = numeric::slice_input(left_value, 1 << 6, num_lookups);
+        const auto right_slices = numeric::slice_input(right_value, 1 << 6, num_lookups);
+        for (size_t i = 0; i < num_lookups; ++i) {
+            const fr next_1 = i + 1 < num_lookups ? column_1[i + 1] * (1 << 6) : fr(0);
+            const fr next_2 = i + 1 < num_lookups ? column_2[i + 1] * (1 << 6) : fr(0);
+            const fr next_3 = i + 1 < num_lookups ? column_3[i + 1] * (1 << 6) : fr(0);
+            EXPECT_EQ(column_1[i] - next_1, fr(left_slices[i]));
+            EXPECT_EQ(column_2[i] - next_2, fr(right_slices[i]));
+            EXPECT_EQ(column_3[i] - next_3, fr(left_slices[i] ^ right_slices[i]));
+            EXPECT_EQ(lookup_entries[i].key[0], left_slices[i]);
+            EXPECT_EQ(lookup_entries[i].key[1], right_slices[i]);
+        }
+
+        // The allocating variant agrees
+        const auto lookup = get_lookup_accumulators(MultiTableId::UINT32_XOR, fr(left_value), fr(right_value), true);
+        for (size_t i = 0; i < num_lookups; ++i) {
+            EXPECT_EQ(lookup[ColumnIdx::C1][i], column_1[i]);
+            EXPECT_EQ(lookup[ColumnIdx::C2][i], column_2[i]);
+            EXPECT_EQ(lookup[ColumnIdx::C3][i], column_3[i]);
+            EXPECT_EQ(lookup.lookup_entries[i], lookup_entries[i]);
+        }
+    }
+}
+
 TEST(stdlib_plookup, blake2s_xor_rotate_16)
 {
     Builder builder = Builder();
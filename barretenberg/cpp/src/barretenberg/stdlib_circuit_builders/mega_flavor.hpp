@@ -356,7 +356,7 @@ class MegaFlavor {
         ProverPolynomials(ProverPolynomials&& o) noexcept = default;
         ProverPolynomials& operator=(ProverPolynomials&& o) noexcept = default;
         ~ProverPolynomials() = default;
-        [[nodiscard]] size_t get_polynomial_size() const { return q_c.size(); }
+        [[nodiscard]] size_t get_polynomial_size() const { return q_c.virtual_size(); }
         [[nodiscard]] AllValues get_row(size_t row_idx) const
         {
             PROFILE_THIS_NAME("MegaFlavor::get_row");
@@ -463,7 +463,7 @@ class MegaFlavor {
                 ck = std::make_shared<CommitmentKey>(proving_key.circuit_size);
             }
             for (auto [polynomial, commitment] : zip_view(proving_key.polynomials.get_precomputed(), this->get_all())) {
-                commitment = ck->commit(polynomial);
+                commitment = ck->commit_fixed(polynomial);
             }
         }
 
@@ -70,6 +70,58 @@ TEST_F(PermutationHelperTests, ComputePermutationMapping)
     compute_permutation_mapping<Flavor, /*generalized=*/false>(circuit_constructor, proving_key.get(), {});
 }
 
+TEST_F(PermutationHelperTests, ConstructCopyCycles)
+{
+    // Enough gates for the rows to be split between threads and enough variables for them to be split between buckets
+    constexpr size_t NUM_VARIABLES = 1 << 14;
+    constexpr size_t NUM_GATES = 1 << 13;
+    std::vector<uint32_t> variables;
+    for (size_t i = 0; i < NUM_VARIABLES; ++i) {
+        variables.emplace_back(circuit_constructor.add_variable(FF(i / 2)));
+    }
+    // Merge some of the cycles
+    for (size_t i = 0; i < NUM_VARIABLES; i += 6) {
+        circuit_constructor.assert_equal(variables[i], variables[i + 1]);
+    }
+    for (size_t i = 0; i < NUM_GATES; ++i) {
+        circuit_constructor.create_big_add_gate({ variables[(i * 7919) % NUM_VARIABLES],
+                                                  variables[(i * 104729) % NUM_VARIABLES],
+                                                  variables[i % 64],
+                                                  variables[(3 * i + 1) % NUM_VARIABLES],
+                                                  0,
+                                                  0,
+                                                  0,
+                                                  0,
+                                                  0 });
+    }
+
+    // Collect the cycles by a serial traversal of the trace
+    std::vector<uint32_t> block_offsets;
+    std::vector<std::vector<cycle_node>> expected_cycles(circuit_constructor.variables.size());
+    uint32_t offset = 1;
+    for (auto& block : circuit_constructor.blocks.get()) {
+        block_offsets.emplace_back(offset);
+        for (uint32_t row_idx = 0; row_idx < block.size(); ++row_idx) {
+            for (uint32_t wire_idx = 0; wire_idx < Flavor::NUM_WIRES; ++wire_idx) {
+                uint32_t real_var_idx = circuit_constructor.real_variable_index[block.wires[wire_idx][row_idx]];
+                expected_cycles[real_var_idx].emplace_back(cycle_node{ wire_idx, row_idx + offset });
+            }
+        }
+        offset += static_cast<uint32_t>(block.size());
+    }
+
+    auto copy_cycles = construct_copy_cycles(circuit_constructor, block_offsets);
+    ASSERT_EQ(copy_cycles.size(), expected_cycles.size());
+    for (size_t cycle_idx = 0; cycle_idx < expected_cycles.size(); ++cycle_idx) {
+        auto cycle = copy_cycles[cycle_idx];
+        ASSERT_EQ(cycle.size(), expected_cycles[cycle_idx].size());
+        for (size_t node_idx = 0; node_idx < cycle.size(); ++node_idx) {
+            EXPECT_EQ(cycle[node_idx].wire_idx, expected_cycles[cycle_idx][node_idx].wire_idx);
+            EXPECT_EQ(cycle[node_idx].gate_idx, expected_cycles[cycle_idx][node_idx].gate_idx);
+        }
+    }
+}
+
 TEST_F(PermutationHelperTests, ComputeHonkStyleSigmaLagrangePolynomialsFromMapping)
 {
     // TODO(#425) Flesh out these tests
@@ -19,136 +19,121 @@
 #include "barretenberg/stdlib_circuit_builders/plookup_tables/keccak/keccak_output.hpp"
 #include "barretenberg/stdlib_circuit_builders/plookup_tables/keccak/keccak_rho.hpp"
 #include "barretenberg/stdlib_circuit_builders/plookup_tables/keccak/keccak_theta.hpp"
-#include <mutex>
 namespace bb::plookup {
 
 using namespace bb;
 
 namespace {
-// TODO(@zac-williamson) convert these into static const members of a struct
-// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
-std::array<MultiTable, MultiTableId::NUM_MULTI_TABLES> MULTI_TABLES;
-// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
-bool initialised = false;
-#ifndef NO_MULTITHREADING
-
-// The multitables initialisation procedure is not thread-safe, so we need to make sure only 1 thread gets to initialize
-// them.
-std::mutex multi_table_mutex;
-#endif
-void init_multi_tables()
+/**
+ * @brief Construct all of the MultiTables, indexed by MultiTableId
+ */
+std::array<MultiTable, MultiTableId::NUM_MULTI_TABLES> create_multi_tables()
 {
-#ifndef NO_MULTITHREADING
-    std::unique_lock<std::mutex> lock(multi_table_mutex);
-#endif
-    if (initialised) {
-        return;
-    }
-    MULTI_TABLES[MultiTableId::SHA256_CH_INPUT] = sha256_tables::get_choose_input_table(MultiTableId::SHA256_CH_INPUT);
-    MULTI_TABLES[MultiTableId::SHA256_MAJ_INPUT] =
+    std::array<MultiTable, MultiTableId::NUM_MULTI_TABLES> multi_tables;
+    multi_tables[MultiTableId::SHA256_CH_INPUT] = sha256_tables::get_choose_input_table(MultiTableId::SHA256_CH_INPUT);
+    multi_tables[MultiTableId::SHA256_MAJ_INPUT] =
         sha256_tables::get_majority_input_table(MultiTableId::SHA256_MAJ_INPUT);
-    MULTI_TABLES[MultiTableId::SHA256_WITNESS_INPUT] =
+    multi_tables[MultiTableId::SHA256_WITNESS_INPUT] =
         sha256_tables::get_witness_extension_input_table(MultiTableId::SHA256_WITNESS_INPUT);
-    MULTI_TABLES[MultiTableId::SHA256_CH_OUTPUT] =
+    multi_tables[MultiTableId::SHA256_CH_OUTPUT] =
         sha256_tables::get_choose_output_table(MultiTableId::SHA256_CH_OUTPUT);
-    MULTI_TABLES[MultiTableId::SHA256_MAJ_OUTPUT] =
+    multi_tables[MultiTableId::SHA256_MAJ_OUTPUT] =
         sha256_tables::get_majority_output_table(MultiTableId::SHA256_MAJ_OUTPUT);
-    MULTI_TABLES[MultiTableId::SHA256_WITNESS_OUTPUT] =
+    multi_tables[MultiTableId::SHA256_WITNESS_OUTPUT] =
         sha256_tables::get_witness_extension_output_table(MultiTableId::SHA256_WITNESS_OUTPUT);
-    MULTI_TABLES[MultiTableId::AES_NORMALIZE] = aes128_tables::get_aes_normalization_table(MultiTableId::AES_NORMALIZE);
-    MULTI_TABLES[MultiTableId::AES_INPUT] = aes128_tables::get_aes_input_table(MultiTableId::AES_INPUT);
-    MULTI_TABLES[MultiTableId::AES_SBOX] = aes128_tables::get_aes_sbox_table(MultiTableId::AES_SBOX);
-    MULTI_TABLES[MultiTableId::UINT32_XOR] = uint_tables::get_uint32_xor_table(MultiTableId::UINT32_XOR);
-    MULTI_TABLES[MultiTableId::UINT32_AND] = uint_tables::get_uint32_and_table(MultiTableId::UINT32_AND);
-    MULTI_TABLES[MultiTableId::BN254_XLO] = ecc_generator_tables::ecc_generator_table<bb::g1>::get_xlo_table(
+    multi_tables[MultiTableId::AES_NORMALIZE] = aes128_tables::get_aes_normalization_table(MultiTableId::AES_NORMALIZE);
+    multi_tables[MultiTableId::AES_INPUT] = aes128_tables::get_aes_input_table(MultiTableId::AES_INPUT);
+    multi_tables[MultiTableId::AES_SBOX] = aes128_tables::get_aes_sbox_table(MultiTableId::AES_SBOX);
+    multi_tables[MultiTableId::UINT32_XOR] = uint_tables::get_uint32_xor_table(MultiTableId::UINT32_XOR);
+    multi_tables[MultiTableId::UINT32_AND] = uint_tables::get_uint32_and_table(MultiTableId::UINT32_AND);
+    multi_tables[MultiTableId::BN254_XLO] = ecc_generator_tables::ecc_generator_table<bb::g1>::get_xlo_table(
         MultiTableId::BN254_XLO, BasicTableId::BN254_XLO_BASIC);
-    MULTI_TABLES[MultiTableId::BN254_XHI] = ecc_generator_tables::ecc_generator_table<bb::g1>::get_xhi_table(
+    multi_tables[MultiTableId::BN254_XHI] = ecc_generator_tables::ecc_generator_table<bb::g1>::get_xhi_table(
         MultiTableId::BN254_XHI, BasicTableId::BN254_XHI_BASIC);
-    MULTI_TABLES[MultiTableId::BN254_YLO] = ecc_generator_tables::ecc_generator_table<bb::g1>::get_ylo_table(
+    multi_tables[MultiTableId::BN254_YLO] = ecc_generator_tables::ecc_generator_table<bb::g1>::get_ylo_table(
         MultiTableId::BN254_YLO, BasicTableId::BN254_YLO_BASIC);
-    MULTI_TABLES[MultiTableId::BN254_YHI] = ecc_generator_tables::ecc_generator_table<bb::g1>::get_yhi_table(
+    multi_tables[MultiTableId::BN254_YHI] = ecc_generator_tables::ecc_generator_table<bb::g1>::get_yhi_table(
         MultiTableId::BN254_YHI, BasicTableId::BN254_YHI_BASIC);
-    MULTI_TABLES[MultiTableId::BN254_XYPRIME] = ecc_generator_tables::ecc_generator_table<bb::g1>::get_xyprime_table(
+    multi_tables[MultiTableId::BN254_XYPRIME] = ecc_generator_tables::ecc_generator_table<bb::g1>::get_xyprime_table(
         MultiTableId::BN254_XYPRIME, BasicTableId::BN254_XYPRIME_BASIC);
-    MULTI_TABLES[MultiTableId::BN254_XLO_ENDO] = ecc_generator_tables::ecc_generator_table<bb::g1>::get_xlo_endo_table(
+    multi_tables[MultiTableId::BN254_XLO_ENDO] = ecc_generator_tables::ecc_generator_table<bb::g1>::get_xlo_endo_table(
         MultiTableId::BN254_XLO_ENDO, BasicTableId::BN254_XLO_ENDO_BASIC);
-    MULTI_TABLES[MultiTableId::BN254_XHI_ENDO] = ecc_generator_tables::ecc_generator_table<bb::g1>::get_xhi_endo_table(
+    multi_tables[MultiTableId::BN254_XHI_ENDO] = ecc_generator_tables::ecc_generator_table<bb::g1>::get_xhi_endo_table(
         MultiTableId::BN254_XHI_ENDO, BasicTableId::BN254_XHI_ENDO_BASIC);
-    MULTI_TABLES[MultiTableId::BN254_XYPRIME_ENDO] =
+    multi_tables[MultiTableId::BN254_XYPRIME_ENDO] =
         ecc_generator_tables::ecc_generator_table<bb::g1>::get_xyprime_endo_table(
             MultiTableId::BN254_XYPRIME_ENDO, BasicTableId::BN254_XYPRIME_ENDO_BASIC);
-    MULTI_TABLES[MultiTableId::SECP256K1_XLO] = ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_xlo_table(
+    multi_tables[MultiTableId::SECP256K1_XLO] = ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_xlo_table(
         MultiTableId::SECP256K1_XLO, BasicTableId::SECP256K1_XLO_BASIC);
-    MULTI_TABLES[MultiTableId::SECP256K1_XHI] = ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_xhi_table(
+    multi_tables[MultiTableId::SECP256K1_XHI] = ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_xhi_table(
         MultiTableId::SECP256K1_XHI, BasicTableId::SECP256K1_XHI_BASIC);
-    MULTI_TABLES[MultiTableId::SECP256K1_YLO] = ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_ylo_table(
+    multi_tables[MultiTableId::SECP256K1_YLO] = ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_ylo_table(
         MultiTableId::SECP256K1_YLO, BasicTableId::SECP256K1_YLO_BASIC);
-    MULTI_TABLES[MultiTableId::SECP256K1_YHI] = ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_yhi_table(
+    multi_tables[MultiTableId::SECP256K1_YHI] = ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_yhi_table(
         MultiTableId::SECP256K1_YHI, BasicTableId::SECP256K1_YHI_BASIC);
-    MULTI_TABLES[MultiTableId::SECP256K1_XYPRIME] =
+    multi_tables[MultiTableId::SECP256K1_XYPRIME] =
         ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_xyprime_table(
             MultiTableId::SECP256K1_XYPRIME, BasicTableId::SECP256K1_XYPRIME_BASIC);
-    MULTI_TABLES[MultiTableId::SECP256K1_XLO_ENDO] =
+    multi_tables[MultiTableId::SECP256K1_XLO_ENDO] =
         ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_xlo_endo_table(
             MultiTableId::SECP256K1_XLO_ENDO, BasicTableId::SECP256K1_XLO_ENDO_BASIC);
-    MULTI_TABLES[MultiTableId::SECP256K1_XHI_ENDO] =
+    multi_tables[MultiTableId::SECP256K1_XHI_ENDO] =
         ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_xhi_endo_table(
             MultiTableId::SECP256K1_XHI_ENDO, BasicTableId::SECP256K1_XHI_ENDO_BASIC);
-    MULTI_TABLES[MultiTableId::SECP256K1_XYPRIME_ENDO] =
+    multi_tables[MultiTableId::SECP256K1_XYPRIME_ENDO] =
         ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_xyprime_endo_table(
             MultiTableId::SECP256K1_XYPRIME_ENDO, BasicTableId::SECP256K1_XYPRIME_ENDO_BASIC);
-    MULTI_TABLES[MultiTableId::BLAKE_XOR] = blake2s_tables::get_blake2s_xor_table(MultiTableId::BLAKE_XOR);
-    MULTI_TABLES[MultiTableId::BLAKE_XOR_ROTATE_16] =
+    multi_tables[MultiTableId::BLAKE_XOR] = blake2s_tables::get_blake2s_xor_table(MultiTableId::BLAKE_XOR);
+    multi_tables[MultiTableId::BLAKE_XOR_ROTATE_16] =
         blake2s_tables::get_blake2s_xor_rotate_16_table(MultiTableId::BLAKE_XOR_ROTATE_16);
-    MULTI_TABLES[MultiTableId::BLAKE_XOR_ROTATE_8] =
+    multi_tables[MultiTableId::BLAKE_XOR_ROTATE_8] =
         blake2s_tables::get_blake2s_xor_rotate_8_table(MultiTableId::BLAKE_XOR_ROTATE_8);
-    MULTI_TABLES[MultiTableId::BLAKE_XOR_ROTATE_7] =
+    multi_tables[MultiTableId::BLAKE_XOR_ROTATE_7] =
         blake2s_tables::get_blake2s_xor_rotate_7_table(MultiTableId::BLAKE_XOR_ROTATE_7);
-    MULTI_TABLES[MultiTableId::KECCAK_FORMAT_INPUT] =
+    multi_tables[MultiTableId::KECCAK_FORMAT_INPUT] =
         keccak_tables::KeccakInput::get_keccak_input_table(MultiTableId::KECCAK_FORMAT_INPUT);
-    MULTI_TABLES[MultiTableId::KECCAK_THETA_OUTPUT] =
+    multi_tables[MultiTableId::KECCAK_THETA_OUTPUT] =
         keccak_tables::Theta::get_theta_output_table(MultiTableId::KECCAK_THETA_OUTPUT);
-    MULTI_TABLES[MultiTableId::KECCAK_CHI_OUTPUT] =
+    multi_tables[MultiTableId::KECCAK_CHI_OUTPUT] =
         keccak_tables::Chi::get_chi_output_table(MultiTableId::KECCAK_CHI_OUTPUT);
-    MULTI_TABLES[MultiTableId::KECCAK_FORMAT_OUTPUT] =
+    multi_tables[MultiTableId::KECCAK_FORMAT_OUTPUT] =
         keccak_tables::KeccakOutput::get_keccak_output_table(MultiTableId::KECCAK_FORMAT_OUTPUT);
-    MULTI_TABLES[MultiTableId::FIXED_BASE_LEFT_LO] =
+    multi_tables[MultiTableId::FIXED_BASE_LEFT_LO] =
         fixed_base::table::get_fixed_base_table<0, 128>(MultiTableId::FIXED_BASE_LEFT_LO);
-    MULTI_TABLES[MultiTableId::FIXED_BASE_LEFT_HI] =
+    multi_tables[MultiTableId::FIXED_BASE_LEFT_HI] =
         fixed_base::table::get_fixed_base_table<1, 126>(MultiTableId::FIXED_BASE_LEFT_HI);
-    MULTI_TABLES[MultiTableId::FIXED_BASE_RIGHT_LO] =
+    multi_tables[MultiTableId::FIXED_BASE_RIGHT_LO] =
         fixed_base::table::get_fixed_base_table<2, 128>(MultiTableId::FIXED_BASE_RIGHT_LO);
-    MULTI_TABLES[MultiTableId::FIXED_BASE_RIGHT_HI] =
+    multi_tables[MultiTableId::FIXED_BASE_RIGHT_HI] =
         fixed_base::table::get_fixed_base_table<3, 126>(MultiTableId::FIXED_BASE_RIGHT_HI);
 
     bb::constexpr_for<0, 25, 1>([&]<size_t i>() {
-        MULTI_TABLES[static_cast<size_t>(MultiTableId::KECCAK_NORMALIZE_AND_ROTATE) + i] =
+        multi_tables[static_cast<size_t>(MultiTableId::KECCAK_NORMALIZE_AND_ROTATE) + i] =
             keccak_tables::Rho<8, i>::get_rho_output_table(MultiTableId::KECCAK_NORMALIZE_AND_ROTATE);
     });
-    MULTI_TABLES[MultiTableId::HONK_DUMMY_MULTI] = dummy_tables::get_honk_dummy_multitable();
-    initialised = true;
+    multi_tables[MultiTableId::HONK_DUMMY_MULTI] = dummy_tables::get_honk_dummy_multitable();
+    return multi_tables;
 }
 } // namespace
+
 /**
  * @brief Return the multitable with the provided ID; construct all MultiTables if not constructed already
  * @details The multitables are relatively light objects (they do not themselves store raw table data) so the first time
- * we use one of them we simply construct all of them (regardless of which of them will actually be used) and store in
- * MULTI_TABLES array.
+ * we use one of them we simply construct all of them (regardless of which of them will actually be used). They are
+ * immutable from then on. A function-local static is initialised exactly once even when several threads race to it,
+ * and every later call only checks the initialisation guard, so concurrent circuit construction takes no lock here.
  *
- * @param id The index of a MultiTable in the MULTI_TABLES array
+ * @param id The index of a MultiTable
  * @return const MultiTable&
  */
 const MultiTable& get_multitable(const MultiTableId id)
 {
-    if (!initialised) {
-        init_multi_tables();
-        initialised = true;
-    }
-    return MULTI_TABLES[id];
+    static const std::array<MultiTable, MultiTableId::NUM_MULTI_TABLES> multi_tables = create_multi_tables();
+    return multi_tables[id];
 }
 
 /**
- * @brief Given a table ID and the key(s) for a key-value lookup, return the lookup accumulators
+ * @brief Given a table ID and the key(s) for a key-value lookup, compute the lookup accumulators
  * @details In general the number of bits in original key/value is greater than what can be efficiently supported in
  * lookup tables. For this reason we actually perform lookups on the corresponding limbs. However, since we're
  * interested in the original values and not the limbs, its convenient to structure the witnesses of lookup gates to
@@ -158,46 +143,60 @@ const MultiTable& get_multitable(const MultiTableId id)
  * wire_i - r*wire_{i-1} = v_i, where r = num limb bits and v_i is a limb that explicitly appears in one of the lookup
  * tables. See the detailed comment block below for more explanation.
  *
+ * This variant writes the accumulators, and the lookup entry of each basic table, into spans provided by the caller,
+ * each of size get_multitable(id).basic_table_ids.size(); it performs no allocation.
+ *
  * @param id
  * @param key_a
  * @param key_b
  * @param is_2_to_1_lookup
- * @return ReadData<bb::fr>
+ * @param column_1 Output accumulators of the first column
+ * @param column_2 Output accumulators of the second column
+ * @param column_3 Output accumulators of the third column
+ * @param lookup_entries Output entries of the basic tables
  */
-ReadData<bb::fr> get_lookup_accumulators(const MultiTableId id,
-                                         const fr& key_a,
-                                         const fr& key_b,
-                                         const bool is_2_to_1_lookup)
+void compute_lookup_accumulators(const MultiTableId id,
+                                 const fr& key_a,
+                                 const fr& key_b,
+                                 const bool is_2_to_1_lookup,
+                                 std::span<fr> column_1,
+                                 std::span<fr> column_2,
+                                 std::span<fr> column_3,
+                                 std::span<BasicTable::LookupEntry> lookup_entries)
 {
     // return multi-table, populating global array of all multi-tables if need be
     const auto& multi_table = get_multitable(id);
     const size_t num_lookups = multi_table.basic_table_ids.size();
+    if (column_1.size() != num_lookups || column_2.size() != num_lookups || column_3.size() != num_lookups ||
+        lookup_entries.size() != num_lookups) {
+        throw_or_abort("lookup accumulator outputs do not match the number of basic tables");
+    }
 
-    ReadData<bb::fr> lookup;
-    const auto key_a_slices = numeric::slice_input_using_variable_bases(key_a, multi_table.slice_sizes);
-    const auto key_b_slices = numeric::slice_input_using_variable_bases(key_b, multi_table.slice_sizes);
-
-    std::vector<fr> column_1_raw_values;
-    std::vector<fr> column_2_raw_values;
-    std::vector<fr> column_3_raw_values;
-
+    // Slice the keys by the (variable) bases of the basic tables on the fly, storing the raw column values in the
+    // outputs; they are turned into accumulators in place below
+    uint256_t key_a_remainder(key_a);
+    uint256_t key_b_remainder(key_b);
     for (size_t i = 0; i < num_lookups; ++i) {
+        const uint64_t slice_size = multi_table.slice_sizes[i];
+        if (i == num_lookups - 1 && (key_a_remainder >= slice_size || key_b_remainder >= slice_size)) {
+            throw_or_abort(format("Last key slice greater than ", slice_size));
+        }
+        const uint64_t key_a_slice = (key_a_remainder % slice_size).data[0];
+        const uint64_t key_b_slice = (key_b_remainder % slice_size).data[0];
+        key_a_remainder /= slice_size;
+        key_b_remainder /= slice_size;
+
         // compute the value(s) corresponding to the key(s) using the i-th basic table query function
-        const auto values = multi_table.get_table_values[i]({ key_a_slices[i], key_b_slices[i] });
+        const auto values = multi_table.get_table_values[i]({ key_a_slice, key_b_slice });
         // store all query data in raw columns and key entry
-        column_1_raw_values.emplace_back(key_a_slices[i]);
-        column_2_raw_values.emplace_back(is_2_to_1_lookup ? key_b_slices[i] : values[0]);
-        column_3_raw_values.emplace_back(is_2_to_1_lookup ? values[0] : values[1]);
+        column_1[i] = key_a_slice;
+        column_2[i] = is_2_to_1_lookup ? fr(key_b_slice) : values[0];
+        column_3[i] = is_2_to_1_lookup ? values[0] : values[1];
 
         // Store the lookup entries for use in constructing the sorted table/lookup polynomials later on
-        const BasicTable::LookupEntry lookup_entry{ { key_a_slices[i], key_b_slices[i] }, values };
-        lookup.lookup_entries.emplace_back(lookup_entry);
+        lookup_entries[i] = BasicTable::LookupEntry{ { key_a_slice, key_b_slice }, values };
     }
 
-    lookup[C1].resize(num_lookups);
-    lookup[C2].resize(num_lookups);
-    lookup[C3].resize(num_lookups);
-
     /**
      * A multi-table consists of multiple basic tables (say L = 6).
      *
@@ -237,15 +236,37 @@ ReadData<bb::fr> get_lookup_accumulators(const MultiTableId id,
      * https://app.gitbook.com/o/-LgCgJ8TCO7eGlBr34fj/s/-MEwtqp3H6YhHUTQ_pVJ/plookup-gates-for-ultraplonk/lookup-table-structures
      *
      */
-    lookup[C1][num_lookups - 1] = column_1_raw_values[num_lookups - 1];
-    lookup[C2][num_lookups - 1] = column_2_raw_values[num_lookups - 1];
-    lookup[C3][num_lookups - 1] = column_3_raw_values[num_lookups - 1];
-
     for (size_t i = num_lookups - 1; i > 0; --i) {
-        lookup[C1][i - 1] = column_1_raw_values[i - 1] + lookup[C1][i] * multi_table.column_1_step_sizes[i];
-        lookup[C2][i - 1] = column_2_raw_values[i - 1] + lookup[C2][i] * multi_table.column_2_step_sizes[i];
-        lookup[C3][i - 1] = column_3_raw_values[i - 1] + lookup[C3][i] * multi_table.column_3_step_sizes[i];
+        column_1[i - 1] += column_1[i] * multi_table.column_1_step_sizes[i];
+        column_2[i - 1] += column_2[i] * multi_table.column_2_step_sizes[i];
+        column_3[i - 1] += column_3[i] * multi_table.column_3_step_sizes[i];
     }
+}
+
+/**
+ * @brief Given a table ID and the key(s) for a key-value lookup, return the lookup accumulators
+ * @details See compute_lookup_accumulators, into whose output this allocates the storage.
+ *
+ * @param id
+ * @param key_a
+ * @param key_b
+ * @param is_2_to_1_lookup
+ * @return ReadData<bb::fr>
+ */
+ReadData<bb::fr> get_lookup_accumulators(const MultiTableId id,
+                                         const fr& key_a,
+                                         const fr& key_b,
+                                         const bool is_2_to_1_lookup)
+{
+    const size_t num_lookups = get_multitable(id).basic_table_ids.size();
+
+    ReadData<bb::fr> lookup;
+    lookup[C1].resize(num_lookups);
+    lookup[C2].resize(num_lookups);
+    lookup[C3].resize(num_lookups);
+    lookup.lookup_entries.resize(num_lookups);
+    compute_lookup_accumulators(
+        id, key_a, key_b, is_2_to_1_lookup, lookup[C1], lookup[C2], lookup[C3], lookup.lookup_entries);
     return lookup;
 }
 
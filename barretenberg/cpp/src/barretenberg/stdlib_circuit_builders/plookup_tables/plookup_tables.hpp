@@ -8,10 +8,21 @@
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/stdlib_circuit_builders/plookup_tables/types.hpp"
 
+#include <span>
+
 namespace bb::plookup {
 
 const MultiTable& get_multitable(MultiTableId id);
 
+void compute_lookup_accumulators(MultiTableId id,
+                                 const bb::fr& key_a,
+                                 const bb::fr& key_b,
+                                 bool is_2_to_1_lookup,
+                                 std::span<bb::fr> column_1,
+                                 std::span<bb::fr> column_2,
+                                 std::span<bb::fr> column_3,
+                                 std::span<BasicTable::LookupEntry> lookup_entries);
+
 ReadData<bb::fr> get_lookup_accumulators(MultiTableId id,
                                          const bb::fr& key_a,
                                          const bb::fr& key_b = 0,
@@ -289,7 +289,7 @@ class UltraFlavor {
         ProverPolynomials(ProverPolynomials&& o) noexcept = default;
         ProverPolynomials& operator=(ProverPolynomials&& o) noexcept = default;
         ~ProverPolynomials() = default;
-        [[nodiscard]] size_t get_polynomial_size() const { return q_c.size(); }
+        [[nodiscard]] size_t get_polynomial_size() const { return q_c.virtual_size(); }
         [[nodiscard]] AllValues get_row(const size_t row_idx) const
         {
             PROFILE_THIS_NAME("UltraFlavor::get_row");
@@ -376,7 +376,7 @@ class UltraFlavor {
                 proving_key.commitment_key = std::make_shared<CommitmentKey>(proving_key.circuit_size);
             }
             for (auto [polynomial, commitment] : zip_view(proving_key.polynomials.get_precomputed(), this->get_all())) {
-                commitment = proving_key.commitment_key->commit(polynomial);
+                commitment = proving_key.commitment_key->commit_fixed(polynomial);
             }
         }
         // TODO(https://github.com/AztecProtocol/barretenberg/issues/964): Clean the boilerplate
@@ -168,6 +168,127 @@ template <typename Flavor> class SumcheckTests : public ::testing::Test {
     }
 
     // TODO(#225): make the inputs to this test more interesting, e.g. non-trivial permutations
+    void test_fused_rounds()
+    {
+        const size_t multivariate_d(10);
+        const size_t multivariate_n(1 << multivariate_d);
+
+        // Include structured polynomials shorter than the circuit, of both parities, to exercise the virtual zeroes.
+        std::vector<bb::Polynomial<FF>> random_polynomials(NUM_POLYNOMIALS);
+        for (size_t idx = 0; idx < NUM_POLYNOMIALS; ++idx) {
+            const std::array<size_t, 4> sizes{ multivariate_n, multivariate_n / 2 + 3, 5, 130 };
+            random_polynomials[idx] = bb::Polynomial<FF>(sizes[idx % sizes.size()], multivariate_n);
+            for (auto& coeff : random_polynomials[idx].coeffs()) {
+                coeff = FF::random_element();
+            }
+        }
+        auto full_polynomials = construct_ultra_full_polynomials(random_polynomials);
+
+        auto prove = [&](bool fuse_rounds) {
+            auto transcript = Flavor::Transcript::prover_init_empty();
+            auto sumcheck = SumcheckProver<Flavor>(multivariate_n, transcript);
+            sumcheck.fuse_rounds = fuse_rounds;
+            RelationSeparator alpha;
+            for (size_t idx = 0; idx < alpha.size(); idx++) {
+                alpha[idx] = transcript->template get_challenge<FF>("Sumcheck:alpha_" + std::to_string(idx));
+            }
+            std::vector<FF> gate_challenges(multivariate_d);
+            for (size_t idx = 0; idx < multivariate_d; idx++) {
+                gate_challenges[idx] =
+                    transcript->template get_challenge<FF>("Sumcheck:gate_challenge_" + std::to_string(idx));
+            }
+            auto output = sumcheck.prove(full_polynomials, {}, alpha, gate_challenges);
+            EXPECT_EQ(sumcheck.round_bytes_moved.size(), multivariate_d);
+            return std::pair{ output, transcript->export_proof() };
+        };
+        auto [fused_output, fused_proof] = prove(true);
+        auto [unfused_output, unfused_proof] = prove(false);
+
+        // The transcripts hash every round univariate, so equal challenges mean equal univariates.
+        EXPECT_EQ(fused_output.challenge, unfused_output.challenge);
+        EXPECT_EQ(fused_proof, unfused_proof);
+        for (auto [fused_eval, unfused_eval] :
+             zip_view(fused_output.claimed_evaluations.get_all(), unfused_output.claimed_evaluations.get_all())) {
+            EXPECT_EQ(fused_eval, unfused_eval);
+        }
+    }
+
+    void test_lazy_partial_evaluation()
+    {
+        const size_t multivariate_d(10);
+        const size_t multivariate_n(1 << multivariate_d);
+
+        // Polynomials with offset memory regions, zero prefixes and suffixes inside them, and no nonzero at all.
+        std::vector<bb::Polynomial<FF>> random_polynomials(NUM_POLYNOMIALS);
+        for (size_t idx = 0; idx < NUM_POLYNOMIALS; ++idx) {
+            auto& poly = random_polynomials[idx];
+            switch (idx % 5) {
+            case 0:
+                poly = random_poly(multivariate_n);
+                break;
+            case 1:
+                poly = bb::Polynomial<FF>(multivariate_n / 2 + 3, multivariate_n, /*start_index=*/7);
+                break;
+            case 2:
+                poly = bb::Polynomial<FF>(multivariate_n, multivariate_n);
+                poly.at(301) = FF::random_element();
+                poly.at(302) = FF::random_element();
+                break;
+            case 3:
+                poly = bb::Polynomial<FF>(multivariate_n, multivariate_n);
+                break;
+            default:
+                poly = bb::Polynomial<FF>(131, multivariate_n, /*start_index=*/multivariate_n - 131);
+                break;
+            }
+            if (idx % 5 == 1 || idx % 5 == 4) {
+                for (auto& coeff : poly.coeffs()) {
+                    coeff = FF::random_element();
+                }
+            }
+        }
+        auto full_polynomials = construct_ultra_full_polynomials(random_polynomials);
+
+        auto prove = [&](bool lazy_partial_evaluation) {
+            auto transcript = Flavor::Transcript::prover_init_empty();
+            auto sumcheck = SumcheckProver<Flavor>(multivariate_n, transcript);
+            sumcheck.lazy_partial_evaluation = lazy_partial_evaluation;
+            RelationSeparator alpha;
+            for (size_t idx = 0; idx < alpha.size(); idx++) {
+                alpha[idx] = transcript->template get_challenge<FF>("Sumcheck:alpha_" + std::to_string(idx));
+            }
+            std::vector<FF> gate_challenges(multivariate_d);
+            for (size_t idx = 0; idx < multivariate_d; idx++) {
+                gate_challenges[idx] =
+                    transcript->template get_challenge<FF>("Sumcheck:gate_challenge_" + std::to_string(idx));
+            }
+            SumcheckOutput<Flavor> output;
+            if constexpr (Flavor::HasZK) {
+                ZKData zk_sumcheck_data = ZKData(multivariate_d, transcript);
+                output = sumcheck.prove(full_polynomials, {}, alpha, gate_challenges, zk_sumcheck_data);
+            } else {
+                output = sumcheck.prove(full_polynomials, {}, alpha, gate_challenges);
+            }
+            EXPECT_EQ(sumcheck.round_table_bytes.size(), multivariate_d);
+
+            std::vector<FF> u_challenge(output.challenge.begin(), output.challenge.begin() + multivariate_d);
+            for (auto [full_poly, claimed_eval] :
+                 zip_view(full_polynomials.get_all(), output.claimed_evaluations.get_all())) {
+                EXPECT_EQ(full_poly.full().evaluate_mle(u_challenge), claimed_eval);
+            }
+            return std::tuple{ output, transcript->export_proof(), sumcheck.round_table_bytes.front() };
+        };
+        auto [lazy_output, lazy_proof, lazy_table_bytes] = prove(true);
+        auto [default_output, default_proof, default_table_bytes] = prove(false);
+
+        EXPECT_LT(lazy_table_bytes, default_table_bytes);
+        // The Libra masking polynomials are random, hence only proofs without ZK can be compared
+        if constexpr (!Flavor::HasZK) {
+            EXPECT_EQ(lazy_output.challenge, default_output.challenge);
+            EXPECT_EQ(lazy_proof, default_proof);
+        }
+    }
+
     void test_prover_verifier_flow()
     {
         const size_t multivariate_d(3);
@@ -410,6 +531,20 @@ TYPED_TEST(SumcheckTests, Prover)
 {
     this->test_prover();
 }
+// Fusing the partial evaluation with the next round univariate does not change the proof
+TYPED_TEST(SumcheckTests, FusedRounds)
+{
+    if constexpr (!TypeParam::HasZK) {
+        this->test_fused_rounds();
+    } else {
+        GTEST_SKIP() << "Rounds are not fused for ZK-enabled flavors";
+    }
+}
+// Allocating the book-keeping table lazily to the nonzero range of each polynomial does not change the proof
+TYPED_TEST(SumcheckTests, LazyPartialEvaluation)
+{
+    this->test_lazy_partial_evaluation();
+}
 // Tests the prover-verifier flow
 TYPED_TEST(SumcheckTests, ProverAndVerifierSimple)
 {
@@ -277,6 +277,134 @@ template <typename Flavor> class SumcheckProverRound {
         return batch_over_relations<SumcheckRoundUnivariate>(univariate_accumulators, alpha, gate_separators);
     }
 
+    /**
+     * @brief Rows folded at once by fold_and_compute_univariate before their edges are accumulated. The folded rows of
+     * all prover polynomials (~100 polynomials x 64 rows x 32 bytes) stay in L2.
+     */
+    static constexpr size_t FOLD_BLOCK_SIZE = 64;
+
+    /**
+     * @brief Version of extend_edges for a table being folded in place: rows past the folded end of a polynomial still
+     * hold values of the previous round, and must be read as zeroes.
+     */
+    void extend_folded_edges(ExtendedEdges& extended_edges,
+                             const auto& folded_polys,
+                             const std::vector<size_t>& folded_ends,
+                             const size_t edge_idx)
+    {
+        auto extended = extended_edges.get_all();
+        for (size_t j = 0; j < folded_ends.size(); ++j) {
+            if (folded_ends[j] <= edge_idx) {
+                static const auto zero_univariate = std::remove_cvref_t<decltype(extended[j])>::zero();
+                extended[j] = zero_univariate;
+                continue;
+            }
+            const auto& poly = folded_polys[j];
+            const FF next = edge_idx + 1 < folded_ends[j] ? poly.at(edge_idx + 1) : FF(0);
+            bb::Univariate<FF, 2> edge({ poly.at(edge_idx), next });
+            if constexpr (Flavor::USE_SHORT_MONOMIALS) {
+                extended[j] = edge;
+            } else {
+                extended[j] = edge.template extend_to<MAX_PARTIAL_RELATION_LENGTH>();
+            }
+        }
+    }
+
+    /**
+     * @brief Non-ZK version: partially evaluate the book-keeping table at the round challenge and compute the
+     * univariate of the next round from the freshly folded rows, in a single pass over memory.
+     * @details Equivalent to partially evaluating \p source into \p folded and calling compute_univariate(folded, ...),
+     * but every row is read once and its contribution is accumulated while it is still in cache, instead of streaming
+     * all prover polynomials through memory twice per round. Must be called with #round_size already halved, i.e.
+     * equal to the size of the folded table, and with \p gate_separators already partially evaluated at the challenge.
+     *
+     * Rows are folded by blocks of FOLD_BLOCK_SIZE, polynomial by polynomial, and the edges of each block are
+     * accumulated right after, reading the folded rows from cache.
+     *
+     * Folded row r is computed from source rows 2r and 2r + 1. When folding in place (\p source is \p folded), output
+     * rows are therefore processed in waves [B 2^{k-1}, B 2^k), whose inputs [B 2^k, B 2^{k+1}) are disjoint from the
+     * outputs of the same wave, so the threads of a wave never race. The first wave [0, B) overlaps its own inputs; it
+     * is processed by a single thread in increasing order, like the unfused partial evaluation.
+     */
+    template <typename SourcePolynomials, typename PartiallyEvaluatedMultivariates>
+    SumcheckRoundUnivariate fold_and_compute_univariate(const SourcePolynomials& source,
+                                                        PartiallyEvaluatedMultivariates& folded,
+                                                        const FF& round_challenge,
+                                                        const bb::RelationParameters<FF>& relation_parameters,
+                                                        const bb::GateSeparatorPolynomial<FF>& gate_separators,
+                                                        const RelationSeparator alpha)
+    {
+        PROFILE_THIS_NAME("fold_and_compute_univariate");
+
+        auto source_polys = source.get_all();
+        auto folded_polys = folded.get_all();
+        const size_t num_polys = folded_polys.size();
+        // The folded polynomials are CEIL(end/2) long, as in the unfused partial evaluation
+        std::vector<size_t> folded_ends(num_polys);
+        for (size_t j = 0; j < num_polys; ++j) {
+            const size_t source_end = source_polys[j].end_index();
+            folded_ends[j] = source_end / 2 + source_end % 2;
+        }
+
+        // Folds the rows [start, end) of the next round table, one polynomial after the other so that reads and writes
+        // are sequential, then accumulates the edges of these rows while they are in cache.
+        const auto process_edges = [&](SumcheckTupleOfTuplesOfUnivariates& accumulators, size_t start, size_t end) {
+            ExtendedEdges extended_edges;
+            for (size_t block_start = start; block_start < end; block_start += FOLD_BLOCK_SIZE) {
+                const size_t block_end = std::min(end, block_start + FOLD_BLOCK_SIZE);
+                for (size_t j = 0; j < num_polys; ++j) {
+                    const auto& poly = source_polys[j];
+                    for (size_t row = block_start; row < std::min(block_end, folded_ends[j]); ++row) {
+                        folded_polys[j].at(row) = poly[2 * row] + round_challenge * (poly[2 * row + 1] - poly[2 * row]);
+                    }
+                }
+                for (size_t edge_idx = block_start; edge_idx < block_end; edge_idx += 2) {
+                    extend_folded_edges(extended_edges, folded_polys, folded_ends, edge_idx);
+                    accumulate_relation_univariates(accumulators,
+                                                    extended_edges,
+                                                    relation_parameters,
+                                                    gate_separators[(edge_idx >> 1) * gate_separators.periodicity]);
+                }
+            }
+        };
+
+        const size_t min_iterations_per_thread = 1 << 6;
+        const size_t max_num_threads = bb::calculate_num_threads_pow2(round_size, min_iterations_per_thread);
+        std::vector<SumcheckTupleOfTuplesOfUnivariates> thread_univariate_accumulators(max_num_threads);
+        for (auto& accumulators : thread_univariate_accumulators) {
+            Utils::zero_univariates(accumulators);
+        }
+
+        bool in_place = false;
+        if constexpr (std::is_same_v<SourcePolynomials, PartiallyEvaluatedMultivariates>) {
+            in_place = &source == &folded;
+        }
+        // Rows processed by a single thread before the multithreaded waves
+        const size_t first_wave_size = in_place ? std::min(round_size, max_num_threads * min_iterations_per_thread) : 0;
+        process_edges(thread_univariate_accumulators[0], 0, first_wave_size);
+        for (size_t wave_start = first_wave_size; wave_start < round_size;) {
+            const size_t wave_end = in_place ? std::min(round_size, 2 * wave_start) : round_size;
+            const size_t wave_size = wave_end - wave_start;
+            const size_t num_threads = bb::calculate_num_threads_pow2(wave_size, min_iterations_per_thread);
+            const size_t iterations_per_thread = wave_size / num_threads;
+            parallel_for(num_threads, [&](size_t thread_idx) {
+                const size_t start = wave_start + thread_idx * iterations_per_thread;
+                const size_t end = (thread_idx + 1 == num_threads) ? wave_end : start + iterations_per_thread;
+                process_edges(thread_univariate_accumulators[thread_idx], start, end);
+            });
+            wave_start = wave_end;
+        }
+        for (auto [folded_poly, end] : zip_view(folded_polys, folded_ends)) {
+            folded_poly.shrink_end_index(end);
+        }
+
+        // Accumulate the per-thread univariate accumulators into a single set of accumulators
+        for (auto& accumulators : thread_univariate_accumulators) {
+            Utils::add_nested_tuples(univariate_accumulators, accumulators);
+        }
+        return batch_over_relations<SumcheckRoundUnivariate>(univariate_accumulators, alpha, gate_separators);
+    }
+
     /**
      * @brief ZK-version of `compute_univariate` that runs Sumcheck with disabled rows and masking of Round Univariates.
      * The masking is ensured by adding random Libra univariates to the Sumcheck round univariates.
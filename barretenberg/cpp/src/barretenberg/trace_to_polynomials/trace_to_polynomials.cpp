@@ -19,14 +19,15 @@ namespace bb {
 template <class Flavor>
 void TraceToPolynomials<Flavor>::populate(Builder& builder,
                                           typename Flavor::ProvingKey& proving_key,
-                                          bool is_structured)
+                                          bool is_structured,
+                                          bool release_builder_selectors)
 {
 
     PROFILE_THIS_NAME("trace populate");
 
     // Share wire polynomials, selector polynomials between proving key and builder and copy cycles from raw circuit
     // data
-    auto trace_data = construct_trace_data(builder, proving_key, is_structured);
+    auto trace_data = construct_trace_data(builder, proving_key, is_structured, release_builder_selectors);
 
     if constexpr (IsUltraFlavor<Flavor>) {
         proving_key.pub_inputs_offset = trace_data.pub_inputs_offset;
@@ -75,7 +76,7 @@ void TraceToPolynomials<Flavor>::add_memory_records_to_proving_key(TraceData& tr
 
 template <class Flavor>
 typename TraceToPolynomials<Flavor>::TraceData TraceToPolynomials<Flavor>::construct_trace_data(
-    Builder& builder, typename Flavor::ProvingKey& proving_key, bool is_structured)
+    Builder& builder, typename Flavor::ProvingKey& proving_key, bool is_structured, bool release_builder_selectors)
 {
 
     PROFILE_THIS_NAME("construct_trace_data");
@@ -83,9 +84,11 @@ typename TraceToPolynomials<Flavor>::TraceData TraceToPolynomials<Flavor>::const
     TraceData trace_data{ builder, proving_key };
 
     uint32_t offset = Flavor::has_zero_row ? 1 : 0; // Offset at which to place each block in the trace polynomials
-    // For each block in the trace, populate wire polys, copy cycles and selector polys
+    std::vector<uint32_t> block_offsets;
+    // For each block in the trace, populate wire polys and selector polys
 
     for (auto& block : builder.blocks.get()) {
+        block_offsets.push_back(offset);
         auto block_size = static_cast<uint32_t>(block.size());
 
         // Save ranges over which the blocks are "active" for use in structured commitments
@@ -96,23 +99,24 @@ typename TraceToPolynomials<Flavor>::TraceData TraceToPolynomials<Flavor>::const
             }
         }
 
-        // Update wire polynomials and copy cycles
-        // NB: The order of row/column loops is arbitrary but needs to be row/column to match old copy_cycle code
+        // Update wire polynomials
         {
 
-            PROFILE_THIS_NAME("populating wires and copy_cycles");
-
-            for (uint32_t block_row_idx = 0; block_row_idx < block_size; ++block_row_idx) {
-                for (uint32_t wire_idx = 0; wire_idx < NUM_WIRES; ++wire_idx) {
-                    uint32_t var_idx = block.wires[wire_idx][block_row_idx]; // an index into the variables array
-                    uint32_t real_var_idx = builder.real_variable_index[var_idx];
-                    uint32_t trace_row_idx = block_row_idx + offset;
-                    // Insert the real witness values from this block into the wire polys at the correct offset
-                    trace_data.wires[wire_idx].at(trace_row_idx) = builder.get_variable(var_idx);
-                    // Add the address of the witness value to its corresponding copy cycle
-                    trace_data.copy_cycles[real_var_idx].emplace_back(cycle_node{ wire_idx, trace_row_idx });
-                }
-            }
+            PROFILE_THIS_NAME("populating wires");
+
+            parallel_for_range(
+                block_size,
+                [&](size_t start, size_t end) {
+                    for (size_t block_row_idx = start; block_row_idx < end; ++block_row_idx) {
+                        for (uint32_t wire_idx = 0; wire_idx < NUM_WIRES; ++wire_idx) {
+                            uint32_t var_idx = block.wires[wire_idx][block_row_idx]; // an index into the variables
+                            size_t trace_row_idx = block_row_idx + offset;
+                            // Insert the real witness values from this block into the wire polys at the correct offset
+                            trace_data.wires[wire_idx].at(trace_row_idx) = builder.get_variable(var_idx);
+                        }
+                    }
+                },
+                /*no_multhreading_if_less_or_equal=*/1 << 10);
         }
 
         // Insert the selector values for this block into the selector polynomials at the correct offset
@@ -123,6 +127,10 @@ typename TraceToPolynomials<Flavor>::TraceData TraceToPolynomials<Flavor>::const
                 size_t trace_row_idx = row_idx + offset;
                 trace_data.selectors[selector_idx].set_if_valid_index(trace_row_idx, selector[row_idx]);
             }
+            // Only one block of builder selectors is then resident alongside the selector polynomials
+            if (release_builder_selectors) {
+                std::decay_t<decltype(selector)>().swap(selector);
+            }
         }
 
         // Store the offset of the block containing RAM/ROM read/write gates for use in updating memory records
@@ -139,6 +147,14 @@ typename TraceToPolynomials<Flavor>::TraceData TraceToPolynomials<Flavor>::const
         offset += block.get_fixed_size(is_structured);
     }
 
+    // Collect the addresses of the witness values of each variable into its copy cycle
+    {
+
+        PROFILE_THIS_NAME("populating copy_cycles");
+
+        trace_data.copy_cycles = construct_copy_cycles(builder, block_offsets);
+    }
+
     return trace_data;
 }
 
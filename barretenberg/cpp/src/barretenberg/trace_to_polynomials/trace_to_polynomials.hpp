@@ -27,8 +27,8 @@ template <class Flavor> class TraceToPolynomials {
     struct TraceData {
         std::array<Polynomial, NUM_WIRES> wires;
         std::array<Polynomial, NUM_SELECTORS> selectors;
-        // A vector of sets (vectors) of addresses into the wire polynomials whose values are copy constrained
-        std::vector<CyclicPermutation> copy_cycles;
+        // Sets of addresses into the wire polynomials whose values are copy constrained, one per variable
+        CopyCycles copy_cycles;
         uint32_t ram_rom_offset = 0;    // offset of the RAM/ROM block in the execution trace
         uint32_t pub_inputs_offset = 0; // offset of the public inputs block in the execution trace
 
@@ -63,11 +63,6 @@ template <class Flavor> class TraceToPolynomials {
                     }
                 }
             }
-            {
-                PROFILE_THIS_NAME("copy cycle initialization");
-
-                copy_cycles.resize(builder.variables.size());
-            }
         }
     };
 
@@ -81,8 +76,12 @@ template <class Flavor> class TraceToPolynomials {
      *
      * @param builder
      * @param is_structured whether or not the trace is to be structured with a fixed block size
+     * @param release_builder_selectors whether to free the builder's selectors block by block once they are copied
      */
-    static void populate(Builder& builder, ProvingKey&, bool is_structured = false);
+    static void populate(Builder& builder,
+                         ProvingKey&,
+                         bool is_structured = false,
+                         bool release_builder_selectors = false);
 
   private:
     /**
@@ -108,11 +107,13 @@ template <class Flavor> class TraceToPolynomials {
      * @param builder
      * @param dyadic_circuit_size
      * @param is_structured whether or not the trace is to be structured with a fixed block size
+     * @param release_builder_selectors whether to free the builder's selectors block by block once they are copied
      * @return TraceData
      */
     static TraceData construct_trace_data(Builder& builder,
                                           typename Flavor::ProvingKey& proving_key,
-                                          bool is_structured = false);
+                                          bool is_structured = false,
+                                          bool release_builder_selectors = false);
 
     /**
      * @brief Construct and add the goblin ecc op wires to the proving key
@@ -90,9 +90,13 @@ template <IsUltraFlavor Flavor> void DeciderProvingKey_<Flavor>::allocate_select
         }
     }
 
-    // Set the other non-gate selector polynomials (e.g. q_l, q_r, q_m etc.) to full size
+    // The other non-gate selector polynomials (e.g. q_l, q_r, q_m etc.) are used by every block, so they are defined
+    // from row num_zero_rows, right after the zero rows, to the end of the last block (the overflow block). With a
+    // structured trace this extent only depends on the structure, so it agrees between the keys being folded.
+    const size_t trace_end =
+        circuit.blocks.overflow.trace_offset + circuit.blocks.overflow.get_fixed_size(is_structured);
     for (auto& selector : proving_key.polynomials.get_non_gate_selectors()) {
-        selector = Polynomial(proving_key.circuit_size);
+        selector = Polynomial(trace_end - num_zero_rows, proving_key.circuit_size, num_zero_rows);
     }
 }
 
@@ -133,7 +133,7 @@ template <IsUltraFlavor Flavor> class DeciderProvingKey_ {
 
         // Construct and add to proving key the wire, selector and copy constraint polynomials
         vinfo("populating trace...");
-        Trace::populate(circuit, proving_key, is_structured);
+        Trace::populate(circuit, proving_key, is_structured, trace_settings.release_builder_selectors);
 
         {
             PROFILE_THIS_NAME("constructing prover instance after trace populate");
@@ -160,6 +160,49 @@ TYPED_TEST(MegaHonkTests, BasicStructured)
     EXPECT_TRUE(verifier.verify_proof(proof));
 }
 
+/**
+ * @brief Test that releasing the builder selectors during proving key construction yields the same polynomials and a
+ * valid proof, leaving the block sizes intact
+ *
+ */
+TYPED_TEST(MegaHonkTests, ReleaseBuilderSelectors)
+{
+    using Flavor = TypeParam;
+    if constexpr (std::is_same_v<Flavor, MegaZKFlavor>) {
+        GTEST_SKIP() << "Skipping 'ReleaseBuilderSelectors' test for MegaZKFlavor (structured trace).";
+    }
+    using Prover = UltraProver_<Flavor>;
+    using Verifier = UltraVerifier_<Flavor>;
+
+    typename Flavor::CircuitBuilder builder;
+    GoblinMockCircuits::construct_simple_circuit(builder);
+    // Finalization appends to the op queue, so the copy needs its own
+    auto builder_copy = builder;
+    builder_copy.op_queue = std::make_shared<ECCOpQueue>(*builder.op_queue);
+
+    TraceSettings trace_settings{ SMALL_TEST_STRUCTURE };
+    auto expected_key = std::make_shared<DeciderProvingKey_<Flavor>>(builder_copy, trace_settings);
+    trace_settings.release_builder_selectors = true;
+    auto proving_key = std::make_shared<DeciderProvingKey_<Flavor>>(builder, trace_settings);
+
+    for (auto [poly, expected_poly] :
+         zip_view(proving_key->proving_key.polynomials.get_all(), expected_key->proving_key.polynomials.get_all())) {
+        EXPECT_EQ(poly, expected_poly);
+    }
+    for (auto [block, expected_block] : zip_view(builder.blocks.get(), builder_copy.blocks.get())) {
+        EXPECT_EQ(block.size(), expected_block.size());
+        for (auto& selector : block.selectors) {
+            EXPECT_EQ(selector.capacity(), 0);
+        }
+    }
+
+    Prover prover(proving_key);
+    auto verification_key = std::make_shared<typename Flavor::VerificationKey>(proving_key->proving_key);
+    Verifier verifier(verification_key);
+    auto proof = prover.construct_proof();
+    EXPECT_TRUE(verifier.verify_proof(proof));
+}
+
 /**
  * @brief Test that increasing the virtual size of a valid set of prover polynomials still results in a valid Megahonk
  * proof
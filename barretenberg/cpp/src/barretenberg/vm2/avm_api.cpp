@@ -1,5 +1,9 @@
 #include "barretenberg/vm2/avm_api.hpp"
 
+#include <cstdlib>
+#include <optional>
+
+#include "barretenberg/vm2/constraining/precomputed_snapshot.hpp"
 #include "barretenberg/vm2/proving_helper.hpp"
 #include "barretenberg/vm2/simulation_helper.hpp"
 #include "barretenberg/vm2/tooling/stats.hpp"
@@ -9,8 +13,28 @@ namespace bb::avm2 {
 
 using namespace bb::avm2::simulation;
 
+namespace {
+
+// If AVM_PRECOMPUTED_SNAPSHOT is set, the precomputed columns and their commitments are loaded from that file,
+// which is generated on first use.
+std::optional<constraining::PrecomputedSnapshot> load_precomputed_snapshot()
+{
+    const char* path = std::getenv("AVM_PRECOMPUTED_SNAPSHOT");
+    if (path == nullptr) {
+        return std::nullopt;
+    }
+    info("Loading precomputed snapshot from ", path, "...");
+    return AVM_TRACK_TIME_V("snapshot/load", constraining::PrecomputedSnapshot::load_or_generate(path));
+}
+
+} // namespace
+
 std::pair<AvmAPI::AvmProof, AvmAPI::AvmVerificationKey> AvmAPI::prove(const AvmAPI::ProvingInputs& inputs)
 {
+    // Must outlive the trace and the proving key.
+    const auto precomputed_snapshot = load_precomputed_snapshot();
+    const auto* snapshot_ptr = precomputed_snapshot.has_value() ? &*precomputed_snapshot : nullptr;
+
     // Simulate.
     info("Simulating...");
     AvmSimulationHelper simulation_helper(inputs.hints);
@@ -19,12 +43,12 @@ std::pair<AvmAPI::AvmProof, AvmAPI::AvmVerificationKey> AvmAPI::prove(const AvmA
     // Generate trace.
     info("Generating trace...");
     AvmTraceGenHelper tracegen_helper;
-    auto trace = AVM_TRACK_TIME_V("tracegen/all", tracegen_helper.generate_trace(std::move(events)));
+    auto trace = AVM_TRACK_TIME_V("tracegen/all", tracegen_helper.generate_trace(std::move(events), snapshot_ptr));
 
     // Prove.
     info("Proving...");
     AvmProvingHelper proving_helper;
-    auto [proof, vk] = AVM_TRACK_TIME_V("proving/all", proving_helper.prove(std::move(trace)));
+    auto [proof, vk] = AVM_TRACK_TIME_V("proving/all", proving_helper.prove(std::move(trace), snapshot_ptr));
 
     info("Done!");
     return { std::move(proof), std::move(vk) };
@@ -48,6 +72,20 @@ bool AvmAPI::check_circuit(const AvmAPI::ProvingInputs& inputs)
     return proving_helper.check_circuit(std::move(trace));
 }
 
+void AvmAPI::simulate(const ExecutionHints& hints)
+{
+    info("Simulating (fast)...");
+    AvmSimulationHelper simulation_helper(hints);
+    AVM_TRACK_TIME("simulation/fast", simulation_helper.simulate_fast());
+}
+
+std::vector<TxSimulationResult> AvmAPI::simulate_block(std::span<const ExecutionHints> txs_hints)
+{
+    info("Simulating block of ", txs_hints.size(), " transactions (fast)...");
+    AvmBlockSimulationHelper simulation_helper(txs_hints);
+    return AVM_TRACK_TIME_V("simulation/block", simulation_helper.simulate_fast());
+}
+
 bool AvmAPI::verify(const AvmProof& proof, const PublicInputs& pi, const AvmVerificationKey& vk_data)
 {
     info("Verifying...");
@@ -1,9 +1,12 @@
 #pragma once
 
+#include <span>
 #include <tuple>
+#include <vector>
 
 #include "barretenberg/vm2/common/avm_inputs.hpp"
 #include "barretenberg/vm2/proving_helper.hpp"
+#include "barretenberg/vm2/simulation_helper.hpp"
 
 namespace bb::avm2 {
 
@@ -18,6 +21,10 @@ class AvmAPI {
     // NOTE: The public inputs are NOT part of the proof.
     std::pair<AvmProof, AvmVerificationKey> prove(const ProvingInputs& inputs);
     bool check_circuit(const ProvingInputs& inputs);
+    // Simulate-only: no events, trace or proof. Throws if the simulation fails.
+    void simulate(const ExecutionHints& hints);
+    // Simulate-only for a block of transactions, concurrently. Results are in block order.
+    std::vector<TxSimulationResult> simulate_block(std::span<const ExecutionHints> txs_hints);
     bool verify(const AvmProof& proof, const PublicInputs& pi, const AvmVerificationKey& vk_data);
 };
 
@@ -230,7 +230,7 @@ class AvmFlavor {
         {
             for (auto [polynomial, commitment] :
                  zip_view(proving_key->get_precomputed_polynomials(), this->get_all())) {
-                commitment = proving_key->commitment_key->commit(polynomial);
+                commitment = proving_key->commitment_key->commit_fixed(polynomial);
             }
         }
 
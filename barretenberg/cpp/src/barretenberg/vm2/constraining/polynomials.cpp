@@ -4,12 +4,14 @@
 
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/vm2/common/constants.hpp"
+#include "barretenberg/vm2/constraining/precomputed_snapshot.hpp"
 #include "barretenberg/vm2/generated/columns.hpp"
 #include "barretenberg/vm2/tooling/stats.hpp"
 
 namespace bb::avm2::constraining {
 
-AvmProver::ProverPolynomials compute_polynomials(tracegen::TraceContainer& trace)
+AvmProver::ProverPolynomials compute_polynomials(tracegen::TraceContainer& trace,
+                                                 const PrecomputedSnapshot* precomputed_snapshot)
 {
     AvmProver::ProverPolynomials polys;
 
@@ -54,6 +56,12 @@ AvmProver::ProverPolynomials compute_polynomials(tracegen::TraceContainer& trace
 
                            // WARNING! Column-Polynomials order matters!
                            Column col = static_cast<Column>(i);
+                           if (precomputed_snapshot != nullptr && i < PrecomputedSnapshot::NUM_COLUMNS) {
+                               // Precomputed columns are never shifted, so they can't have been initialized above.
+                               poly = precomputed_snapshot->get_polynomial(col).share();
+                               trace.clear_column(col);
+                               return;
+                           }
                            const auto num_rows = trace.get_column_rows(col);
                            poly = AvmProver::Polynomial::create_non_parallel_zero_init(num_rows, CIRCUIT_SUBGROUP_SIZE);
                        });
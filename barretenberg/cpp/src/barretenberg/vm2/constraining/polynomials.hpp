@@ -5,7 +5,11 @@
 
 namespace bb::avm2::constraining {
 
+class PrecomputedSnapshot;
+
 // Computes the polynomials from the trace, and destroys it in the process.
-AvmProver::ProverPolynomials compute_polynomials(tracegen::TraceContainer& trace);
+// If a precomputed snapshot is given, the precomputed polynomials share its memory instead of being copied.
+AvmProver::ProverPolynomials compute_polynomials(tracegen::TraceContainer& trace,
+                                                 const PrecomputedSnapshot* precomputed_snapshot = nullptr);
 
 } // namespace bb::avm2::constraining
@@ -0,0 +1,292 @@
+#include "barretenberg/vm2/constraining/precomputed_snapshot.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <type_traits>
+#include <unistd.h>
+
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/vm2/common/constants.hpp"
+#include "barretenberg/vm2/tooling/stats.hpp"
+#include "barretenberg/vm2/tracegen_helper.hpp"
+
+namespace bb::avm2::constraining {
+namespace {
+
+constexpr uint64_t SNAPSHOT_MAGIC = 0x4345'5250'324d'5641; // "AVM2PREC" in little endian.
+constexpr uint64_t PAGE_SIZE = 4096;
+
+struct Header {
+    uint64_t magic;
+    uint64_t key;
+    uint64_t circuit_size;
+    uint64_t num_columns;
+    uint64_t columns_checksum;
+    uint64_t commitments_checksum;
+};
+
+struct ColumnEntry {
+    uint64_t num_rows;
+    uint64_t offset;
+    uint64_t checksum;
+};
+
+using Commitment = PrecomputedSnapshot::Commitment;
+using FF = PrecomputedSnapshot::FF;
+static_assert(std::is_trivially_copyable_v<Commitment>);
+static_assert(std::is_trivially_copyable_v<FF>);
+static_assert(sizeof(Commitment) % sizeof(uint64_t) == 0 && sizeof(FF) % sizeof(uint64_t) == 0);
+
+constexpr uint64_t FNV_OFFSET_BASIS = 0xcbf2'9ce4'8422'2325;
+constexpr uint64_t FNV_PRIME = 0x0100'0000'01b3;
+
+constexpr uint64_t align_to_page(uint64_t offset)
+{
+    return (offset + PAGE_SIZE - 1) / PAGE_SIZE * PAGE_SIZE;
+}
+
+// Identifies the set and order of precomputed columns, so that a stale snapshot is never used
+// after the columns are regenerated by the PIL codegen.
+uint64_t compute_layout_hash()
+{
+    // FNV-1a.
+    uint64_t hash = FNV_OFFSET_BASIS;
+    auto absorb = [&hash](const void* data, size_t size) {
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            hash ^= bytes[i];
+            hash *= FNV_PRIME;
+        }
+    };
+    for (size_t i = 0; i < PrecomputedSnapshot::NUM_COLUMNS; ++i) {
+        const std::string& name = COLUMN_NAMES.at(i);
+        absorb(name.data(), name.size() + 1);
+    }
+    return hash;
+}
+
+// FNV-1a over 64-bit words rather than bytes, with an extra xor-shift so that the high bits feed back into the
+// low ones. Each step is a bijection of the state, so changing any single word always changes the hash. This is
+// enough to detect a corrupted or partially written snapshot, and fast enough to check it on every load.
+uint64_t checksum(const void* data, size_t size, uint64_t hash = FNV_OFFSET_BASIS)
+{
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; i += sizeof(uint64_t)) {
+        uint64_t word = 0;
+        std::memcpy(&word, bytes + i, sizeof(word));
+        hash ^= word;
+        hash *= FNV_PRIME;
+        hash ^= hash >> 32;
+    }
+    return hash;
+}
+
+uint64_t column_checksum(const FF* values, uint64_t num_rows)
+{
+    return checksum(values, num_rows * sizeof(FF), checksum(&num_rows, sizeof(num_rows)));
+}
+
+// Fills in the number of rows and the checksum of each column.
+std::array<ColumnEntry, PrecomputedSnapshot::NUM_COLUMNS> compute_column_entries(
+    const PrecomputedSnapshot::Polynomials& polynomials)
+{
+    std::array<ColumnEntry, PrecomputedSnapshot::NUM_COLUMNS> entries;
+    bb::parallel_for(PrecomputedSnapshot::NUM_COLUMNS, [&](size_t i) {
+        const uint64_t num_rows = polynomials[i].size();
+        entries[i] = {
+            .num_rows = num_rows, .offset = 0, .checksum = column_checksum(polynomials[i].data(), num_rows)
+        };
+    });
+    return entries;
+}
+
+// Owns a private (copy-on-write) read/write mapping of a file.
+class MappedFile {
+  public:
+    MappedFile(void* addr, size_t size)
+        : addr(addr)
+        , size(size)
+    {}
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    ~MappedFile() { munmap(addr, size); }
+
+    uint8_t* data() const { return static_cast<uint8_t*>(addr); }
+
+  private:
+    void* addr;
+    size_t size;
+};
+
+} // namespace
+
+PrecomputedSnapshot::Polynomials PrecomputedSnapshot::generate_polynomials()
+{
+    AvmTraceGenHelper tracegen_helper;
+    auto trace = AVM_TRACK_TIME_V("snapshot/tracegen", tracegen_helper.generate_precomputed_columns());
+
+    // Same polynomials as compute_polynomials() would build, so the commitments match the ones in the VK.
+    Polynomials polys;
+    bb::parallel_for(NUM_COLUMNS, [&](size_t i) {
+        polys[i] = Polynomial::create_non_parallel_zero_init(trace.get_column_rows(static_cast<Column>(i)),
+                                                             CIRCUIT_SUBGROUP_SIZE);
+        trace.visit_column(static_cast<Column>(i), [&](size_t row, const FF& value) { polys[i].at(row) = value; });
+        trace.clear_column(static_cast<Column>(i));
+    });
+    return polys;
+}
+
+uint64_t PrecomputedSnapshot::compute_key()
+{
+    const std::array<uint64_t, 3> key = { VERSION, compute_layout_hash(), CIRCUIT_SUBGROUP_SIZE };
+    return checksum(key.data(), sizeof(key));
+}
+
+void PrecomputedSnapshot::write(const std::filesystem::path& path, const Polynomials& polys)
+{
+    info("Writing AVM precomputed snapshot to ", path, "...");
+
+    std::array<ColumnEntry, NUM_COLUMNS> entries = compute_column_entries(polys);
+    uint64_t offset = align_to_page(sizeof(Header) + sizeof(entries) + (sizeof(Commitment) * NUM_COLUMNS));
+    for (auto& entry : entries) {
+        entry.offset = offset;
+        offset = align_to_page(offset + (entry.num_rows * sizeof(FF)));
+    }
+
+    std::array<Commitment, NUM_COLUMNS> commitments;
+    auto commitment_key = std::make_shared<AvmProver::PCSCommitmentKey>(CIRCUIT_SUBGROUP_SIZE);
+    AVM_TRACK_TIME("snapshot/commit", ({
+                       for (size_t i = 0; i < NUM_COLUMNS; ++i) {
+                           commitments[i] = commitment_key->commit(polys[i]);
+                       }
+                   }));
+
+    // Write to a temporary file and rename it, so that concurrent readers never see a partial snapshot.
+    const auto tmp_path = std::filesystem::path(path.string() + ".tmp." + std::to_string(getpid()));
+    {
+        std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            throw std::runtime_error("Could not open " + tmp_path.string() + " for writing.");
+        }
+        const Header header = {
+            .magic = SNAPSHOT_MAGIC,
+            .key = compute_key(),
+            .circuit_size = CIRCUIT_SUBGROUP_SIZE,
+            .num_columns = NUM_COLUMNS,
+            .columns_checksum = checksum(entries.data(), sizeof(entries)),
+            .commitments_checksum = checksum(commitments.data(), sizeof(commitments)),
+        };
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(entries.data()), sizeof(entries));
+        file.write(reinterpret_cast<const char*>(commitments.data()), sizeof(commitments));
+        for (size_t i = 0; i < NUM_COLUMNS; ++i) {
+            file.seekp(static_cast<std::streamoff>(entries[i].offset));
+            file.write(reinterpret_cast<const char*>(polys[i].data()),
+                       static_cast<std::streamsize>(entries[i].num_rows * sizeof(FF)));
+        }
+        // Pad the file so that the mapping covers the last page.
+        file.seekp(static_cast<std::streamoff>(offset) - 1);
+        file.put(0);
+        if (!file) {
+            throw std::runtime_error("Could not write " + tmp_path.string() + ".");
+        }
+    }
+    std::filesystem::rename(tmp_path, path);
+}
+
+std::optional<PrecomputedSnapshot> PrecomputedSnapshot::load(const std::filesystem::path& path,
+                                                              uint64_t expected_key)
+{
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return std::nullopt;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(Header)) {
+        close(fd);
+        return std::nullopt;
+    }
+    const auto file_size = static_cast<size_t>(st.st_size);
+    // Private mapping: the polynomials are writable, but writes never reach the file.
+    void* addr = mmap(nullptr, file_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+        return std::nullopt;
+    }
+    auto mapping = std::make_shared<MappedFile>(addr, file_size);
+
+    Header header;
+    std::memcpy(&header, mapping->data(), sizeof(header));
+    if (header.magic != SNAPSHOT_MAGIC || header.key != expected_key ||
+        header.circuit_size != CIRCUIT_SUBGROUP_SIZE || header.num_columns != NUM_COLUMNS) {
+        info("Ignoring stale or invalid AVM precomputed snapshot at ", path);
+        return std::nullopt;
+    }
+
+    std::array<ColumnEntry, NUM_COLUMNS> entries;
+    if (file_size < sizeof(Header) + sizeof(entries) + (sizeof(Commitment) * NUM_COLUMNS)) {
+        return std::nullopt;
+    }
+    std::memcpy(entries.data(), mapping->data() + sizeof(Header), sizeof(entries));
+
+    PrecomputedSnapshot snapshot;
+    std::memcpy(snapshot.commitments.data(), mapping->data() + sizeof(Header) + sizeof(entries), sizeof(commitments));
+    bool corrupted = checksum(snapshot.commitments.data(), sizeof(commitments)) != header.commitments_checksum ||
+                     checksum(entries.data(), sizeof(entries)) != header.columns_checksum;
+    for (const auto& entry : entries) {
+        corrupted |= entry.offset % PAGE_SIZE != 0 || entry.offset > file_size ||
+                     entry.num_rows > (file_size - entry.offset) / sizeof(FF) || entry.num_rows > CIRCUIT_SUBGROUP_SIZE;
+    }
+    if (!corrupted) {
+        // Check the values of the columns against their checksums.
+        std::array<bool, NUM_COLUMNS> column_corrupted{};
+        bb::parallel_for(NUM_COLUMNS, [&](size_t i) {
+            const auto* values = reinterpret_cast<const FF*>(mapping->data() + entries[i].offset);
+            column_corrupted[i] = column_checksum(values, entries[i].num_rows) != entries[i].checksum;
+        });
+        corrupted = std::ranges::any_of(column_corrupted, [](bool column) { return column; });
+    }
+    if (corrupted) {
+        info("Ignoring corrupted AVM precomputed snapshot at ", path);
+        return std::nullopt;
+    }
+
+    for (size_t i = 0; i < NUM_COLUMNS; ++i) {
+        const auto& entry = entries[i];
+        // The polynomial memory aliases the mapping, which stays alive until the last polynomial share is gone.
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+        std::shared_ptr<FF[]> memory(mapping, reinterpret_cast<FF*>(mapping->data() + entry.offset));
+        snapshot.polynomials[i] =
+            Polynomial::from_backing_memory(std::move(memory), entry.num_rows, CIRCUIT_SUBGROUP_SIZE);
+    }
+
+    return snapshot;
+}
+
+PrecomputedSnapshot PrecomputedSnapshot::load_or_generate(const std::filesystem::path& path)
+{
+    std::optional<PrecomputedSnapshot> snapshot = load(path);
+    if (!snapshot.has_value()) {
+        write(path, generate_polynomials());
+        snapshot = load(path);
+    }
+    if (!snapshot.has_value()) {
+        throw std::runtime_error("Could not load AVM precomputed snapshot at " + path.string());
+    }
+    return std::move(*snapshot);
+}
+
+void PrecomputedSnapshot::attach_to(tracegen::TraceContainer& trace) const
+{
+    for (size_t i = 0; i < NUM_COLUMNS; ++i) {
+        trace.attach_dense_column(static_cast<Column>(i), polynomials[i].coeffs());
+    }
+}
+
+} // namespace bb::avm2::constraining
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+
+#include "barretenberg/vm2/constraining/prover.hpp"
+#include "barretenberg/vm2/generated/columns.hpp"
+#include "barretenberg/vm2/tracegen/trace_container.hpp"
+
+namespace bb::avm2::constraining {
+
+// The precomputed columns (bitwise, range, power of 2, instruction spec, to_radix tables, etc.) and their
+// commitments are the same for every AVM proof. This snapshot lets us commit to them once, persist them
+// to a file, and then mmap them directly into polynomials, skipping the commitments to them when building
+// the verification key.
+//
+// A snapshot is identified by a key that is cheap to compute: VERSION, the set and order of the precomputed columns
+// and the circuit size. Loading it never regenerates the columns, they are only generated when there is no usable
+// snapshot. Every column, the column table and the commitments carry a checksum, so a corrupted snapshot is never
+// used either.
+//
+// File layout (native endianness, it is a local cache and not meant to be shared across machines):
+//   Header
+//   ColumnEntry[NUM_PRECOMPUTED_ENTITIES]
+//   Commitment[NUM_PRECOMPUTED_ENTITIES]
+//   column values (raw FF in Montgomery form), each column starting at a page-aligned offset.
+class PrecomputedSnapshot {
+  public:
+    using FF = AvmFlavor::FF;
+    using Polynomial = AvmFlavor::Polynomial;
+    using Commitment = AvmFlavor::Commitment;
+    static constexpr size_t NUM_COLUMNS = AvmFlavor::NUM_PRECOMPUTED_ENTITIES;
+    // Indexed by column, precomputed columns come first in the Column enum.
+    using Polynomials = std::array<Polynomial, NUM_COLUMNS>;
+    // WARNING: bump this whenever the content of any precomputed column changes.
+    static constexpr uint64_t VERSION = 2;
+
+    // Generates the precomputed columns as the polynomials compute_polynomials() would build from them.
+    static Polynomials generate_polynomials();
+    // Key of the snapshots of the current precomputed columns.
+    static uint64_t compute_key();
+
+    // Commits to the precomputed polynomials and writes the snapshot to `path`.
+    // Requires the bn254 CRS to be initialized with at least CIRCUIT_SUBGROUP_SIZE points.
+    static void write(const std::filesystem::path& path, const Polynomials& polynomials);
+    // Memory-maps a snapshot. Returns std::nullopt if the file does not exist, is corrupted or does not have the
+    // expected key.
+    static std::optional<PrecomputedSnapshot> load(const std::filesystem::path& path,
+                                                   uint64_t expected_key = compute_key());
+    // Loads the snapshot of the current precomputed columns, generating it if it is missing, stale or corrupted.
+    static PrecomputedSnapshot load_or_generate(const std::filesystem::path& path);
+
+    // Polynomials share the mapped memory. Writes to them are private to this process.
+    const Polynomial& get_polynomial(Column col) const { return polynomials[static_cast<size_t>(col)]; }
+    const std::array<Commitment, NUM_COLUMNS>& get_commitments() const { return commitments; }
+
+    // Makes the precomputed columns of `trace` point to the snapshot, instead of generating them.
+    void attach_to(tracegen::TraceContainer& trace) const;
+
+  private:
+    PrecomputedSnapshot() = default;
+
+    Polynomials polynomials;
+    std::array<Commitment, NUM_COLUMNS> commitments;
+};
+
+} // namespace bb::avm2::constraining
@@ -0,0 +1,127 @@
+#include "barretenberg/vm2/constraining/precomputed_snapshot.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include "barretenberg/common/zip_view.hpp"
+#include "barretenberg/vm2/common/constants.hpp"
+#include "barretenberg/vm2/constraining/polynomials.hpp"
+#include "barretenberg/vm2/testing/fixtures.hpp"
+#include "barretenberg/vm2/tracegen_helper.hpp"
+
+namespace bb::avm2::constraining {
+namespace {
+
+using VerificationKey = AvmFlavor::VerificationKey;
+
+// Offsets in the snapshot file, see the layout in precomputed_snapshot.cpp.
+constexpr size_t HEADER_SIZE = 6 * sizeof(uint64_t);
+constexpr size_t COLUMN_ENTRY_SIZE = 3 * sizeof(uint64_t);
+constexpr size_t COMMITMENTS_OFFSET = HEADER_SIZE + (PrecomputedSnapshot::NUM_COLUMNS * COLUMN_ENTRY_SIZE);
+
+class PrecomputedSnapshotTest : public ::testing::Test {
+  protected:
+    static void SetUpTestSuite()
+    {
+        bb::srs::init_crs_factory(bb::srs::get_ignition_crs_path());
+        bb::srs::init_grumpkin_crs_factory(bb::srs::get_grumpkin_crs_path());
+    }
+
+    void SetUp() override
+    {
+        path = std::filesystem::temp_directory_path() /
+               ("avm_precomputed_snapshot_test." + std::to_string(getpid()) + ".bin");
+    }
+
+    void TearDown() override { std::filesystem::remove(path); }
+
+    // Flips the bits of the byte at `offset` in the snapshot file.
+    void flip_byte(size_t offset) const
+    {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekg(static_cast<std::streamoff>(offset));
+        const auto byte = static_cast<char>(~file.get());
+        file.seekp(static_cast<std::streamoff>(offset));
+        file.put(byte);
+    }
+
+    template <typename T> T read_at(size_t offset) const
+    {
+        T value;
+        std::ifstream file(path, std::ios::binary);
+        file.seekg(static_cast<std::streamoff>(offset));
+        file.read(reinterpret_cast<char*>(&value), sizeof(value));
+        return value;
+    }
+
+    std::filesystem::path path;
+};
+
+TEST_F(PrecomputedSnapshotTest, GenerateLoadRoundtrip)
+{
+    if (testing::skip_slow_tests()) {
+        GTEST_SKIP();
+    }
+
+    PrecomputedSnapshot::write(path, PrecomputedSnapshot::generate_polynomials());
+    auto snapshot = PrecomputedSnapshot::load(path);
+    ASSERT_TRUE(snapshot.has_value());
+
+    // The polynomials must be the ones the prover builds from freshly generated precomputed columns.
+    AvmTraceGenHelper tracegen_helper;
+    auto trace = tracegen_helper.generate_precomputed_columns();
+    auto expected_polys = compute_polynomials(trace);
+    auto proving_key = std::make_shared<AvmProver::ProvingKey>(CIRCUIT_SUBGROUP_SIZE, /*num_public_inputs=*/0);
+    for (auto [key_poly, prover_poly] : zip_view(proving_key->get_all(), expected_polys.get_unshifted())) {
+        key_poly = std::move(prover_poly);
+    }
+    proving_key->commitment_key = std::make_shared<AvmProver::PCSCommitmentKey>(CIRCUIT_SUBGROUP_SIZE);
+
+    auto expected_precomputed = proving_key->get_precomputed_polynomials();
+    for (size_t i = 0; i < PrecomputedSnapshot::NUM_COLUMNS; ++i) {
+        EXPECT_EQ(snapshot->get_polynomial(static_cast<Column>(i)), expected_precomputed[i]) << COLUMN_NAMES.at(i);
+    }
+
+    // And the VK built from the snapshot must be the one built by committing to the proving key.
+    const VerificationKey expected_vk(proving_key);
+    const VerificationKey vk(CIRCUIT_SUBGROUP_SIZE, /*num_public_inputs=*/0, snapshot->get_commitments());
+    EXPECT_EQ(vk.to_field_elements(), expected_vk.to_field_elements());
+}
+
+TEST_F(PrecomputedSnapshotTest, RejectsStaleOrCorruptedSnapshot)
+{
+    if (testing::skip_slow_tests()) {
+        GTEST_SKIP();
+    }
+
+    PrecomputedSnapshot::write(path, PrecomputedSnapshot::generate_polynomials());
+    ASSERT_TRUE(PrecomputedSnapshot::load(path).has_value());
+
+    // A snapshot of a different version, set of precomputed columns or circuit size.
+    EXPECT_FALSE(PrecomputedSnapshot::load(path, PrecomputedSnapshot::compute_key() + 1).has_value());
+
+    // A corrupted commitment.
+    flip_byte(COMMITMENTS_OFFSET + 3);
+    EXPECT_FALSE(PrecomputedSnapshot::load(path).has_value());
+    flip_byte(COMMITMENTS_OFFSET + 3);
+    ASSERT_TRUE(PrecomputedSnapshot::load(path).has_value());
+
+    // A corrupted column table entry.
+    flip_byte(HEADER_SIZE + COLUMN_ENTRY_SIZE + 1);
+    EXPECT_FALSE(PrecomputedSnapshot::load(path).has_value());
+    flip_byte(HEADER_SIZE + COLUMN_ENTRY_SIZE + 1);
+    ASSERT_TRUE(PrecomputedSnapshot::load(path).has_value());
+
+    // A corrupted value in the middle of the first column.
+    const auto num_rows = read_at<uint64_t>(HEADER_SIZE);
+    const auto offset = read_at<uint64_t>(HEADER_SIZE + sizeof(uint64_t));
+    ASSERT_GT(num_rows, 0);
+    flip_byte(offset + (num_rows / 2 * sizeof(PrecomputedSnapshot::FF)));
+    EXPECT_FALSE(PrecomputedSnapshot::load(path).has_value());
+}
+
+} // namespace
+} // namespace bb::avm2::constraining
@@ -69,14 +69,24 @@ std::shared_ptr<AvmVerifier::VerificationKey> AvmProvingHelper::create_verificat
     return std::make_shared<VerificationKey>(circuit_size, num_public_inputs, precomputed_cmts);
 }
 
-std::pair<AvmProvingHelper::Proof, AvmProvingHelper::VkData> AvmProvingHelper::prove(tracegen::TraceContainer&& trace)
+std::pair<AvmProvingHelper::Proof, AvmProvingHelper::VkData> AvmProvingHelper::prove(
+    tracegen::TraceContainer&& trace, const constraining::PrecomputedSnapshot* precomputed_snapshot)
 {
-    auto polynomials = AVM_TRACK_TIME_V("proving/prove:compute_polynomials", constraining::compute_polynomials(trace));
+    using VerificationKey = AvmVerifier::VerificationKey;
+    static_assert(constraining::PrecomputedSnapshot::NUM_COLUMNS == VerificationKey::NUM_PRECOMPUTED_COMMITMENTS);
+
+    auto polynomials = AVM_TRACK_TIME_V("proving/prove:compute_polynomials",
+                                        constraining::compute_polynomials(trace, precomputed_snapshot));
     auto proving_key = AVM_TRACK_TIME_V("proving/prove:proving_key", create_proving_key(polynomials));
     auto prover =
         AVM_TRACK_TIME_V("proving/prove:construct_prover", AvmProver(proving_key, proving_key->commitment_key));
-    auto verification_key =
-        AVM_TRACK_TIME_V("proving/prove:verification_key", std::make_shared<AvmVerifier::VerificationKey>(proving_key));
+    // The commitments to the precomputed columns are already in the snapshot, if we have one.
+    auto verification_key = AVM_TRACK_TIME_V(
+        "proving/prove:verification_key",
+        precomputed_snapshot != nullptr
+            ? std::make_shared<VerificationKey>(
+                  CIRCUIT_SUBGROUP_SIZE, /*num_public_inputs=*/0, precomputed_snapshot->get_commitments())
+            : std::make_shared<VerificationKey>(proving_key));
 
     auto proof = AVM_TRACK_TIME_V("proving/construct_proof", prover.construct_proof());
     auto serialized_vk = to_buffer(verification_key->to_field_elements());
@@ -2,6 +2,7 @@
 
 #include "barretenberg/honk/proof_system/types/proof.hpp"
 #include "barretenberg/vm2/common/avm_inputs.hpp"
+#include "barretenberg/vm2/constraining/precomputed_snapshot.hpp"
 #include "barretenberg/vm2/constraining/prover.hpp"
 #include "barretenberg/vm2/constraining/verifier.hpp"
 #include "barretenberg/vm2/tracegen/trace_container.hpp"
@@ -15,7 +16,9 @@ class AvmProvingHelper {
     using VkData = std::vector<uint8_t>;
 
     static std::shared_ptr<AvmVerifier::VerificationKey> create_verification_key(const VkData& vk_data);
-    std::pair<Proof, VkData> prove(tracegen::TraceContainer&& trace);
+    // If a precomputed snapshot is given, its polynomials and commitments are used for the precomputed columns.
+    std::pair<Proof, VkData> prove(tracegen::TraceContainer&& trace,
+                                   const constraining::PrecomputedSnapshot* precomputed_snapshot = nullptr);
     bool check_circuit(tracegen::TraceContainer&& trace);
     bool verify(const Proof& proof, const PublicInputs& pi, const VkData& vk_data);
 };
@@ -0,0 +1,126 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "barretenberg/api/file_io.hpp"
+#include "barretenberg/vm2/common/avm_inputs.hpp"
+#include "barretenberg/vm2/simulation_helper.hpp"
+
+using namespace benchmark;
+using namespace bb::avm2;
+
+namespace {
+
+// cwd is expected to be barretenberg/cpp/build (or build-bench).
+// Can be overridden to point to other serialized AVM inputs.
+std::string get_inputs_path()
+{
+    const char* path = std::getenv("AVM_BENCH_INPUTS");
+    return path != nullptr ? path : "../src/barretenberg/vm2/common/avm_inputs.testdata.bin";
+}
+
+const AvmProvingInputs& get_inputs()
+{
+    static const AvmProvingInputs inputs = AvmProvingInputs::from(bb::read_file(get_inputs_path()));
+    return inputs;
+}
+
+// Full simulation, collecting all the events needed for trace generation.
+void BM_simulate_with_events(State& state)
+{
+    const auto& inputs = get_inputs();
+    for (auto _ : state) {
+        AvmSimulationHelper simulation_helper(inputs.hints);
+        auto events = simulation_helper.simulate();
+        DoNotOptimize(events);
+    }
+}
+
+// Simulate-only: no events and proving-only gadgets reduced to their native result.
+void BM_simulate_fast(State& state)
+{
+    const auto& inputs = get_inputs();
+    for (auto _ : state) {
+        AvmSimulationHelper simulation_helper(inputs.hints);
+        simulation_helper.simulate_fast();
+    }
+}
+
+// A block of distinct transactions, each one hinted against the state the previous one left, so that
+// reconciliation keeps all of them. Such hints can only come from simulating the transactions one after the
+// other against the world state, so they are read from the serialized AVM inputs in the AVM_BENCH_BLOCK_INPUTS
+// directory, in file name order.
+const std::vector<ExecutionHints>& get_block()
+{
+    static const std::vector<ExecutionHints> block = [] {
+        std::vector<ExecutionHints> block;
+        const char* directory = std::getenv("AVM_BENCH_BLOCK_INPUTS");
+        if (directory == nullptr) {
+            return block;
+        }
+        std::vector<std::filesystem::path> paths;
+        for (const auto& entry : std::filesystem::directory_iterator(directory)) {
+            paths.push_back(entry.path());
+        }
+        std::ranges::sort(paths);
+        for (const auto& path : paths) {
+            block.push_back(AvmProvingInputs::from(bb::read_file(path)).hints);
+        }
+
+        // Otherwise we would be measuring the cost of conflicting transactions instead.
+        AvmBlockSimulationHelper simulation_helper(block);
+        for (const auto& result : simulation_helper.simulate_fast()) {
+            if (!result.success || result.conflicts) {
+                throw std::runtime_error("AVM_BENCH_BLOCK_INPUTS is not a block of chained successful transactions.");
+            }
+        }
+        return block;
+    }();
+    return block;
+}
+
+// The first state.range(0) transactions of the block.
+std::span<const ExecutionHints> get_block_prefix(State& state)
+{
+    const auto num_txs = static_cast<size_t>(state.range(0));
+    if (get_block().size() < num_txs) {
+        state.SkipWithError("Not enough transactions in AVM_BENCH_BLOCK_INPUTS.");
+        return {};
+    }
+    return std::span(get_block()).first(num_txs);
+}
+
+void BM_simulate_block_serial(State& state)
+{
+    const auto block = get_block_prefix(state);
+    for (auto _ : state) {
+        for (const auto& tx_hints : block) {
+            AvmSimulationHelper simulation_helper(tx_hints);
+            DoNotOptimize(simulation_helper.simulate_fast());
+        }
+    }
+}
+
+void BM_simulate_block_parallel(State& state)
+{
+    const auto block = get_block_prefix(state);
+    for (auto _ : state) {
+        AvmBlockSimulationHelper simulation_helper(block);
+        DoNotOptimize(simulation_helper.simulate_fast());
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_simulate_with_events)->Unit(kMillisecond);
+BENCHMARK(BM_simulate_fast)->Unit(kMillisecond);
+BENCHMARK(BM_simulate_block_serial)->RangeMultiplier(2)->Range(1, 32)->Unit(kMillisecond);
+BENCHMARK(BM_simulate_block_parallel)->RangeMultiplier(2)->Range(1, 32)->Unit(kMillisecond);
+
+BENCHMARK_MAIN();
@@ -60,4 +60,9 @@ bool FieldGreaterThan::ff_gt(const FF& a, const FF& b)
     return result;
 }
 
+bool NativeFieldGreaterThan::ff_gt(const FF& a, const FF& b)
+{
+    return static_cast<uint256_t>(a) > static_cast<uint256_t>(b);
+}
+
 } // namespace bb::avm2::simulation
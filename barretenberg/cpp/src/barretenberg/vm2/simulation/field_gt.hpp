@@ -27,4 +27,10 @@ class FieldGreaterThan : public FieldGreaterThanInterface {
     EventEmitterInterface<FieldGreaterThanEvent>& events;
 };
 
+// Simulate-only version: returns the native comparison without decomposing into limbs or range checking them.
+class NativeFieldGreaterThan final : public FieldGreaterThanInterface {
+  public:
+    bool ff_gt(const FF& a, const FF& b) override;
+};
+
 } // namespace bb::avm2::simulation
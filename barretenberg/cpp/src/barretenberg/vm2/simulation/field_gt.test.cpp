@@ -88,5 +88,21 @@ TEST(AvmSimulationFieldGreaterThanTest, Results)
     EXPECT_THAT(event_emitter.dump_events(), SizeIs(6));
 }
 
+TEST(AvmSimulationFieldGreaterThanTest, NativeMatchesFull)
+{
+    NiceMock<MockRangeCheck> range_check;
+
+    EventEmitter<FieldGreaterThanEvent> event_emitter;
+    FieldGreaterThan field_gt(range_check, event_emitter);
+    NativeFieldGreaterThan native_field_gt;
+
+    std::vector<FF> values = { 0, 1, -1, FF::random_element(), FF::random_element() };
+    for (const auto& a : values) {
+        for (const auto& b : values) {
+            EXPECT_EQ(native_field_gt.ff_gt(a, b), field_gt.ff_gt(a, b));
+        }
+    }
+}
+
 } // namespace
 } // namespace bb::avm2::simulation
@@ -4,9 +4,24 @@
 #include <cstdint>
 
 #include "barretenberg/vm2/common/constants.hpp"
+#include "barretenberg/vm2/simulation/lib/merkle.hpp"
 
 namespace bb::avm2::simulation {
 
+namespace {
+
+// Equivalent to the "final node index must be 0 or 1" check done while walking up the path.
+void assert_index_fits_path(const uint64_t leaf_index, std::span<const FF> sibling_path)
+{
+    const size_t num_halvings = sibling_path.empty() ? 0 : sibling_path.size() - 1;
+    const uint64_t final_index = num_halvings >= 64 ? 0 : (leaf_index >> num_halvings);
+    if (final_index != 0 && final_index != 1) {
+        throw std::runtime_error("Merkle check's final node index must be 0 or 1");
+    }
+}
+
+} // namespace
+
 void MerkleCheck::assert_membership(const FF& leaf_value,
                                     const uint64_t leaf_index,
                                     std::span<const FF> sibling_path,
@@ -91,4 +106,33 @@ FF MerkleCheck::write(const FF& current_value,
     return write_value;
 }
 
+void NativeMerkleCheck::assert_membership(const FF& leaf_value,
+                                          const uint64_t leaf_index,
+                                          std::span<const FF> sibling_path,
+                                          const FF& root)
+{
+    assert(sibling_path.size() <= 254 && "Merkle path length must be less than 254");
+    assert_index_fits_path(leaf_index, sibling_path);
+
+    if (root_from_path(leaf_value, leaf_index, sibling_path) != root) {
+        throw std::runtime_error("Merkle read check failed");
+    }
+}
+
+FF NativeMerkleCheck::write(const FF& current_value,
+                            const FF& new_value,
+                            const uint64_t leaf_index,
+                            std::span<const FF> sibling_path,
+                            const FF& current_root)
+{
+    assert(sibling_path.size() <= 254 && "Merkle path length must be less than 254");
+    assert_index_fits_path(leaf_index, sibling_path);
+
+    if (root_from_path(current_value, leaf_index, sibling_path) != current_root) {
+        throw std::runtime_error("Merkle read check failed");
+    }
+
+    return root_from_path(new_value, leaf_index, sibling_path);
+}
+
 } // namespace bb::avm2::simulation
@@ -30,7 +30,7 @@ class MerkleCheckInterface {
 
 class MerkleCheck : public MerkleCheckInterface {
   public:
-    MerkleCheck(Poseidon2& poseidon2, EventEmitterInterface<MerkleCheckEvent>& event_emitter)
+    MerkleCheck(Poseidon2Interface& poseidon2, EventEmitterInterface<MerkleCheckEvent>& event_emitter)
         : events(event_emitter)
         , poseidon2(poseidon2)
     {}
@@ -51,4 +51,20 @@ class MerkleCheck : public MerkleCheckInterface {
     Poseidon2Interface& poseidon2;
 };
 
+// Simulate-only version: hashes natively and does not emit events.
+// It still validates the hinted paths against the roots, so simulation fails in exactly the same cases.
+class NativeMerkleCheck final : public MerkleCheckInterface {
+  public:
+    void assert_membership(const FF& leaf_value,
+                           const uint64_t leaf_index,
+                           std::span<const FF> sibling_path,
+                           const FF& root) override;
+
+    FF write(const FF& current_value,
+             const FF& new_value,
+             const uint64_t leaf_index,
+             std::span<const FF> sibling_path,
+             const FF& current_root) override;
+};
+
 } // namespace bb::avm2::simulation
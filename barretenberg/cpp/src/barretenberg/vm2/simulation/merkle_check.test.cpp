@@ -189,5 +189,31 @@ TEST(MerkleCheckSimulationTest, NegativeWrongLeafValue)
                               "Merkle read check failed");
 }
 
+TEST(MerkleCheckSimulationTest, NativeMatchesFull)
+{
+    EventEmitter<Poseidon2HashEvent> hash_emitter;
+    EventEmitter<Poseidon2PermutationEvent> perm_emitter;
+    Poseidon2 poseidon2(hash_emitter, perm_emitter);
+
+    EventEmitter<MerkleCheckEvent> emitter;
+    MerkleCheck merkle_check(poseidon2, emitter);
+    NativeMerkleCheck native_merkle_check;
+
+    FF current_value = 333;
+    FF new_value = 334;
+    uint64_t leaf_index = 30;
+    std::vector<FF> sibling_path = { 10, 2, 30, 4, 50, 6 };
+    FF current_root = root_from_path(current_value, leaf_index, sibling_path);
+
+    native_merkle_check.assert_membership(current_value, leaf_index, sibling_path, current_root);
+    EXPECT_EQ(native_merkle_check.write(current_value, new_value, leaf_index, sibling_path, current_root),
+              merkle_check.write(current_value, new_value, leaf_index, sibling_path, current_root));
+
+    EXPECT_THROW_WITH_MESSAGE(native_merkle_check.assert_membership(current_value, 64, sibling_path, current_root),
+                              "Merkle check's final node index must be 0 or 1");
+    EXPECT_THROW_WITH_MESSAGE(native_merkle_check.write(current_value, new_value, leaf_index, sibling_path, 66),
+                              "Merkle read check failed");
+}
+
 } // namespace
 } // namespace bb::avm2::simulation
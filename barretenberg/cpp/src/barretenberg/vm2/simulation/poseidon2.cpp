@@ -7,6 +7,7 @@
 #include "barretenberg/crypto/poseidon2/poseidon2_permutation.hpp"
 
 using bb::crypto::Poseidon2Bn254ScalarFieldParams;
+using RawPoseidon2 = bb::crypto::Poseidon2<Poseidon2Bn254ScalarFieldParams>;
 using bb::crypto::Poseidon2Permutation;
 
 namespace bb::avm2::simulation {
@@ -54,4 +55,14 @@ std::array<FF, 4> Poseidon2::permutation(const std::array<FF, 4>& input)
     return output;
 }
 
+FF NativePoseidon2::hash(const std::vector<FF>& input)
+{
+    return RawPoseidon2::hash(input);
+}
+
+std::array<FF, 4> NativePoseidon2::permutation(const std::array<FF, 4>& input)
+{
+    return Poseidon2Permutation<Poseidon2Bn254ScalarFieldParams>::permutation(input);
+}
+
 } // namespace bb::avm2::simulation
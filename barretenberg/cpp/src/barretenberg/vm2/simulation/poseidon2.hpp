@@ -32,4 +32,11 @@ class Poseidon2 : public Poseidon2Interface {
     EventEmitterInterface<Poseidon2PermutationEvent>& perm_events;
 };
 
+// Simulate-only version: hashes natively without tracking the intermediate permutation states.
+class NativePoseidon2 final : public Poseidon2Interface {
+  public:
+    FF hash(const std::vector<FF>& input) override;
+    std::array<FF, 4> permutation(const std::array<FF, 4>& input) override;
+};
+
 } // namespace bb::avm2::simulation
@@ -90,5 +90,22 @@ TEST(Poseidon2SimulationTest, RandomHash)
     EXPECT_EQ(result, bb_result);
 }
 
+TEST(Poseidon2SimulationTest, NativeMatchesFull)
+{
+    EventEmitter<Poseidon2HashEvent> hash_event_emitter;
+    EventEmitter<Poseidon2PermutationEvent> perm_event_emitter;
+    Poseidon2 poseidon2(hash_event_emitter, perm_event_emitter);
+    NativePoseidon2 native_poseidon2;
+
+    std::vector<FF> input;
+    for (int i = 0; i < 14; i++) {
+        input.push_back(FF::random_element());
+    }
+    std::array<FF, 4> perm_input = { input[0], input[1], input[2], input[3] };
+
+    EXPECT_EQ(native_poseidon2.hash(input), poseidon2.hash(input));
+    EXPECT_THAT(native_poseidon2.permutation(perm_input), ElementsAreArray(poseidon2.permutation(perm_input)));
+}
+
 } // namespace
 } // namespace bb::avm2::simulation
@@ -26,4 +26,10 @@ class RangeCheck : public RangeCheckInterface {
     EventEmitterInterface<RangeCheckEvent>& events;
 };
 
+// Range checks only exist to justify the proof, so in simulate-only mode they are compiled out.
+class NoopRangeCheck final : public RangeCheckInterface {
+  public:
+    void assert_range(uint128_t, uint8_t) override {}
+};
+
 } // namespace bb::avm2::simulation
@@ -3,6 +3,7 @@
 #include <cstdint>
 
 #include "barretenberg/common/log.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/vm2/common/avm_inputs.hpp"
 #include "barretenberg/vm2/common/aztec_types.hpp"
 #include "barretenberg/vm2/common/field.hpp"
@@ -55,12 +56,16 @@ namespace {
 struct ProvingSettings {
     template <typename E> using DefaultEventEmitter = EventEmitter<E>;
     template <typename E> using DefaultDeduplicatingEventEmitter = DeduplicatingEventEmitter<E>;
+    static constexpr bool simulate_only = false;
 };
 
 // Configuration for fast simulation.
+// Only the execution results are needed, so gadgets that exist just to justify the proof
+// (range checks, field comparisons, merkle checks, poseidon2 bookkeeping) are reduced to their native result.
 struct FastSettings {
     template <typename E> using DefaultEventEmitter = NoopEventEmitter<E>;
     template <typename E> using DefaultDeduplicatingEventEmitter = NoopEventEmitter<E>;
+    static constexpr bool simulate_only = true;
 };
 
 } // namespace
@@ -94,12 +99,37 @@ template <typename S> EventsContainer AvmSimulationHelper::simulate_with_setting
 
     uint32_t current_block_number = static_cast<uint32_t>(hints.tx.globalVariables.blockNumber);
 
-    Poseidon2 poseidon2(poseidon2_hash_emitter, poseidon2_perm_emitter);
+    // The simulate-only gadgets are picked at compile time, so no proving-only work is left behind the interfaces.
+    auto poseidon2 = [&]() {
+        if constexpr (S::simulate_only) {
+            return NativePoseidon2();
+        } else {
+            return Poseidon2(poseidon2_hash_emitter, poseidon2_perm_emitter);
+        }
+    }();
     ToRadix to_radix(to_radix_emitter);
     Ecc ecc(to_radix, ecc_add_emitter, scalar_mul_emitter);
-    MerkleCheck merkle_check(poseidon2, merkle_check_emitter);
-    RangeCheck range_check(range_check_emitter);
-    FieldGreaterThan field_gt(range_check, field_gt_emitter);
+    auto merkle_check = [&]() {
+        if constexpr (S::simulate_only) {
+            return NativeMerkleCheck();
+        } else {
+            return MerkleCheck(poseidon2, merkle_check_emitter);
+        }
+    }();
+    auto range_check = [&]() {
+        if constexpr (S::simulate_only) {
+            return NoopRangeCheck();
+        } else {
+            return RangeCheck(range_check_emitter);
+        }
+    }();
+    auto field_gt = [&]() {
+        if constexpr (S::simulate_only) {
+            return NativeFieldGreaterThan();
+        } else {
+            return FieldGreaterThan(range_check, field_gt_emitter);
+        }
+    }();
     PublicDataTreeCheck public_data_tree_check(poseidon2, merkle_check, field_gt, public_data_read_emitter);
     NullifierTreeCheck nullifier_tree_check(poseidon2, merkle_check, field_gt, nullifier_tree_check_emitter);
 
@@ -133,6 +163,7 @@ template <typename S> EventsContainer AvmSimulationHelper::simulate_with_setting
     Sha256 sha256(sha256_compression_emitter);
 
     tx_execution.simulate(hints.tx);
+    ending_tree_roots = merkle_db.get_tree_roots();
 
     return { execution_emitter.dump_events(),
              alu_emitter.dump_events(),
@@ -165,9 +196,49 @@ EventsContainer AvmSimulationHelper::simulate()
     return simulate_with_settings<ProvingSettings>();
 }
 
-void AvmSimulationHelper::simulate_fast()
+TreeSnapshots AvmSimulationHelper::simulate_fast()
 {
     simulate_with_settings<FastSettings>();
+    return ending_tree_roots;
+}
+
+std::vector<TxSimulationResult> AvmBlockSimulationHelper::simulate_fast()
+{
+    std::vector<TxSimulationResult> results(txs_hints.size());
+
+    // Transactions are independent from each other during simulation, each one only sees its own hints.
+    parallel_for(txs_hints.size(), [&](size_t i) {
+        auto& result = results[i];
+        result.starting_tree_roots = txs_hints[i].startingTreeRoots;
+        try {
+            AvmSimulationHelper simulation_helper(txs_hints[i]);
+            result.ending_tree_roots = simulation_helper.simulate_fast();
+            result.success = true;
+        } catch (const std::exception& e) {
+            result.error = e.what();
+        }
+    });
+
+    reconcile(results);
+    return results;
+}
+
+void AvmBlockSimulationHelper::reconcile(std::vector<TxSimulationResult>& results)
+{
+    if (results.empty()) {
+        return;
+    }
+    // The block starts from the state the first transaction was hinted against.
+    TreeSnapshots expected_roots = results.front().starting_tree_roots;
+    for (auto& result : results) {
+        if (result.starting_tree_roots != expected_roots) {
+            result.conflicts = true;
+            continue;
+        }
+        if (result.success) {
+            expected_roots = result.ending_tree_roots;
+        }
+    }
 }
 
 } // namespace bb::avm2
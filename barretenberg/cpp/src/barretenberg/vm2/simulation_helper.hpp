@@ -1,5 +1,9 @@
 #pragma once
 
+#include <span>
+#include <string>
+#include <vector>
+
 #include "barretenberg/vm2/common/avm_inputs.hpp"
 #include "barretenberg/vm2/simulation/events/events_container.hpp"
 
@@ -14,13 +18,49 @@ class AvmSimulationHelper {
     // Full simulation with event collection.
     simulation::EventsContainer simulate();
 
-    // Fast simulation without event collection.
-    void simulate_fast();
+    // Fast simulation without event collection. Returns the tree roots after the transaction.
+    TreeSnapshots simulate_fast();
 
   private:
     template <typename S> simulation::EventsContainer simulate_with_settings();
 
     ExecutionHints hints;
+    TreeSnapshots ending_tree_roots;
+};
+
+struct TxSimulationResult {
+    bool success = false;
+    std::string error;
+    TreeSnapshots starting_tree_roots;
+    TreeSnapshots ending_tree_roots;
+    // Set if the transaction was hinted against a state that does not follow from the previous transactions
+    // in the block. Its result is stale and it needs to be re-hinted and re-simulated.
+    bool conflicts = false;
+};
+
+// Simulate-only execution of a whole block of transactions.
+// Every transaction is simulated concurrently against its own hinted DBs, which act as a private overlay over
+// the state it was hinted against, so no state is shared between threads. Results are then reconciled in block
+// order: a transaction only keeps its result if it starts from the roots the previous successful one ended at.
+class AvmBlockSimulationHelper {
+  public:
+    AvmBlockSimulationHelper(std::span<const ExecutionHints> txs_hints)
+        : txs_hints(txs_hints)
+    {}
+
+    std::vector<TxSimulationResult> simulate_fast();
+
+    // Marks the transactions that conflict with the ones before them in the block. Failed transactions are
+    // dropped from the block, so they never advance the expected roots, and neither do conflicting ones.
+    //
+    // This compares whole-tree starting roots, which is conservative: a transaction conflicts as soon as any
+    // earlier transaction in the block changed any tree, even if it never read what was changed. Hints do not
+    // carry the read set of a transaction, which is what a finer-grained check would compare against the write
+    // sets of the previous ones.
+    static void reconcile(std::vector<TxSimulationResult>& results);
+
+  private:
+    std::span<const ExecutionHints> txs_hints;
 };
 
 } // namespace bb::avm2
@@ -0,0 +1,95 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "barretenberg/vm2/simulation_helper.hpp"
+
+namespace bb::avm2 {
+namespace {
+
+using ::testing::ElementsAre;
+using ::testing::Field;
+
+TreeSnapshots roots(uint64_t num_note_hashes)
+{
+    return { .l1ToL2MessageTree = { .root = 1, .nextAvailableLeafIndex = 0 },
+             .noteHashTree = { .root = FF(num_note_hashes) + 100, .nextAvailableLeafIndex = num_note_hashes },
+             .nullifierTree = { .root = 2, .nextAvailableLeafIndex = 0 },
+             .publicDataTree = { .root = 3, .nextAvailableLeafIndex = 0 } };
+}
+
+TxSimulationResult succeeded(uint64_t start, uint64_t end)
+{
+    return { .success = true, .starting_tree_roots = roots(start), .ending_tree_roots = roots(end) };
+}
+
+TxSimulationResult failed(uint64_t start)
+{
+    return { .success = false, .error = "reverted", .starting_tree_roots = roots(start) };
+}
+
+auto conflicts(bool expected)
+{
+    return Field(&TxSimulationResult::conflicts, expected);
+}
+
+TEST(AvmBlockSimulationHelperTest, ReconcileEmptyBlock)
+{
+    std::vector<TxSimulationResult> results;
+    AvmBlockSimulationHelper::reconcile(results);
+    EXPECT_TRUE(results.empty());
+}
+
+TEST(AvmBlockSimulationHelperTest, ReconcileIndependentTransactions)
+{
+    // Transactions that do not change the state can all be hinted against the same roots.
+    std::vector<TxSimulationResult> results = { succeeded(0, 0), succeeded(0, 0), succeeded(0, 0) };
+    AvmBlockSimulationHelper::reconcile(results);
+    EXPECT_THAT(results, ElementsAre(conflicts(false), conflicts(false), conflicts(false)));
+}
+
+TEST(AvmBlockSimulationHelperTest, ReconcileChainedTransactions)
+{
+    // Each transaction was hinted against the state the previous one left.
+    std::vector<TxSimulationResult> results = { succeeded(0, 1), succeeded(1, 3), succeeded(3, 4) };
+    AvmBlockSimulationHelper::reconcile(results);
+    EXPECT_THAT(results, ElementsAre(conflicts(false), conflicts(false), conflicts(false)));
+}
+
+TEST(AvmBlockSimulationHelperTest, ReconcileConflictsOnAnyEarlierChange)
+{
+    // Both transactions were hinted against the same state but the first one changed it. Whole-tree roots are
+    // compared, so the second one conflicts even if it never read anything the first one wrote.
+    std::vector<TxSimulationResult> results = { succeeded(0, 1), succeeded(0, 1) };
+    AvmBlockSimulationHelper::reconcile(results);
+    EXPECT_THAT(results, ElementsAre(conflicts(false), conflicts(true)));
+}
+
+TEST(AvmBlockSimulationHelperTest, ReconcileDropsFailedTransactions)
+{
+    // The failed transaction does not advance the state, so the next one still starts from roots(1).
+    std::vector<TxSimulationResult> results = { succeeded(0, 1), failed(1), succeeded(1, 2), succeeded(2, 3) };
+    AvmBlockSimulationHelper::reconcile(results);
+    EXPECT_THAT(results, ElementsAre(conflicts(false), conflicts(false), conflicts(false), conflicts(false)));
+
+    // Even if it reports ending roots, e.g. after failing in teardown.
+    results = { succeeded(0, 1), failed(1), succeeded(2, 3) };
+    results[1].ending_tree_roots = roots(2);
+    AvmBlockSimulationHelper::reconcile(results);
+    EXPECT_THAT(results, ElementsAre(conflicts(false), conflicts(false), conflicts(true)));
+}
+
+TEST(AvmBlockSimulationHelperTest, ReconcileConflictingTransactionDoesNotAdvanceState)
+{
+    // The second transaction was hinted against a state that does not follow from the first one.
+    std::vector<TxSimulationResult> results = { succeeded(0, 1), succeeded(5, 6), succeeded(1, 2), succeeded(6, 7) };
+    AvmBlockSimulationHelper::reconcile(results);
+    EXPECT_THAT(results, ElementsAre(conflicts(false), conflicts(true), conflicts(false), conflicts(true)));
+    // The conflict is independent of the outcome of the simulation.
+    EXPECT_TRUE(results[1].success);
+}
+
+} // namespace
+} // namespace bb::avm2
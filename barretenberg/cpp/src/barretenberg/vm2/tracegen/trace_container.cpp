@@ -1,5 +1,7 @@
 #include "barretenberg/vm2/tracegen/trace_container.hpp"
 
+#include <cassert>
+
 #include "barretenberg/common/log.hpp"
 #include "barretenberg/vm2/common/field.hpp"
 #include "barretenberg/vm2/generated/columns.hpp"
@@ -21,6 +23,9 @@ const FF& TraceContainer::get(Column col, uint32_t row) const
 {
     auto& column_data = (*trace)[static_cast<size_t>(col)];
     std::shared_lock lock(column_data.mutex);
+    if (!column_data.dense_rows.empty()) {
+        return row < column_data.dense_rows.size() ? column_data.dense_rows[row] : zero;
+    }
     const auto it = column_data.rows.find(row);
     return it == column_data.rows.end() ? zero : it->second;
 }
@@ -37,6 +42,7 @@ void TraceContainer::set(Column col, uint32_t row, const FF& value)
 {
     auto& column_data = (*trace)[static_cast<size_t>(col)];
     std::unique_lock lock(column_data.mutex);
+    assert(column_data.dense_rows.empty() && "Cannot set a column backed by dense values.");
     if (!value.is_zero()) {
         column_data.rows.insert_or_assign(row, value);
         column_data.max_row_number = std::max(column_data.max_row_number, static_cast<int64_t>(row));
@@ -64,6 +70,21 @@ void TraceContainer::reserve_column(Column col, size_t size)
     column_data.rows.reserve(size);
 }
 
+void TraceContainer::attach_dense_column(Column col, std::span<const FF> values)
+{
+    auto& column_data = (*trace)[static_cast<size_t>(col)];
+    std::unique_lock lock(column_data.mutex);
+    assert(column_data.rows.empty() && "Cannot attach dense values to a non-empty column.");
+    // Trailing zeroes are not part of the column.
+    size_t num_rows = values.size();
+    while (num_rows > 0 && values[num_rows - 1].is_zero()) {
+        --num_rows;
+    }
+    column_data.dense_rows = values.first(num_rows);
+    column_data.max_row_number = static_cast<int64_t>(num_rows) - 1;
+    column_data.row_number_dirty = false;
+}
+
 uint32_t TraceContainer::get_column_rows(Column col) const
 {
     auto& column_data = (*trace)[static_cast<size_t>(col)];
@@ -99,6 +120,11 @@ void TraceContainer::visit_column(Column col, const std::function<void(uint32_t,
 {
     auto& column_data = (*trace)[static_cast<size_t>(col)];
     std::shared_lock lock(column_data.mutex);
+    for (size_t row = 0; row < column_data.dense_rows.size(); ++row) {
+        if (!column_data.dense_rows[row].is_zero()) {
+            visitor(static_cast<uint32_t>(row), column_data.dense_rows[row]);
+        }
+    }
     for (const auto& [row, value] : column_data.rows) {
         visitor(row, value);
     }
@@ -109,6 +135,7 @@ void TraceContainer::clear_column(Column col)
     auto& column_data = (*trace)[static_cast<size_t>(col)];
     std::unique_lock lock(column_data.mutex);
     column_data.rows.clear();
+    column_data.dense_rows = {};
     column_data.max_row_number = 0;
     column_data.row_number_dirty = false;
 }
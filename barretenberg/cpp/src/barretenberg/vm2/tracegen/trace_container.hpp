@@ -45,6 +45,10 @@ class TraceContainer {
     void set(uint32_t row, std::span<const std::pair<Column, FF>> values);
     // Reserve column size. Useful for precomputed columns.
     void reserve_column(Column col, size_t size);
+    // Attaches read-only dense values to an (empty) column instead of storing them sparsely.
+    // Used for precomputed columns loaded from a snapshot. The memory must outlive the attachment,
+    // and the column cannot be set afterwards (clearing it detaches the values).
+    void attach_dense_column(Column col, std::span<const FF> values);
 
     // Visits non-zero values in a column.
     void visit_column(Column col, const std::function<void(uint32_t, const FF&)>& visitor) const;
@@ -71,6 +75,8 @@ class TraceContainer {
         // That is, store a variant with a unique_ptr. However, we should benchmark this.
         // (see serialization.hpp).
         unordered_flat_map<uint32_t, FF> rows;
+        // If non-empty, the column is backed by these values instead of `rows`.
+        std::span<const FF> dense_rows;
     };
     // We store the trace as a sparse matrix.
     // We use a unique_ptr to allocate the array in the heap vs the stack.
@@ -0,0 +1,43 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "barretenberg/vm2/common/field.hpp"
+#include "barretenberg/vm2/generated/columns.hpp"
+#include "barretenberg/vm2/tracegen/trace_container.hpp"
+
+namespace bb::avm2::tracegen {
+namespace {
+
+using testing::ElementsAre;
+using testing::Pair;
+
+TEST(TraceContainerTest, DenseColumnAttachment)
+{
+    TraceContainer trace;
+    // Trailing zeroes are not part of the column.
+    std::vector<FF> values = { 0, 7, 0, 9, 0, 0 };
+    trace.attach_dense_column(Column::precomputed_clk, values);
+
+    EXPECT_EQ(trace.get_column_rows(Column::precomputed_clk), 4);
+    EXPECT_EQ(trace.get(Column::precomputed_clk, 1), 7);
+    EXPECT_EQ(trace.get(Column::precomputed_clk, 2), 0);
+    EXPECT_EQ(trace.get(Column::precomputed_clk, 3), 9);
+    EXPECT_EQ(trace.get(Column::precomputed_clk, 100), 0);
+
+    std::vector<std::pair<uint32_t, FF>> visited;
+    trace.visit_column(Column::precomputed_clk,
+                       [&](uint32_t row, const FF& value) { visited.emplace_back(row, value); });
+    EXPECT_THAT(visited, ElementsAre(Pair(1, 7), Pair(3, 9)));
+
+    trace.clear_column(Column::precomputed_clk);
+    EXPECT_EQ(trace.get(Column::precomputed_clk, 1), 0);
+    // The column can be used sparsely again.
+    trace.set(Column::precomputed_clk, 5, 1);
+    EXPECT_EQ(trace.get_column_rows(Column::precomputed_clk), 6);
+}
+
+} // namespace
+} // namespace bb::avm2::tracegen
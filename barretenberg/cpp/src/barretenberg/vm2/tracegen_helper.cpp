@@ -12,6 +12,7 @@
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/vm2/common/map.hpp"
 #include "barretenberg/vm2/constraining/flavor.hpp"
+#include "barretenberg/vm2/constraining/precomputed_snapshot.hpp"
 #include "barretenberg/vm2/generated/columns.hpp"
 #include "barretenberg/vm2/tooling/stats.hpp"
 #include "barretenberg/vm2/tracegen/address_derivation_trace.hpp"
@@ -153,15 +154,20 @@ template <typename T> std::vector<T> concatenate_jobs(std::vector<T>&& first, au
 
 } // namespace
 
-TraceContainer AvmTraceGenHelper::generate_trace(EventsContainer&& events)
+TraceContainer AvmTraceGenHelper::generate_trace(EventsContainer&& events,
+                                                 const constraining::PrecomputedSnapshot* precomputed_snapshot)
 {
     TraceContainer trace;
+    if (precomputed_snapshot != nullptr) {
+        AVM_TRACK_TIME("tracegen/precomputed/snapshot", precomputed_snapshot->attach_to(trace));
+    }
 
     // We process the events in parallel. Ideally the jobs should access disjoint column sets.
     {
         auto jobs = concatenate(
             // Precomputed column jobs.
-            build_precomputed_columns_jobs(trace),
+            precomputed_snapshot != nullptr ? std::vector<std::function<void()>>{}
+                                            : build_precomputed_columns_jobs(trace),
             // Subtrace jobs.
             std::vector<std::function<void()>>{
                 [&]() {
@@ -5,11 +5,18 @@
 
 namespace bb::avm2 {
 
+namespace constraining {
+class PrecomputedSnapshot;
+} // namespace constraining
+
 class AvmTraceGenHelper {
   public:
     AvmTraceGenHelper() = default;
 
-    tracegen::TraceContainer generate_trace(simulation::EventsContainer&& events);
+    // If a precomputed snapshot is given, the precomputed columns are attached from it instead of being generated.
+    // The snapshot must outlive the returned trace.
+    tracegen::TraceContainer generate_trace(simulation::EventsContainer&& events,
+                                            const constraining::PrecomputedSnapshot* precomputed_snapshot = nullptr);
     tracegen::TraceContainer generate_precomputed_columns();
 };
 
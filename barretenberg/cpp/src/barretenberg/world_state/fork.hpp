@@ -24,6 +24,8 @@ using PublicDataTree = crypto::merkle_tree::ContentAddressedIndexedTree<PublicDa
 
 using Tree = std::variant<TreeWithStore<FrTree>, TreeWithStore<NullifierTree>, TreeWithStore<PublicDataTree>>;
 
+using ForkSnapshots = std::unordered_map<MerkleTreeId, crypto::merkle_tree::ForkSnapshot>;
+
 struct Fork {
     using Id = uint64_t;
     using SharedPtr = std::shared_ptr<Fork>;
@@ -0,0 +1,139 @@
+#include "barretenberg/world_state/tree_snapshot.hpp"
+#include "barretenberg/common/serialize.hpp"
+#include "barretenberg/crypto/sha256/sha256.hpp"
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <ios>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace bb::world_state {
+
+namespace {
+// The section type and the length of its content
+constexpr size_t SECTION_PREFIX_SIZE = sizeof(uint8_t) + sizeof(uint64_t);
+} // namespace
+
+TreeSnapshotWriter::TreeSnapshotWriter(const std::string& path)
+    : path_(path)
+    , stream_(path, std::ios::binary | std::ios::trunc)
+{
+    if (!stream_.is_open()) {
+        throw std::runtime_error(format("Unable to create snapshot file ", path_));
+    }
+}
+
+void TreeSnapshotWriter::write_section(SnapshotSectionType type, const char* data, size_t size)
+{
+    std::array<uint8_t, SECTION_PREFIX_SIZE> prefix;
+    uint8_t* it = prefix.data();
+    serialize::write(it, static_cast<uint8_t>(type));
+    serialize::write(it, static_cast<uint64_t>(size));
+    const auto* bytes = reinterpret_cast<const uint8_t*>(data);
+    crypto::Sha256Hash checksum = crypto::sha256(std::vector<uint8_t>(bytes, bytes + size));
+
+    stream_.write(reinterpret_cast<const char*>(prefix.data()), static_cast<std::streamsize>(prefix.size()));
+    stream_.write(data, static_cast<std::streamsize>(size));
+    stream_.write(reinterpret_cast<const char*>(checksum.data()), static_cast<std::streamsize>(checksum.size()));
+    if (!stream_) {
+        throw std::runtime_error(format("Failed to write to snapshot file ", path_));
+    }
+}
+
+void TreeSnapshotWriter::close()
+{
+    stream_.close();
+    if (!stream_) {
+        throw std::runtime_error(format("Failed to write to snapshot file ", path_));
+    }
+}
+
+TreeSnapshotReader::TreeSnapshotReader(const std::string& path)
+    : path_(path)
+    , stream_(path, std::ios::binary)
+{
+    if (!stream_.is_open()) {
+        throw std::runtime_error(format("Unable to open snapshot file ", path_));
+    }
+}
+
+bool TreeSnapshotReader::next_section(SnapshotSectionType& type)
+{
+    std::array<uint8_t, SECTION_PREFIX_SIZE> prefix;
+    stream_.read(reinterpret_cast<char*>(prefix.data()), static_cast<std::streamsize>(prefix.size()));
+    if (stream_.gcount() == 0 && stream_.eof()) {
+        return false;
+    }
+    if (!stream_) {
+        throw std::runtime_error(format("Snapshot file ", path_, " is truncated"));
+    }
+    const uint8_t* it = prefix.data();
+    uint8_t rawType = 0;
+    uint64_t size = 0;
+    serialize::read(it, rawType);
+    serialize::read(it, size);
+    if (rawType > static_cast<uint8_t>(SnapshotSectionType::FOOTER)) {
+        throw std::runtime_error(format("Snapshot file ", path_, " contains an unknown section type ", rawType));
+    }
+    type = static_cast<SnapshotSectionType>(rawType);
+
+    crypto::Sha256Hash checksum;
+    buffer_.resize(size);
+    stream_.read(reinterpret_cast<char*>(buffer_.data()), static_cast<std::streamsize>(size));
+    stream_.read(reinterpret_cast<char*>(checksum.data()), static_cast<std::streamsize>(checksum.size()));
+    if (!stream_) {
+        throw std::runtime_error(format("Snapshot file ", path_, " is truncated"));
+    }
+    if (crypto::sha256(buffer_) != checksum) {
+        throw std::runtime_error(format("Checksum mismatch in snapshot file ", path_));
+    }
+    return true;
+}
+
+TreeSnapshotHeader TreeSnapshotReader::read_header()
+{
+    SnapshotSectionType type = SnapshotSectionType::HEADER;
+    if (!next_section(type) || type != SnapshotSectionType::HEADER) {
+        throw std::runtime_error(format("Snapshot file ", path_, " does not start with a header"));
+    }
+    TreeSnapshotHeader header;
+    read_value(header);
+    if (header.version != TREE_SNAPSHOT_VERSION) {
+        throw std::runtime_error(format("Snapshot file ", path_, " has unsupported version ", header.version));
+    }
+    return header;
+}
+
+TreeMeta check_tree_snapshot_target(LMDBTreeStore& store, const TreeSnapshotHeader& header)
+{
+    TreeMeta meta;
+    {
+        LMDBTreeStore::ReadTransaction::Ptr tx = store.create_read_transaction();
+        if (!store.read_meta_data(meta, *tx)) {
+            throw std::runtime_error(
+                format("Unable to import snapshot into tree ", store.get_name(), ", no meta data"));
+        }
+    }
+    if (header.name != meta.name || header.depth != meta.depth) {
+        throw std::runtime_error(format("Unable to import snapshot of tree ",
+                                        header.name,
+                                        " with depth ",
+                                        header.depth,
+                                        " into tree ",
+                                        meta.name,
+                                        " with depth ",
+                                        meta.depth));
+    }
+    if (meta.unfinalisedBlockHeight != 0) {
+        throw std::runtime_error(
+            format("Unable to import snapshot into tree ", meta.name, ", it already contains blocks"));
+    }
+    if (header.blockNumber == 0) {
+        throw std::runtime_error(format("Unable to import snapshot into tree ", meta.name, ", invalid block number"));
+    }
+    return meta;
+}
+
+} // namespace bb::world_state
@@ -0,0 +1,496 @@
+#pragma once
+
+#include "barretenberg/common/thread_pool.hpp"
+#include "barretenberg/crypto/merkle_tree/hash.hpp"
+#include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
+#include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_tree_store.hpp"
+#include "barretenberg/crypto/merkle_tree/node_store/tree_meta.hpp"
+#include "barretenberg/crypto/merkle_tree/signal.hpp"
+#include "barretenberg/crypto/merkle_tree/types.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/serialize/msgpack.hpp"
+#include "barretenberg/serialize/msgpack_impl.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace bb::world_state {
+
+using namespace bb::crypto::merkle_tree;
+
+const uint32_t TREE_SNAPSHOT_VERSION = 1;
+const std::string TREE_SNAPSHOT_FILE_EXTENSION = ".snapshot";
+// The number of leaves in each checksummed section of a snapshot, this is also the granularity at which an import
+// streams leaves into the database
+const size_t TREE_SNAPSHOT_LEAVES_PER_SECTION = 16 * 1024;
+// Levels with fewer nodes than this are hashed on the calling thread during an import
+const size_t TREE_SNAPSHOT_MIN_NODES_PER_BATCH = 1024;
+
+/**
+ * A tree snapshot file is a sequence of sections. Each section is its type, the big endian length of its msgpack
+ * encoded content, the content and the sha256 of the content. A snapshot has a single header section, any number of
+ * leaf sections holding the tree's leaves in index order and a single footer section.
+ */
+enum class SnapshotSectionType : uint8_t { HEADER = 0, LEAVES = 1, FOOTER = 2 };
+
+struct TreeSnapshotHeader {
+    uint32_t version;
+    std::string name;
+    uint32_t depth;
+    block_number_t blockNumber;
+    index_t size;
+    fr root;
+
+    MSGPACK_FIELDS(version, name, depth, blockNumber, size, root)
+};
+
+struct TreeSnapshotFooter {
+    index_t numLeaves;
+
+    MSGPACK_FIELDS(numLeaves)
+};
+
+/**
+ * A leaf present in the tree at the snapshot's block. The key of the leaf (its pre-image's key for indexed trees, its
+ * value otherwise) is only stored against this index if keyIndexed is set
+ */
+template <typename LeafValueType> struct TreeSnapshotLeaf {
+    index_t index;
+    fr hash;
+    bool keyIndexed;
+    std::optional<IndexedLeaf<LeafValueType>> preimage;
+
+    MSGPACK_FIELDS(index, hash, keyIndexed, preimage)
+};
+
+class TreeSnapshotWriter {
+  public:
+    TreeSnapshotWriter(const std::string& path);
+    TreeSnapshotWriter(const TreeSnapshotWriter& other) = delete;
+    TreeSnapshotWriter(TreeSnapshotWriter&& other) = delete;
+    TreeSnapshotWriter& operator=(const TreeSnapshotWriter& other) = delete;
+    TreeSnapshotWriter& operator=(TreeSnapshotWriter&& other) = delete;
+    ~TreeSnapshotWriter() = default;
+
+    template <typename T> void write_section(SnapshotSectionType type, const T& value)
+    {
+        msgpack::sbuffer buffer;
+        msgpack::pack(buffer, value);
+        write_section(type, buffer.data(), buffer.size());
+    }
+
+    void close();
+
+  private:
+    std::string path_;
+    std::ofstream stream_;
+
+    void write_section(SnapshotSectionType type, const char* data, size_t size);
+};
+
+class TreeSnapshotReader {
+  public:
+    TreeSnapshotReader(const std::string& path);
+    TreeSnapshotReader(const TreeSnapshotReader& other) = delete;
+    TreeSnapshotReader(TreeSnapshotReader&& other) = delete;
+    TreeSnapshotReader& operator=(const TreeSnapshotReader& other) = delete;
+    TreeSnapshotReader& operator=(TreeSnapshotReader&& other) = delete;
+    ~TreeSnapshotReader() = default;
+
+    // Reads the next section and verifies its checksum, returns false at the end of the file
+    bool next_section(SnapshotSectionType& type);
+
+    // Decodes the content of the section last read
+    template <typename T> void read_value(T& value)
+    {
+        msgpack::unpack(reinterpret_cast<const char*>(buffer_.data()), buffer_.size()).get().convert(value);
+    }
+
+    TreeSnapshotHeader read_header();
+
+  private:
+    std::string path_;
+    std::ifstream stream_;
+    std::vector<uint8_t> buffer_;
+};
+
+/**
+ * @brief Writes the leaves of the tree at its finalised block to a snapshot file. The leaves are found by walking the
+ * nodes beneath the block's root so they are written in index order
+ */
+template <typename LeafValueType> void export_tree_snapshot(LMDBTreeStore& store, const std::string& path)
+{
+    using IndexedLeafValueType = IndexedLeaf<LeafValueType>;
+    LMDBTreeStore::ReadTransaction::Ptr tx = store.create_read_transaction();
+    TreeMeta meta;
+    if (!store.read_meta_data(meta, *tx)) {
+        throw std::runtime_error(format("Unable to export snapshot of tree ", store.get_name(), ", no meta data"));
+    }
+    if (meta.finalisedBlockHeight == 0) {
+        throw std::runtime_error(format("Unable to export snapshot of tree ", meta.name, ", no finalised block"));
+    }
+    BlockPayload block;
+    if (!store.read_block_data(meta.finalisedBlockHeight, block, *tx)) {
+        throw std::runtime_error(format("Unable to export snapshot of tree ",
+                                        meta.name,
+                                        ". Failed to read block data for block ",
+                                        meta.finalisedBlockHeight));
+    }
+
+    TreeSnapshotWriter writer(path);
+    writer.write_section(SnapshotSectionType::HEADER,
+                         TreeSnapshotHeader{ .version = TREE_SNAPSHOT_VERSION,
+                                             .name = meta.name,
+                                             .depth = meta.depth,
+                                             .blockNumber = block.blockNumber,
+                                             .size = block.size,
+                                             .root = block.root });
+
+    struct StackObject {
+        fr hash;
+        uint32_t lvl;
+        index_t index;
+    };
+    std::vector<StackObject> stack;
+    // An empty tree has no nodes, its root is the root of the empty tree
+    if (block.size > 0) {
+        stack.push_back({ .hash = block.root, .lvl = 0, .index = 0 });
+    }
+    std::vector<TreeSnapshotLeaf<LeafValueType>> leaves;
+    leaves.reserve(TREE_SNAPSHOT_LEAVES_PER_SECTION);
+    index_t numLeaves = 0;
+
+    while (!stack.empty()) {
+        StackObject so = stack.back();
+        stack.pop_back();
+
+        if (so.lvl < meta.depth) {
+            NodePayload nodePayload;
+            if (!store.read_node(so.hash, nodePayload, *tx)) {
+                throw std::runtime_error(
+                    format("Unable to export snapshot of tree ", meta.name, ". Failed to read node ", so.hash));
+            }
+            // Absent children are empty sub-trees. The right child is pushed first so leaves are visited in order
+            if (nodePayload.right.has_value()) {
+                stack.push_back({ .hash = nodePayload.right.value(), .lvl = so.lvl + 1, .index = so.index * 2 + 1 });
+            }
+            if (nodePayload.left.has_value()) {
+                stack.push_back({ .hash = nodePayload.left.value(), .lvl = so.lvl + 1, .index = so.index * 2 });
+            }
+            continue;
+        }
+
+        TreeSnapshotLeaf<LeafValueType> leaf{ .index = so.index, .hash = so.hash, .keyIndexed = false, .preimage = {} };
+        fr key = so.hash;
+        if constexpr (requires_preimage_for_key<LeafValueType>()) {
+            IndexedLeafValueType preimage;
+            if (!store.read_leaf_by_hash(so.hash, preimage, *tx)) {
+                throw std::runtime_error(
+                    format("Unable to export snapshot of tree ", meta.name, ". Failed to read leaf ", so.hash));
+            }
+            key = preimage_to_key(preimage.leaf);
+            leaf.preimage = preimage;
+        }
+        // Keys that appear more than once are only indexed against one of their leaves
+        index_t keyIndex = 0;
+        leaf.keyIndexed = store.read_leaf_index(key, keyIndex, *tx) && keyIndex == so.index;
+        leaves.push_back(std::move(leaf));
+        ++numLeaves;
+
+        if (leaves.size() == TREE_SNAPSHOT_LEAVES_PER_SECTION) {
+            writer.write_section(SnapshotSectionType::LEAVES, leaves);
+            leaves.clear();
+        }
+    }
+    if (!leaves.empty()) {
+        writer.write_section(SnapshotSectionType::LEAVES, leaves);
+    }
+    writer.write_section(SnapshotSectionType::FOOTER, TreeSnapshotFooter{ .numLeaves = numLeaves });
+    writer.close();
+}
+
+/**
+ * @brief Computes the nodes of the level above the given one. Both levels are sparse, holding only the nodes that have
+ * leaves beneath them, and are sorted by index. Large levels are split into batches hashed by the workers
+ */
+template <typename HashingPolicy>
+void hash_snapshot_level(const std::vector<std::pair<index_t, fr>>& children,
+                         const fr& zeroHash,
+                         std::vector<std::pair<index_t, fr>>& parents,
+                         ThreadPool& workers)
+{
+    size_t maxBatches = children.size() / TREE_SNAPSHOT_MIN_NODES_PER_BATCH;
+    size_t numBatches = std::max<size_t>(1, std::min<size_t>(workers.num_threads(), maxBatches));
+    // A batch never starts with the right hand node of a pair, that would separate the pair across batches
+    std::vector<size_t> batchStarts(numBatches + 1, children.size());
+    for (size_t i = 0; i < numBatches; ++i) {
+        size_t start = (i * children.size()) / numBatches;
+        if (start > 0 && (children[start].first >> 1) == (children[start - 1].first >> 1)) {
+            ++start;
+        }
+        batchStarts[i] = start;
+    }
+
+    std::vector<std::vector<std::pair<index_t, fr>>> batchParents(numBatches);
+    auto hash_batch = [&](size_t batch) {
+        std::vector<std::pair<index_t, fr>>& output = batchParents[batch];
+        size_t end = batchStarts[batch + 1];
+        output.reserve((end - batchStarts[batch] + 1) / 2);
+        for (size_t i = batchStarts[batch]; i < end;) {
+            index_t index = children[i].first;
+            fr left = zeroHash;
+            fr right = zeroHash;
+            if ((index & 1) == 1) {
+                right = children[i++].second;
+            } else {
+                left = children[i++].second;
+                if (i < end && children[i].first == index + 1) {
+                    right = children[i++].second;
+                }
+            }
+            output.emplace_back(index >> 1, HashingPolicy::hash_pair(left, right));
+        }
+    };
+
+    if (numBatches == 1) {
+        hash_batch(0);
+    } else {
+        Signal signal(static_cast<uint32_t>(numBatches));
+        for (size_t i = 0; i < numBatches; ++i) {
+            workers.enqueue([&, i]() {
+                hash_batch(i);
+                signal.signal_decrement();
+            });
+        }
+        signal.wait_for_level(0);
+    }
+
+    parents.clear();
+    for (const auto& batch : batchParents) {
+        parents.insert(parents.end(), batch.begin(), batch.end());
+    }
+}
+
+/**
+ * @brief Checks that a snapshot can be imported into the tree, i.e. that it is a snapshot of the tree and that the tree
+ * has not yet committed any blocks. Returns the tree's meta data
+ */
+TreeMeta check_tree_snapshot_target(LMDBTreeStore& store, const TreeSnapshotHeader& header);
+
+/**
+ * @brief Reads the leaf sections and the footer following the header of a snapshot, verifying the order of the
+ * leaves, the presence of the pre-images and the number of leaves. The leaves of each section are passed to onLeaves as
+ * they are read. Returns the index and hash of every leaf
+ */
+template <typename LeafValueType, typename OnLeaves>
+std::vector<std::pair<index_t, fr>> read_tree_snapshot_leaves(TreeSnapshotReader& reader,
+                                                              const TreeSnapshotHeader& header,
+                                                              OnLeaves&& onLeaves)
+{
+    std::vector<std::pair<index_t, fr>> leafHashes;
+    std::optional<TreeSnapshotFooter> footer;
+    SnapshotSectionType type = SnapshotSectionType::HEADER;
+    while (!footer.has_value() && reader.next_section(type)) {
+        if (type == SnapshotSectionType::FOOTER) {
+            footer = TreeSnapshotFooter{};
+            reader.read_value(footer.value());
+            continue;
+        }
+        if (type != SnapshotSectionType::LEAVES) {
+            throw std::runtime_error("Unexpected section");
+        }
+        std::vector<TreeSnapshotLeaf<LeafValueType>> leaves;
+        reader.read_value(leaves);
+        for (const auto& leaf : leaves) {
+            if (leaf.index >= header.size || (!leafHashes.empty() && leaf.index <= leafHashes.back().first)) {
+                throw std::runtime_error(format("Invalid leaf index ", leaf.index));
+            }
+            if constexpr (requires_preimage_for_key<LeafValueType>()) {
+                if (!leaf.preimage.has_value()) {
+                    throw std::runtime_error(format("Missing pre-image for leaf ", leaf.index));
+                }
+            }
+            leafHashes.emplace_back(leaf.index, leaf.hash);
+        }
+        onLeaves(leaves);
+    }
+    if (!footer.has_value() || footer->numLeaves != leafHashes.size()) {
+        throw std::runtime_error("Snapshot is truncated");
+    }
+    return leafHashes;
+}
+
+/**
+ * @brief Rebuilds the tree from the leaves up and verifies the resulting root against the snapshot's. Returns the
+ * levels of the tree from the root down, each holding only the nodes with leaves beneath them
+ */
+template <typename HashingPolicy>
+std::vector<std::vector<std::pair<index_t, fr>>> rebuild_tree_snapshot_levels(
+    const TreeSnapshotHeader& header, std::vector<std::pair<index_t, fr>>&& leafHashes, ThreadPool& workers)
+{
+    const std::vector<fr>& zeroHashes = get_zero_hashes<HashingPolicy>(header.depth);
+    std::vector<std::vector<std::pair<index_t, fr>>> levels(header.depth + 1);
+    levels[header.depth] = std::move(leafHashes);
+    for (uint32_t level = header.depth; level > 0 && !levels[level].empty(); --level) {
+        hash_snapshot_level<HashingPolicy>(levels[level], zeroHashes[level], levels[level - 1], workers);
+    }
+    fr root = levels[0].empty() ? zeroHashes[0] : levels[0][0].second;
+    if (root != header.root) {
+        throw std::runtime_error(format("Rebuilt root ", root, " does not match snapshot root ", header.root));
+    }
+    return levels;
+}
+
+/**
+ * @brief Verifies a snapshot in full without writing anything: that it can be imported into the tree, the checksum of
+ * every section, the number of leaves and the root rebuilt from the leaves. Returns the snapshot's header
+ */
+template <typename LeafValueType, typename HashingPolicy>
+TreeSnapshotHeader verify_tree_snapshot(LMDBTreeStore& store, const std::string& path, ThreadPool& workers)
+{
+    TreeSnapshotReader reader(path);
+    TreeSnapshotHeader header = reader.read_header();
+    check_tree_snapshot_target(store, header);
+    try {
+        std::vector<std::pair<index_t, fr>> leafHashes =
+            read_tree_snapshot_leaves<LeafValueType>(reader, header, [](const auto&) {});
+        rebuild_tree_snapshot_levels<HashingPolicy>(header, std::move(leafHashes), workers);
+    } catch (std::exception& e) {
+        throw std::runtime_error(format("Invalid snapshot of tree ", header.name, " Error: ", e.what()));
+    }
+    return header;
+}
+
+/**
+ * @brief Bulk loads a snapshot into a tree that has not yet committed any blocks. The leaves are streamed from the file
+ * into the database, the internal nodes are then rebuilt level by level in parallel and the resulting root verified
+ * against the snapshot before anything is committed. Reference counts are assigned as if the snapshot's block had been
+ * committed on top of the tree's genesis state.
+ */
+template <typename LeafValueType, typename HashingPolicy>
+void import_tree_snapshot(LMDBTreeStore& store, const std::string& path, ThreadPool& workers)
+{
+    using IndexedLeafValueType = IndexedLeaf<LeafValueType>;
+    TreeSnapshotReader reader(path);
+    TreeSnapshotHeader header = reader.read_header();
+    TreeMeta meta = check_tree_snapshot_target(store, header);
+
+    LMDBTreeStore::WriteTransaction::Ptr tx = store.create_write_transaction();
+    try {
+        // Stream the leaves into the database, retaining only their hashes for rebuilding the tree
+        auto write_leaves = [&](const std::vector<TreeSnapshotLeaf<LeafValueType>>& leaves) {
+            std::vector<std::pair<fr, IndexedLeafValueType>> preimages;
+            std::vector<std::pair<fr, index_t>> keys;
+            for (const auto& leaf : leaves) {
+                fr key = leaf.hash;
+                if constexpr (requires_preimage_for_key<LeafValueType>()) {
+                    preimages.emplace_back(leaf.hash, leaf.preimage.value());
+                    key = preimage_to_key(leaf.preimage.value().leaf);
+                }
+                if (leaf.keyIndexed) {
+                    keys.emplace_back(key, leaf.index);
+                }
+            }
+            // Write in key order, the databases are sorted by key
+            std::sort(preimages.begin(), preimages.end(), [](const auto& a, const auto& b) {
+                return uint256_t(a.first) < uint256_t(b.first);
+            });
+            std::sort(keys.begin(), keys.end(), [](const auto& a, const auto& b) {
+                return uint256_t(a.first) < uint256_t(b.first);
+            });
+            for (const auto& [hash, preimage] : preimages) {
+                store.write_leaf_by_hash(hash, preimage, *tx);
+            }
+            for (const auto& [key, index] : keys) {
+                store.write_leaf_index(key, index, *tx);
+            }
+        };
+        std::vector<std::pair<index_t, fr>> leafHashes =
+            read_tree_snapshot_leaves<LeafValueType>(reader, header, write_leaves);
+
+        // Rebuild the tree from the leaves up
+        std::vector<std::vector<std::pair<index_t, fr>>> levels =
+            rebuild_tree_snapshot_levels<HashingPolicy>(header, std::move(leafHashes), workers);
+        const fr& root = header.root;
+
+        // Now persist the nodes from the root down. As with committing a block, a node's children are only referenced
+        // by it if the node did not previously exist
+        std::unordered_map<fr, uint64_t> references;
+        if (header.size > 0) {
+            references[root] = 1;
+        }
+        for (uint32_t level = 0; level <= header.depth && !references.empty(); ++level) {
+            std::vector<std::pair<index_t, fr>>& nodes = levels[level];
+            std::vector<std::pair<fr, NodePayload>> writes;
+            size_t child = 0;
+            for (const auto& [index, hash] : nodes) {
+                auto it = references.find(hash);
+                // Not referenced by a new parent, or a duplicate of a node already written at this level
+                if (it == references.end()) {
+                    continue;
+                }
+                NodePayload nodePayload{ .left = std::nullopt, .right = std::nullopt, .ref = it->second };
+                references.erase(it);
+                if (level < header.depth) {
+                    const std::vector<std::pair<index_t, fr>>& children = levels[level + 1];
+                    while (child < children.size() && children[child].first < index * 2) {
+                        ++child;
+                    }
+                    if (child < children.size() && children[child].first == index * 2) {
+                        nodePayload.left = children[child].second;
+                    }
+                    size_t right = nodePayload.left.has_value() ? child + 1 : child;
+                    if (right < children.size() && children[right].first == index * 2 + 1) {
+                        nodePayload.right = children[right].second;
+                    }
+                }
+                writes.emplace_back(hash, nodePayload);
+            }
+            std::sort(writes.begin(), writes.end(), [](const auto& a, const auto& b) {
+                return uint256_t(a.first) < uint256_t(b.first);
+            });
+            std::unordered_map<fr, uint64_t> childReferences;
+            for (auto& [hash, nodePayload] : writes) {
+                uint64_t increment = nodePayload.ref;
+                store.set_or_increment_node_reference_count(hash, nodePayload, *tx, increment);
+                if (nodePayload.ref != increment) {
+                    // The node already existed, the entire sub-tree beneath it is already referenced
+                    continue;
+                }
+                if (nodePayload.left.has_value()) {
+                    ++childReferences[nodePayload.left.value()];
+                }
+                if (nodePayload.right.has_value()) {
+                    ++childReferences[nodePayload.right.value()];
+                }
+            }
+            // Free the level, it is no longer needed
+            std::vector<std::pair<index_t, fr>>().swap(nodes);
+            references = std::move(childReferences);
+        }
+
+        BlockPayload block{ .size = header.size, .blockNumber = header.blockNumber, .root = root };
+        store.write_block_data(header.blockNumber, block, *tx);
+        store.write_block_index_data(header.blockNumber, header.size, *tx);
+        meta.size = header.size;
+        meta.committedSize = header.size;
+        meta.root = root;
+        meta.unfinalisedBlockHeight = header.blockNumber;
+        meta.finalisedBlockHeight = header.blockNumber;
+        meta.oldestHistoricBlock = header.blockNumber;
+        store.write_meta_data(meta, *tx);
+        tx->commit();
+    } catch (std::exception& e) {
+        tx->try_abort();
+        throw std::runtime_error(format("Unable to import snapshot into tree ", meta.name, " Error: ", e.what()));
+    }
+}
+
+} // namespace bb::world_state
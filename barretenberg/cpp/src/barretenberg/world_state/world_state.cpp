@@ -11,6 +11,7 @@
 #include "barretenberg/lmdblib/lmdb_helpers.hpp"
 #include "barretenberg/vm2/common/aztec_constants.hpp"
 #include "barretenberg/world_state/fork.hpp"
+#include "barretenberg/world_state/tree_snapshot.hpp"
 #include "barretenberg/world_state/tree_with_store.hpp"
 #include "barretenberg/world_state/types.hpp"
 #include "barretenberg/world_state/world_state_stores.hpp"
@@ -19,15 +20,18 @@
 #include <cstddef>
 #include <cstdint>
 #include <filesystem>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <ostream>
 #include <stdexcept>
+#include <string>
 #include <tuple>
 #include <unordered_map>
 #include <utility>
 #include <variant>
+#include <vector>
 
 namespace bb::world_state {
 
@@ -178,6 +182,114 @@ void WorldState::copy_stores(const std::string& dstPath, bool compact) const
     std::for_each(_persistentStores->begin(), _persistentStores->end(), copyStore);
 }
 
+namespace {
+std::string get_snapshot_path(const std::string& directory, MerkleTreeId id)
+{
+    std::filesystem::path path = directory;
+    path /= getMerkleTreeName(id) + TREE_SNAPSHOT_FILE_EXTENSION;
+    return path.string();
+}
+} // namespace
+
+void WorldState::export_snapshot(const std::string& dstPath) const
+{
+    std::filesystem::create_directories(dstPath);
+    std::vector<std::function<void()>> exports{
+        [&]() {
+            export_tree_snapshot<NullifierLeafValue>(*_persistentStores->nullifierStore,
+                                                     get_snapshot_path(dstPath, MerkleTreeId::NULLIFIER_TREE));
+        },
+        [&]() {
+            export_tree_snapshot<PublicDataLeafValue>(*_persistentStores->publicDataStore,
+                                                      get_snapshot_path(dstPath, MerkleTreeId::PUBLIC_DATA_TREE));
+        },
+        [&]() {
+            export_tree_snapshot<bb::fr>(*_persistentStores->archiveStore,
+                                         get_snapshot_path(dstPath, MerkleTreeId::ARCHIVE));
+        },
+        [&]() {
+            export_tree_snapshot<bb::fr>(*_persistentStores->noteHashStore,
+                                         get_snapshot_path(dstPath, MerkleTreeId::NOTE_HASH_TREE));
+        },
+        [&]() {
+            export_tree_snapshot<bb::fr>(*_persistentStores->messageStore,
+                                         get_snapshot_path(dstPath, MerkleTreeId::L1_TO_L2_MESSAGE_TREE));
+        },
+    };
+
+    Signal signal(static_cast<uint32_t>(exports.size()));
+    std::mutex errorMutex;
+    std::string message;
+    for (const auto& exportTree : exports) {
+        _workers->enqueue([&]() {
+            try {
+                exportTree();
+            } catch (std::exception& e) {
+                std::unique_lock lock(errorMutex);
+                if (message.empty()) {
+                    message = e.what();
+                }
+            }
+            signal.signal_decrement();
+        });
+    }
+    signal.wait_for_level(0);
+    if (!message.empty()) {
+        throw std::runtime_error(message);
+    }
+}
+
+WorldStateStatusSummary WorldState::import_snapshot(const std::string& srcPath)
+{
+    // Each tree is imported in its own transaction and a tree that has imported a snapshot can't import another. So
+    // every snapshot is verified in full, and checked to be of the same block, before modifying any tree. Otherwise a
+    // bad snapshot would leave the trees imported before it at the snapshot's block and the rest at genesis
+    std::array<TreeSnapshotHeader, NUM_TREES> headers{
+        verify_tree_snapshot<NullifierLeafValue, HashPolicy>(
+            *_persistentStores->nullifierStore, get_snapshot_path(srcPath, MerkleTreeId::NULLIFIER_TREE), *_workers),
+        verify_tree_snapshot<PublicDataLeafValue, HashPolicy>(
+            *_persistentStores->publicDataStore, get_snapshot_path(srcPath, MerkleTreeId::PUBLIC_DATA_TREE), *_workers),
+        verify_tree_snapshot<bb::fr, HashPolicy>(
+            *_persistentStores->archiveStore, get_snapshot_path(srcPath, MerkleTreeId::ARCHIVE), *_workers),
+        verify_tree_snapshot<bb::fr, HashPolicy>(
+            *_persistentStores->noteHashStore, get_snapshot_path(srcPath, MerkleTreeId::NOTE_HASH_TREE), *_workers),
+        verify_tree_snapshot<bb::fr, HashPolicy>(*_persistentStores->messageStore,
+                                                 get_snapshot_path(srcPath, MerkleTreeId::L1_TO_L2_MESSAGE_TREE),
+                                                 *_workers),
+    };
+    for (const TreeSnapshotHeader& header : headers) {
+        if (header.blockNumber != headers[0].blockNumber) {
+            throw std::runtime_error(format("Unable to import snapshot, tree ",
+                                            header.name,
+                                            " is at block ",
+                                            header.blockNumber,
+                                            " expected block ",
+                                            headers[0].blockNumber));
+        }
+    }
+
+    // Each tree is rebuilt using all of the workers so they are imported one at a time
+    import_tree_snapshot<NullifierLeafValue, HashPolicy>(
+        *_persistentStores->nullifierStore, get_snapshot_path(srcPath, MerkleTreeId::NULLIFIER_TREE), *_workers);
+    import_tree_snapshot<PublicDataLeafValue, HashPolicy>(
+        *_persistentStores->publicDataStore, get_snapshot_path(srcPath, MerkleTreeId::PUBLIC_DATA_TREE), *_workers);
+    import_tree_snapshot<bb::fr, HashPolicy>(
+        *_persistentStores->archiveStore, get_snapshot_path(srcPath, MerkleTreeId::ARCHIVE), *_workers);
+    import_tree_snapshot<bb::fr, HashPolicy>(
+        *_persistentStores->noteHashStore, get_snapshot_path(srcPath, MerkleTreeId::NOTE_HASH_TREE), *_workers);
+    import_tree_snapshot<bb::fr, HashPolicy>(*_persistentStores->messageStore,
+                                             get_snapshot_path(srcPath, MerkleTreeId::L1_TO_L2_MESSAGE_TREE),
+                                             *_workers);
+
+    // Refresh the canonical trees' view of the committed state
+    rollback();
+    invalidate_fork_snapshots();
+
+    WorldStateStatusSummary status;
+    get_status_summary(status);
+    return status;
+}
+
 Fork::SharedPtr WorldState::retrieve_fork(const uint64_t& forkId) const
 {
     std::unique_lock lock(mtx);
@@ -238,52 +350,121 @@ void WorldState::delete_fork(const uint64_t& forkId)
     }
 }
 
+namespace {
+/**
+ * @brief Creates the store for a fork of the given block. If a snapshot of the block is provided the store is created
+ * from it without reading the persisted store, otherwise the store's snapshot is captured for use by later forks
+ */
+template <typename Store>
+std::unique_ptr<Store> create_fork_store(MerkleTreeId id,
+                                         uint32_t levels,
+                                         const block_number_t& blockNumber,
+                                         const LMDBTreeStore::SharedPtr& persistentStore,
+                                         const ForkSnapshots* snapshots,
+                                         ForkSnapshots& capturedSnapshots)
+{
+    if (snapshots != nullptr) {
+        return std::make_unique<Store>(getMerkleTreeName(id), levels, snapshots->at(id), persistentStore);
+    }
+    auto store = std::make_unique<Store>(getMerkleTreeName(id), levels, blockNumber, persistentStore);
+    capturedSnapshots.insert({ id, store->get_fork_snapshot() });
+    return store;
+}
+} // namespace
+
 Fork::SharedPtr WorldState::create_new_fork(const block_number_t& blockNumber)
 {
+    // The committed state of a block does not change until the canonical state is next modified. Until then, all forks
+    // of the block share a single snapshot of it and are created without touching the persisted stores
+    std::shared_ptr<const ForkSnapshots> snapshots;
+    uint64_t generation = 0;
+    {
+        std::unique_lock lock(mtx);
+        auto it = _forkSnapshots.find(blockNumber);
+        if (it != _forkSnapshots.end()) {
+            snapshots = it->second;
+        }
+        generation = _forkSnapshotsGeneration;
+    }
+    auto capturedSnapshots = std::make_shared<ForkSnapshots>();
+
     Fork::SharedPtr fork = std::make_shared<Fork>();
     fork->_blockNumber = blockNumber;
     {
-        uint32_t levels = _tree_heights.at(MerkleTreeId::NULLIFIER_TREE);
-        index_t initial_size = _initial_tree_size.at(MerkleTreeId::NULLIFIER_TREE);
-        auto store = std::make_unique<NullifierStore>(
-            getMerkleTreeName(MerkleTreeId::NULLIFIER_TREE), levels, blockNumber, _persistentStores->nullifierStore);
+        MerkleTreeId id = MerkleTreeId::NULLIFIER_TREE;
+        index_t initial_size = _initial_tree_size.at(id);
+        auto store = create_fork_store<NullifierStore>(id,
+                                                       _tree_heights.at(id),
+                                                       blockNumber,
+                                                       _persistentStores->nullifierStore,
+                                                       snapshots.get(),
+                                                       *capturedSnapshots);
         auto tree = std::make_unique<NullifierTree>(std::move(store), _workers, initial_size);
-        fork->_trees.insert({ MerkleTreeId::NULLIFIER_TREE, TreeWithStore(std::move(tree)) });
+        fork->_trees.insert({ id, TreeWithStore(std::move(tree)) });
     }
     {
-        uint32_t levels = _tree_heights.at(MerkleTreeId::NOTE_HASH_TREE);
-        auto store = std::make_unique<FrStore>(
-            getMerkleTreeName(MerkleTreeId::NOTE_HASH_TREE), levels, blockNumber, _persistentStores->noteHashStore);
+        MerkleTreeId id = MerkleTreeId::NOTE_HASH_TREE;
+        auto store = create_fork_store<FrStore>(id,
+                                                _tree_heights.at(id),
+                                                blockNumber,
+                                                _persistentStores->noteHashStore,
+                                                snapshots.get(),
+                                                *capturedSnapshots);
         auto tree = std::make_unique<FrTree>(std::move(store), _workers);
-        fork->_trees.insert({ MerkleTreeId::NOTE_HASH_TREE, TreeWithStore(std::move(tree)) });
+        fork->_trees.insert({ id, TreeWithStore(std::move(tree)) });
     }
     {
-        uint32_t levels = _tree_heights.at(MerkleTreeId::PUBLIC_DATA_TREE);
-        index_t initial_size = _initial_tree_size.at(MerkleTreeId::PUBLIC_DATA_TREE);
-        auto store = std::make_unique<PublicDataStore>(
-            getMerkleTreeName(MerkleTreeId::PUBLIC_DATA_TREE), levels, blockNumber, _persistentStores->publicDataStore);
+        MerkleTreeId id = MerkleTreeId::PUBLIC_DATA_TREE;
+        index_t initial_size = _initial_tree_size.at(id);
+        auto store = create_fork_store<PublicDataStore>(id,
+                                                        _tree_heights.at(id),
+                                                        blockNumber,
+                                                        _persistentStores->publicDataStore,
+                                                        snapshots.get(),
+                                                        *capturedSnapshots);
         auto tree = std::make_unique<PublicDataTree>(std::move(store), _workers, initial_size);
-        fork->_trees.insert({ MerkleTreeId::PUBLIC_DATA_TREE, TreeWithStore(std::move(tree)) });
+        fork->_trees.insert({ id, TreeWithStore(std::move(tree)) });
     }
     {
-        uint32_t levels = _tree_heights.at(MerkleTreeId::L1_TO_L2_MESSAGE_TREE);
-        auto store = std::make_unique<FrStore>(getMerkleTreeName(MerkleTreeId::L1_TO_L2_MESSAGE_TREE),
-                                               levels,
-                                               blockNumber,
-                                               _persistentStores->messageStore);
+        MerkleTreeId id = MerkleTreeId::L1_TO_L2_MESSAGE_TREE;
+        auto store = create_fork_store<FrStore>(id,
+                                                _tree_heights.at(id),
+                                                blockNumber,
+                                                _persistentStores->messageStore,
+                                                snapshots.get(),
+                                                *capturedSnapshots);
         auto tree = std::make_unique<FrTree>(std::move(store), _workers);
-        fork->_trees.insert({ MerkleTreeId::L1_TO_L2_MESSAGE_TREE, TreeWithStore(std::move(tree)) });
+        fork->_trees.insert({ id, TreeWithStore(std::move(tree)) });
     }
     {
-        uint32_t levels = _tree_heights.at(MerkleTreeId::ARCHIVE);
-        auto store = std::make_unique<FrStore>(
-            getMerkleTreeName(MerkleTreeId::ARCHIVE), levels, blockNumber, _persistentStores->archiveStore);
+        MerkleTreeId id = MerkleTreeId::ARCHIVE;
+        auto store = create_fork_store<FrStore>(id,
+                                                _tree_heights.at(id),
+                                                blockNumber,
+                                                _persistentStores->archiveStore,
+                                                snapshots.get(),
+                                                *capturedSnapshots);
         auto tree = std::make_unique<FrTree>(std::move(store), _workers);
-        fork->_trees.insert({ MerkleTreeId::ARCHIVE, TreeWithStore(std::move(tree)) });
+        fork->_trees.insert({ id, TreeWithStore(std::move(tree)) });
+    }
+
+    if (!snapshots) {
+        // Only publish the snapshot if the canonical state has not changed whilst we were reading it
+        std::unique_lock lock(mtx);
+        if (generation == _forkSnapshotsGeneration) {
+            _forkSnapshots.insert({ blockNumber, capturedSnapshots });
+        }
     }
     return fork;
 }
 
+void WorldState::invalidate_fork_snapshots()
+{
+    std::unique_lock lock(mtx);
+    _forkSnapshots.clear();
+    _forkSnapshotsGeneration++;
+}
+
 TreeMetaResponse WorldState::get_tree_info(const WorldStateRevision& revision, MerkleTreeId tree_id) const
 {
     Fork::SharedPtr fork = retrieve_fork(revision.forkId);
@@ -556,6 +737,7 @@ std::pair<bool, std::string> WorldState::commit(WorldStateStatusFull& status)
     }
 
     signal.wait_for_level(0);
+    invalidate_fork_snapshots();
     return std::make_pair(success.load(), message);
 }
 
@@ -783,6 +965,7 @@ bool WorldState::set_finalised_block(const block_number_t& blockNumber)
             tree);
     }
     signal.wait_for_level();
+    invalidate_fork_snapshots();
     for (auto& m : local) {
         if (!m.success) {
             throw std::runtime_error(m.message);
@@ -850,6 +1033,7 @@ bool WorldState::unwind_block(const block_number_t& blockNumber, WorldStateStatu
                     blockNumber);
     }
     signal.wait_for_level();
+    invalidate_fork_snapshots();
     if (!success) {
         throw std::runtime_error(message);
     }
@@ -916,6 +1100,7 @@ bool WorldState::remove_historical_block(const block_number_t& blockNumber, Worl
                                        blockNumber);
     }
     signal.wait_for_level();
+    invalidate_fork_snapshots();
     if (!success) {
         throw std::runtime_error(message);
     }
@@ -96,6 +96,20 @@ class WorldState {
      */
     void copy_stores(const std::string& dstPath, bool compact) const;
 
+    /**
+     * @brief Writes a snapshot of each tree at the finalised block to the target directory
+     *
+     * @param dstPath Folder where the snapshot files will be written
+     */
+    void export_snapshot(const std::string& dstPath) const;
+
+    /**
+     * @brief Bulk loads the snapshots in the given directory. The world state must not yet have synched any blocks
+     *
+     * @param srcPath Folder containing the snapshot files of every tree
+     */
+    WorldStateStatusSummary import_snapshot(const std::string& srcPath);
+
     /**
      * @brief Get tree metadata for a particular tree
      *
@@ -286,6 +300,10 @@ class WorldState {
     mutable std::mutex mtx;
     std::unordered_map<uint64_t, Fork::SharedPtr> _forks;
     uint64_t _forkId = 0;
+    // The state that forks of each block are created from, captured by the first fork of a block since the canonical
+    // state last changed. Accessed under mtx
+    std::unordered_map<block_number_t, std::shared_ptr<const ForkSnapshots>> _forkSnapshots;
+    uint64_t _forkSnapshotsGeneration = 0;
     uint32_t _initial_header_generator_point;
 
     TreeStateReference get_tree_snapshot(MerkleTreeId id);
@@ -297,6 +315,7 @@ class WorldState {
     Fork::SharedPtr retrieve_fork(const uint64_t& forkId) const;
     Fork::SharedPtr create_new_fork(const block_number_t& blockNumber);
     void remove_forks_for_block(const block_number_t& blockNumber);
+    void invalidate_fork_snapshots();
 
     bool unwind_block(const block_number_t& blockNumber, WorldStateStatusFull& status);
     bool remove_historical_block(const block_number_t& blockNumber, WorldStateStatusFull& status);
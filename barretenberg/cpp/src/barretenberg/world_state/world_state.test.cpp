@@ -10,6 +10,7 @@
 #include <array>
 #include <cstdint>
 #include <filesystem>
+#include <fstream>
 #include <gtest/gtest.h>
 #include <optional>
 #include <stdexcept>
@@ -890,6 +891,59 @@ TEST_F(WorldStateTest, BuildsABlockInAFork)
     EXPECT_EQ(fork_state_ref, ws.get_state_reference(WorldStateRevision::committed()));
 }
 
+TEST_F(WorldStateTest, ForksOfTheSameBlockAreIndependent)
+{
+    WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+    auto initial_state_ref = ws.get_state_reference(WorldStateRevision::committed());
+
+    // The second fork of block 0 is created from the state captured by the first, it must not see the first's changes
+    auto fork_1 = ws.create_fork(0);
+    ws.append_leaves<bb::fr>(MerkleTreeId::NOTE_HASH_TREE, { 42 }, fork_1);
+    ws.batch_insert_indexed_leaves<NullifierLeafValue>(MerkleTreeId::NULLIFIER_TREE, { { 129 } }, 0, fork_1);
+    auto fork_2 = ws.create_fork(0);
+    EXPECT_EQ(ws.get_state_reference(WorldStateRevision{ .forkId = fork_2, .includeUncommitted = true }),
+              initial_state_ref);
+    for (auto tree_id : { MerkleTreeId::NULLIFIER_TREE,
+                          MerkleTreeId::NOTE_HASH_TREE,
+                          MerkleTreeId::PUBLIC_DATA_TREE,
+                          MerkleTreeId::L1_TO_L2_MESSAGE_TREE,
+                          MerkleTreeId::ARCHIVE }) {
+        EXPECT_EQ(ws.get_tree_info(WorldStateRevision{ .forkId = fork_2, .includeUncommitted = true }, tree_id).meta,
+                  ws.get_tree_info(WorldStateRevision{ .forkId = fork_1, .includeUncommitted = false }, tree_id).meta);
+    }
+    ws.append_leaves<bb::fr>(MerkleTreeId::NOTE_HASH_TREE, { 43 }, fork_2);
+    assert_leaf_value<bb::fr>(
+        ws, WorldStateRevision{ .forkId = fork_1, .includeUncommitted = true }, MerkleTreeId::NOTE_HASH_TREE, 0, 42);
+    assert_leaf_value<bb::fr>(
+        ws, WorldStateRevision{ .forkId = fork_2, .includeUncommitted = true }, MerkleTreeId::NOTE_HASH_TREE, 0, 43);
+    ws.delete_fork(fork_1);
+    ws.delete_fork(fork_2);
+
+    // Sync block 1, fork it, then replace it with a different block 1. Forks of block 1 must follow the canonical state
+    auto build_block = [&](const bb::fr& note_hash) {
+        auto fork_id = ws.create_fork(0);
+        ws.append_leaves<bb::fr>(MerkleTreeId::NOTE_HASH_TREE, { note_hash }, fork_id);
+        auto state_ref = ws.get_state_reference(WorldStateRevision{ .forkId = fork_id, .includeUncommitted = true });
+        ws.update_archive(state_ref, { note_hash }, fork_id);
+        ws.delete_fork(fork_id);
+        return state_ref;
+    };
+    auto block_1_state_ref = build_block(44);
+    ws.sync_block(block_1_state_ref, { 44 }, { 44 }, {}, {}, {});
+    auto fork_3 = ws.create_fork(1);
+    EXPECT_EQ(ws.get_state_reference(WorldStateRevision{ .forkId = fork_3, .includeUncommitted = true }),
+              block_1_state_ref);
+
+    ws.unwind_blocks(0);
+    auto replacement_block_1_state_ref = build_block(45);
+    ws.sync_block(replacement_block_1_state_ref, { 45 }, { 45 }, {}, {}, {});
+    auto fork_4 = ws.create_fork(1);
+    EXPECT_EQ(ws.get_state_reference(WorldStateRevision{ .forkId = fork_4, .includeUncommitted = true }),
+              replacement_block_1_state_ref);
+    assert_leaf_value<bb::fr>(
+        ws, WorldStateRevision{ .forkId = fork_4, .includeUncommitted = true }, MerkleTreeId::NOTE_HASH_TREE, 0, 45);
+}
+
 TEST_F(WorldStateTest, GetBlockForIndex)
 {
     WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
@@ -929,3 +983,127 @@ TEST_F(WorldStateTest, GetBlockForIndex)
         EXPECT_EQ(blockNumbers[0].value(), 1);
     }
 }
+
+TEST_F(WorldStateTest, ExportAndImportSnapshot)
+{
+    WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+
+    auto append_block = [](WorldState& state, uint64_t seed) {
+        WorldStateStatusFull status;
+        state.append_leaves<fr>(MerkleTreeId::NOTE_HASH_TREE, { fr(seed), fr(0), fr(seed + 1) });
+        state.append_leaves<fr>(MerkleTreeId::L1_TO_L2_MESSAGE_TREE, { fr(seed + 2) });
+        state.append_leaves<fr>(MerkleTreeId::ARCHIVE, { fr(seed + 3) });
+        state.batch_insert_indexed_leaves<NullifierLeafValue>(
+            MerkleTreeId::NULLIFIER_TREE, { NullifierLeafValue(seed + 4), NullifierLeafValue(seed * 3 + 5) }, 1);
+        state.batch_insert_indexed_leaves<PublicDataLeafValue>(
+            MerkleTreeId::PUBLIC_DATA_TREE, { PublicDataLeafValue(seed + 6, seed), PublicDataLeafValue(7, seed) }, 1);
+        state.commit(status);
+    };
+
+    for (uint64_t block = 1; block <= 4; block++) {
+        append_block(ws, block * 1000);
+    }
+    ws.set_finalised_blocks(3);
+
+    std::string snapshot_dir = random_temp_directory();
+    ws.export_snapshot(snapshot_dir);
+
+    std::string import_dir = random_temp_directory();
+    std::filesystem::create_directories(import_dir);
+    WorldState imported(
+        thread_pool_size, import_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+    WorldStateStatusSummary summary = imported.import_snapshot(snapshot_dir);
+    EXPECT_EQ(summary, WorldStateStatusSummary(3, 3, 3, true));
+
+    WorldStateRevision finalised{ .forkId = CANONICAL_FORK_ID, .blockNumber = 3, .includeUncommitted = false };
+    EXPECT_EQ(imported.get_state_reference(WorldStateRevision::committed()), ws.get_state_reference(finalised));
+
+    for (auto tree_id : { MerkleTreeId::NULLIFIER_TREE,
+                          MerkleTreeId::NOTE_HASH_TREE,
+                          MerkleTreeId::PUBLIC_DATA_TREE,
+                          MerkleTreeId::L1_TO_L2_MESSAGE_TREE,
+                          MerkleTreeId::ARCHIVE }) {
+        index_t size = ws.get_tree_info(finalised, tree_id).meta.size;
+        for (index_t i : { index_t(0), index_t(1), size - 1 }) {
+            EXPECT_EQ(imported.get_sibling_path(WorldStateRevision::committed(), tree_id, i),
+                      ws.get_sibling_path(finalised, tree_id, i));
+        }
+    }
+
+    for (uint64_t value : { 1000UL, 3004UL, 3005UL, 9009UL }) {
+        EXPECT_EQ(imported.find_low_leaf_index(WorldStateRevision::committed(), MerkleTreeId::NULLIFIER_TREE, value),
+                  ws.find_low_leaf_index(finalised, MerkleTreeId::NULLIFIER_TREE, value));
+    }
+    GetLowIndexedLeafResponse slot =
+        ws.find_low_leaf_index(finalised, MerkleTreeId::PUBLIC_DATA_TREE, PublicDataLeafValue(7, 0).get_key());
+    EXPECT_TRUE(slot.is_already_present);
+    assert_leaf_value(imported,
+                      WorldStateRevision::committed(),
+                      MerkleTreeId::PUBLIC_DATA_TREE,
+                      slot.index,
+                      PublicDataLeafValue(7, 3000));
+    assert_leaf_index(imported, WorldStateRevision::committed(), MerkleTreeId::NOTE_HASH_TREE, fr(2001), 5);
+    assert_leaf_index(
+        imported, WorldStateRevision::committed(), MerkleTreeId::NULLIFIER_TREE, NullifierLeafValue(3004), 132);
+
+    // the imported state continues from the snapshot block exactly like the original
+    append_block(imported, 4000);
+    EXPECT_EQ(imported.get_state_reference(WorldStateRevision::committed()),
+              ws.get_state_reference(WorldStateRevision::committed()));
+
+    std::filesystem::remove_all(snapshot_dir);
+    std::filesystem::remove_all(import_dir);
+}
+
+TEST_F(WorldStateTest, ImportRejectsCorruptedSnapshot)
+{
+    WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+    WorldStateStatusFull status;
+    ws.append_leaves<fr>(MerkleTreeId::NOTE_HASH_TREE, { fr(42) });
+    ws.commit(status);
+    ws.set_finalised_blocks(1);
+
+    std::string snapshot_dir = random_temp_directory();
+    ws.export_snapshot(snapshot_dir);
+
+    // flip the last byte of the note hash tree's leaves checksum
+    std::string path = (std::filesystem::path(snapshot_dir) / "NoteHashTree.snapshot").string();
+    {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekg(-1, std::ios::end);
+        char last = 0;
+        file.read(&last, 1);
+        file.seekp(-1, std::ios::end);
+        last = static_cast<char>(last ^ 0xff);
+        file.write(&last, 1);
+    }
+
+    std::string import_dir = random_temp_directory();
+    std::filesystem::create_directories(import_dir);
+    WorldState imported(
+        thread_pool_size, import_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+    StateReference genesis = imported.get_state_reference(WorldStateRevision::committed());
+    EXPECT_THROW(imported.import_snapshot(snapshot_dir), std::runtime_error);
+
+    // the trees imported before the corrupted one must not have been modified
+    EXPECT_EQ(imported.get_state_reference(WorldStateRevision::committed()), genesis);
+    for (auto tree_id : { MerkleTreeId::NULLIFIER_TREE,
+                          MerkleTreeId::NOTE_HASH_TREE,
+                          MerkleTreeId::PUBLIC_DATA_TREE,
+                          MerkleTreeId::L1_TO_L2_MESSAGE_TREE,
+                          MerkleTreeId::ARCHIVE }) {
+        EXPECT_EQ(imported.get_tree_info(WorldStateRevision::committed(), tree_id).meta.unfinalisedBlockHeight, 0);
+    }
+
+    // so the import can be retried with a good snapshot
+    std::string good_snapshot_dir = random_temp_directory();
+    ws.export_snapshot(good_snapshot_dir);
+    WorldStateStatusSummary summary = imported.import_snapshot(good_snapshot_dir);
+    EXPECT_EQ(summary, WorldStateStatusSummary(1, 1, 1, true));
+    EXPECT_EQ(imported.get_state_reference(WorldStateRevision::committed()),
+              ws.get_state_reference(WorldStateRevision::committed()));
+
+    std::filesystem::remove_all(snapshot_dir);
+    std::filesystem::remove_all(good_snapshot_dir);
+    std::filesystem::remove_all(import_dir);
+}
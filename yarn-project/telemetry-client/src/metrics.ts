@@ -158,7 +158,12 @@ export const WORLD_STATE_FINALISED_HEIGHT = 'aztec.world_state.finalised_height'
 export const WORLD_STATE_OLDEST_BLOCK = 'aztec.world_state.oldest_block';
 export const WORLD_STATE_DB_USED_SIZE = 'aztec.world_state.db_used_size';
 export const WORLD_STATE_DB_NUM_ITEMS = 'aztec.world_state.db_num_items';
+export const WORLD_STATE_CACHE_HIT_RATIO = 'aztec.world_state.cache_hit_ratio';
+export const WORLD_STATE_CACHE_NUM_ITEMS = 'aztec.world_state.cache_num_items';
 export const WORLD_STATE_REQUEST_TIME = 'aztec.world_state.request_time';
+export const WORLD_STATE_REQUEST_COUNT = 'aztec.world_state.request_count';
+export const WORLD_STATE_REQUEST_EXECUTION_TIME = 'aztec.world_state.request_execution_time';
+export const WORLD_STATE_REQUEST_BATCH_SIZE = 'aztec.world_state.request_batch_size';
 export const WORLD_STATE_CRITICAL_ERROR_COUNT = 'aztec.world_state.critical_error_count';
 
 export const PROOF_VERIFIER_COUNT = 'aztec.proof_verifier.count';
@@ -11,6 +11,7 @@ import {
 } from '@aztec/telemetry-client';
 
 import {
+  type CacheStats,
   type DBStats,
   type TreeDBStats,
   type TreeMeta,
@@ -38,7 +39,12 @@ export class WorldStateInstrumentation {
   private oldestBlock: Gauge;
   private dbNumItems: Gauge;
   private dbUsedSize: Gauge;
+  private cacheHitRatio: Gauge;
+  private cacheNumItems: Gauge;
   private requestHistogram: Histogram;
+  private requestCount: UpDownCounter;
+  private requestExecutionHistogram: Histogram;
+  private batchSizeHistogram: Histogram;
   private criticalErrors: UpDownCounter;
 
   constructor(
@@ -86,12 +92,38 @@ export class WorldStateInstrumentation {
       valueType: ValueType.INT,
     });
 
+    this.cacheHitRatio = meter.createGauge(Metrics.WORLD_STATE_CACHE_HIT_RATIO, {
+      description: `The ratio of committed reads served from the cache for each db of each merkle tree`,
+      valueType: ValueType.DOUBLE,
+    });
+
+    this.cacheNumItems = meter.createGauge(Metrics.WORLD_STATE_CACHE_NUM_ITEMS, {
+      description: `The current number of items in the committed data cache for each db of each merkle tree`,
+      valueType: ValueType.INT,
+    });
+
     this.requestHistogram = meter.createHistogram(Metrics.WORLD_STATE_REQUEST_TIME, {
       description: 'The round trip time of world state requests',
       unit: 'us',
       valueType: ValueType.INT,
     });
 
+    this.requestCount = meter.createUpDownCounter(Metrics.WORLD_STATE_REQUEST_COUNT, {
+      description: 'The number of world state requests of each type',
+      valueType: ValueType.INT,
+    });
+
+    this.requestExecutionHistogram = meter.createHistogram(Metrics.WORLD_STATE_REQUEST_EXECUTION_TIME, {
+      description: 'The native execution time of batched world state requests',
+      unit: 'us',
+      valueType: ValueType.INT,
+    });
+
+    this.batchSizeHistogram = meter.createHistogram(Metrics.WORLD_STATE_REQUEST_BATCH_SIZE, {
+      description: 'The number of requests sent to the native world state in a single batch',
+      valueType: ValueType.INT,
+    });
+
     this.criticalErrors = meter.createUpDownCounter(Metrics.WORLD_STATE_CRITICAL_ERROR_COUNT, {
       description: 'The number of critical errors in the world state',
       valueType: ValueType.INT,
@@ -123,6 +155,9 @@ export class WorldStateInstrumentation {
     this.updateTreeDBStats(treeDbStats.leafIndicesDBStats, 'leaf_indices', tree);
     this.updateTreeDBStats(treeDbStats.leafPreimagesDBStats, 'leaf_preimage', tree);
     this.updateTreeDBStats(treeDbStats.nodesDBStats, 'nodes', tree);
+
+    this.updateTreeCacheStats(treeDbStats.leafPreimagesCacheStats, 'leaf_preimage', tree);
+    this.updateTreeCacheStats(treeDbStats.nodesCacheStats, 'nodes', tree);
   }
 
   private updateTreeDBStats(dbStats: DBStats, dbType: DBTypeString, tree: MerkleTreeId) {
@@ -136,6 +171,18 @@ export class WorldStateInstrumentation {
     });
   }
 
+  private updateTreeCacheStats(cacheStats: CacheStats, dbType: DBTypeString, tree: MerkleTreeId) {
+    const lookups = Number(cacheStats.hits + cacheStats.misses);
+    this.cacheHitRatio.record(lookups === 0 ? 0 : Number(cacheStats.hits) / lookups, {
+      [Attributes.WS_DB_DATA_TYPE]: dbType,
+      [Attributes.MERKLE_TREE_NAME]: MerkleTreeId[tree],
+    });
+    this.cacheNumItems.record(Number(cacheStats.numItems), {
+      [Attributes.WS_DB_DATA_TYPE]: dbType,
+      [Attributes.MERKLE_TREE_NAME]: MerkleTreeId[tree],
+    });
+  }
+
   public updateWorldStateMetrics(worldStateStatus: WorldStateStatusFull) {
     this.updateTreeStats(
       worldStateStatus.dbStats.archiveTreeStats,
@@ -169,6 +216,9 @@ export class WorldStateInstrumentation {
   }
 
   public recordRoundTrip(timeUs: number, request: WorldStateMessageType) {
+    this.requestCount.add(1, {
+      [Attributes.WORLD_STATE_REQUEST_TYPE]: WorldStateMessageType[request],
+    });
     if (!durationTrackDenylist.has(request)) {
       this.requestHistogram.record(Math.ceil(timeUs), {
         [Attributes.WORLD_STATE_REQUEST_TYPE]: WorldStateMessageType[request],
@@ -176,6 +226,16 @@ export class WorldStateInstrumentation {
     }
   }
 
+  public recordExecutionTime(timeUs: number, request: WorldStateMessageType) {
+    this.requestExecutionHistogram.record(Math.ceil(timeUs), {
+      [Attributes.WORLD_STATE_REQUEST_TYPE]: WorldStateMessageType[request],
+    });
+  }
+
+  public recordBatchSize(size: number) {
+    this.batchSizeHistogram.record(size);
+  }
+
   public incCriticalErrors(
     errorType: 'synch_pending_block' | 'finalize_block' | 'prune_pending_block' | 'prune_historical_block',
   ) {
@@ -42,6 +42,10 @@ export enum WorldStateMessageType {
   REVERT_CHECKPOINT,
 
   COPY_STORES,
+  EXPORT_SNAPSHOT,
+  IMPORT_SNAPSHOT,
+
+  BATCH,
 
   CLOSE = 999,
 }
@@ -93,6 +97,17 @@ export interface DBStats {
   totalUsedSize: bigint;
 }
 
+export interface CacheStats {
+  /** The number of lookups served from the cache */
+  hits: bigint;
+  /** The number of lookups that had to go to the DB */
+  misses: bigint;
+  /** The number of entries currently held by the cache */
+  numItems: bigint;
+  /** The maximum number of entries the cache will hold */
+  capacity: bigint;
+}
+
 export interface TreeDBStats {
   /** The configured max size of the DB mapping file (effectively the max possible size of the DB) */
   mapSize: bigint;
@@ -108,6 +123,10 @@ export interface TreeDBStats {
   leafIndicesDBStats: DBStats;
   /** Stats for the 'block indices' DB */
   blockIndicesDBStats: DBStats;
+  /** Stats for the cache of committed nodes */
+  nodesCacheStats: CacheStats;
+  /** Stats for the cache of committed leaf pre-images */
+  leafPreimagesCacheStats: CacheStats;
 }
 
 export interface WorldStateMeta {
@@ -150,6 +169,15 @@ export function buildEmptyDBStats() {
   } as DBStats;
 }
 
+export function buildEmptyCacheStats() {
+  return {
+    hits: 0n,
+    misses: 0n,
+    numItems: 0n,
+    capacity: 0n,
+  } as CacheStats;
+}
+
 export function buildEmptyTreeDBStats() {
   return {
     mapSize: 0n,
@@ -160,6 +188,8 @@ export function buildEmptyTreeDBStats() {
     leafKeysDBStats: buildEmptyDBStats(),
     leafPreimagesDBStats: buildEmptyDBStats(),
     blockIndicesDBStats: buildEmptyDBStats(),
+    nodesCacheStats: buildEmptyCacheStats(),
+    leafPreimagesCacheStats: buildEmptyCacheStats(),
   } as TreeDBStats;
 }
 
@@ -228,6 +258,14 @@ export function sanitiseDBStats(stats: DBStats) {
   return stats;
 }
 
+export function sanitiseCacheStats(stats: CacheStats) {
+  stats.hits = BigInt(stats.hits);
+  stats.misses = BigInt(stats.misses);
+  stats.numItems = BigInt(stats.numItems);
+  stats.capacity = BigInt(stats.capacity);
+  return stats;
+}
+
 export function sanitiseMeta(meta: TreeMeta) {
   meta.committedSize = BigInt(meta.committedSize);
   meta.finalisedBlockHeight = BigInt(meta.finalisedBlockHeight);
@@ -244,6 +282,8 @@ export function sanitiseTreeDBStats(stats: TreeDBStats) {
   stats.leafPreimagesDBStats = sanitiseDBStats(stats.leafPreimagesDBStats);
   stats.blockIndicesDBStats = sanitiseDBStats(stats.blockIndicesDBStats);
   stats.nodesDBStats = sanitiseDBStats(stats.nodesDBStats);
+  stats.nodesCacheStats = sanitiseCacheStats(stats.nodesCacheStats);
+  stats.leafPreimagesCacheStats = sanitiseCacheStats(stats.leafPreimagesCacheStats);
   stats.mapSize = BigInt(stats.mapSize);
   stats.physicalFileSize = BigInt(stats.physicalFileSize);
   return stats;
@@ -420,6 +460,38 @@ interface CopyStoresRequest extends WithCanonicalForkId {
   compact: boolean;
 }
 
+interface ExportSnapshotRequest extends WithCanonicalForkId {
+  dstPath: string;
+}
+
+interface ImportSnapshotRequest extends WithCanonicalForkId {
+  srcPath: string;
+}
+
+/** A complete request message carried by a batch */
+export interface BatchedMessage {
+  msgType: WorldStateMessageType;
+  header: { messageId: number; requestId: number };
+  value: any;
+}
+
+interface BatchRequest {
+  requests: BatchedMessage[];
+}
+
+export interface BatchResponseEntry {
+  success: boolean;
+  error: string;
+  /** The time taken to execute the request natively */
+  durationUs: number | bigint;
+  /** The complete response message, null if the request failed */
+  response: BatchedMessage | null;
+}
+
+interface BatchResponse {
+  responses: BatchResponseEntry[];
+}
+
 export type WorldStateRequestCategories = WithForkId | WithWorldStateRevision | WithCanonicalForkId;
 
 export function isWithForkId(body: WorldStateRequestCategories): body is WithForkId {
@@ -472,6 +544,10 @@ export type WorldStateRequest = {
   [WorldStateMessageType.REVERT_CHECKPOINT]: WithForkId;
 
   [WorldStateMessageType.COPY_STORES]: CopyStoresRequest;
+  [WorldStateMessageType.EXPORT_SNAPSHOT]: ExportSnapshotRequest;
+  [WorldStateMessageType.IMPORT_SNAPSHOT]: ImportSnapshotRequest;
+
+  [WorldStateMessageType.BATCH]: BatchRequest;
 
   [WorldStateMessageType.CLOSE]: WithCanonicalForkId;
 };
@@ -514,6 +590,10 @@ export type WorldStateResponse = {
   [WorldStateMessageType.REVERT_CHECKPOINT]: void;
 
   [WorldStateMessageType.COPY_STORES]: void;
+  [WorldStateMessageType.EXPORT_SNAPSHOT]: void;
+  [WorldStateMessageType.IMPORT_SNAPSHOT]: WorldStateStatusSummary;
+
+  [WorldStateMessageType.BATCH]: BatchResponse;
 
   [WorldStateMessageType.CLOSE]: void;
 };
@@ -881,6 +881,31 @@ describe('NativeWorldState', () => {
 
       await Promise.all([setupFork.close(), testFork.close()]);
     }, 30_000);
+
+    it('rejects failed reads individually when batched', async () => {
+      const fork = await ws.fork();
+      const { block, messages } = await mockBlock(1, 8, fork);
+      await ws.handleL2BlockAndMessages(block, messages);
+
+      const committed = ws.getCommitted();
+      const expectedPath = await committed.getSiblingPath(MerkleTreeId.NOTE_HASH_TREE, 0n);
+      const expectedInfo = await committed.getTreeInfo(MerkleTreeId.NULLIFIER_TREE);
+
+      // issued in the same tick, these are sent to the native module as one batch
+      const results = await Promise.allSettled([
+        ...Array.from({ length: 8 }, () => committed.getSiblingPath(MerkleTreeId.NOTE_HASH_TREE, 0n)),
+        ws.getSnapshot(10).getSiblingPath(MerkleTreeId.NOTE_HASH_TREE, 0n),
+        committed.getTreeInfo(MerkleTreeId.NULLIFIER_TREE),
+      ]);
+
+      for (const result of results.slice(0, 8)) {
+        expect(result).toEqual({ status: 'fulfilled', value: expectedPath });
+      }
+      expect(results[8].status).toEqual('rejected');
+      expect(results[9]).toEqual({ status: 'fulfilled', value: expectedInfo });
+
+      await fork.close();
+    });
   });
 
   describe('Checkpoints', () => {
@@ -329,6 +329,28 @@ export class NativeWorldStateService implements MerkleTreeDatabase {
     });
     return fromEntries(NATIVE_WORLD_STATE_DBS.map(([name, dir]) => [name, join(dstPath, dir, 'data.mdb')] as const));
   }
+
+  /**
+   * Writes a compact, checksummed snapshot of every tree at the finalised block
+   * @param dstPath The directory the snapshot files are written to
+   */
+  public async exportSnapshot(dstPath: string) {
+    await this.instance.call(WorldStateMessageType.EXPORT_SNAPSHOT, { dstPath, canonical: true });
+  }
+
+  /**
+   * Bulk loads a snapshot written by exportSnapshot. Only valid on a world state that has not synched any blocks
+   * @param srcPath The directory containing the snapshot files
+   * @returns The new WorldStateStatus
+   */
+  public async importSnapshot(srcPath: string) {
+    return await this.instance.call(
+      WorldStateMessageType.IMPORT_SNAPSHOT,
+      { srcPath, canonical: true },
+      this.sanitiseAndCacheSummary.bind(this),
+      this.deleteCachedSummary.bind(this),
+    );
+  }
 }
 
 // The following paths are defined in cpp-land
@@ -9,7 +9,8 @@ import {
   PUBLIC_DATA_TREE_HEIGHT,
 } from '@aztec/constants';
 import { type Logger, createLogger } from '@aztec/foundation/log';
-import { NativeWorldState as BaseNativeWorldState, MsgpackChannel } from '@aztec/native';
+import { MessageHeader, TypedMessage } from '@aztec/foundation/message';
+import { NativeWorldState as BaseNativeWorldState, MsgpackChannel, type RoundtripDuration } from '@aztec/native';
 import { MerkleTreeId } from '@aztec/stdlib/trees';
 import type { PublicDataTreeLeaf } from '@aztec/stdlib/trees';
 
@@ -18,6 +19,7 @@ import { cpus } from 'os';
 
 import type { WorldStateInstrumentation } from '../instrumentation/instrumentation.js';
 import {
+  type BatchedMessage,
   WorldStateMessageType,
   type WorldStateRequest,
   type WorldStateRequestCategories,
@@ -30,6 +32,31 @@ import { WorldStateOpsQueue } from './world_state_ops_queue.js';
 
 const MAX_WORLD_STATE_THREADS = +(process.env.HARDWARE_CONCURRENCY || '16');
 
+// The maximum number of requests sent to the native module in a single batch
+const MAX_BATCH_SIZE = 64;
+
+// Read only requests, those issued in the same tick of the event loop are sent to the native module as one batch
+// and executed concurrently there
+export const BATCHED_MSG_TYPES = new Set([
+  WorldStateMessageType.GET_TREE_INFO,
+  WorldStateMessageType.GET_STATE_REFERENCE,
+  WorldStateMessageType.GET_INITIAL_STATE_REFERENCE,
+  WorldStateMessageType.GET_LEAF_VALUE,
+  WorldStateMessageType.GET_LEAF_PREIMAGE,
+  WorldStateMessageType.GET_SIBLING_PATH,
+  WorldStateMessageType.GET_BLOCK_NUMBERS_FOR_LEAF_INDICES,
+  WorldStateMessageType.FIND_LEAF_INDICES,
+  WorldStateMessageType.FIND_LOW_LEAF,
+  WorldStateMessageType.GET_STATUS,
+]);
+
+type PendingBatchedRequest = {
+  message: BatchedMessage;
+  start: bigint;
+  resolve: (result: { duration: RoundtripDuration; response: any }) => void;
+  reject: (error: Error) => void;
+};
+
 export interface NativeWorldStateInstance {
   call<T extends WorldStateMessageType>(
     messageType: T,
@@ -48,6 +75,11 @@ export class NativeWorldState implements NativeWorldStateInstance {
 
   private instance: MsgpackChannel<WorldStateMessageType, WorldStateRequest, WorldStateResponse>;
 
+  // Read only requests waiting to be sent in the next batch
+  private pendingBatch: PendingBatchedRequest[] = [];
+  private batchFlushScheduled = false;
+  private batchedMsgId = 1;
+
   /** Creates a new native WorldState instance */
   constructor(
     dataDir: string,
@@ -222,7 +254,9 @@ export class NativeWorldState implements NativeWorldStateInstance {
     }
 
     try {
-      const { duration, response } = await this.instance.sendMessage(messageType, body);
+      const { duration, response } = BATCHED_MSG_TYPES.has(messageType)
+        ? await this.sendBatched(messageType, body)
+        : await this.instance.sendMessage(messageType, body);
       this.log.trace(`Call ${WorldStateMessageType[messageType]} took (ms)`, {
         duration,
         ...logMetadata,
@@ -235,4 +269,77 @@ export class NativeWorldState implements NativeWorldStateInstance {
       throw error;
     }
   }
+
+  private sendBatched<T extends WorldStateMessageType>(
+    messageType: T,
+    body: WorldStateRequest[T],
+  ): Promise<{ duration: RoundtripDuration; response: WorldStateResponse[T] }> {
+    return new Promise((resolve, reject) => {
+      const message = new TypedMessage(messageType, new MessageHeader({ messageId: this.batchedMsgId++ }), body);
+      this.pendingBatch.push({ message, start: process.hrtime.bigint(), resolve, reject });
+      if (this.pendingBatch.length >= MAX_BATCH_SIZE) {
+        void this.flushBatch();
+      } else if (!this.batchFlushScheduled) {
+        this.batchFlushScheduled = true;
+        setImmediate(() => {
+          this.batchFlushScheduled = false;
+          void this.flushBatch();
+        });
+      }
+    });
+  }
+
+  private async flushBatch() {
+    const batch = this.pendingBatch;
+    this.pendingBatch = [];
+    if (batch.length === 0) {
+      return;
+    }
+
+    if (batch.length === 1) {
+      // Nothing to amortise, skip the envelope
+      const [{ message, resolve, reject }] = batch;
+      try {
+        resolve(await this.instance.sendMessage(message.msgType, message.value));
+      } catch (error: any) {
+        reject(error);
+      }
+      return;
+    }
+
+    this.instrumentation.recordBatchSize(batch.length);
+    let result: { duration: RoundtripDuration; response: WorldStateResponse[WorldStateMessageType.BATCH] };
+    try {
+      result = await this.instance.sendMessage(WorldStateMessageType.BATCH, {
+        requests: batch.map(({ message }) => message),
+      });
+    } catch (error: any) {
+      batch.forEach(({ reject }) => reject(error));
+      return;
+    }
+
+    const { duration, response } = result;
+    const end = process.hrtime.bigint();
+    batch.forEach(({ message, start, resolve, reject }, i) => {
+      const entry = response.responses[i];
+      if (entry === undefined) {
+        reject(new Error(`Missing response for batched ${WorldStateMessageType[message.msgType]} request`));
+        return;
+      }
+      this.instrumentation.recordExecutionTime(Number(entry.durationUs), message.msgType);
+      if (!entry.success || entry.response === null) {
+        reject(new Error(entry.error));
+        return;
+      }
+      const subResponse = TypedMessage.fromMessagePack<WorldStateMessageType, any>(entry.response);
+      if (subResponse.msgType !== message.msgType || subResponse.header.requestId !== message.header.messageId) {
+        reject(new Error(`Invalid response for batched ${WorldStateMessageType[message.msgType]} request`));
+        return;
+      }
+      resolve({
+        duration: { ...duration, totalUs: Number((end - start) / 1000n) },
+        response: subResponse.value,
+      });
+    });
+  }
 }
@@ -41,6 +41,7 @@ export const MUTATING_MSG_TYPES = new Set([
   WorldStateMessageType.CREATE_CHECKPOINT,
   WorldStateMessageType.COMMIT_CHECKPOINT,
   WorldStateMessageType.REVERT_CHECKPOINT,
+  WorldStateMessageType.IMPORT_SNAPSHOT,
 ]);
 
 // This class implements the per-fork operation queue